@@ -0,0 +1,36 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Agent class is the abstract parent class of players driven by a program instead of a person, used by
+ * Game::playAgent to play whole games with no terminal input, such as in the Simulator program. Each turn the agent is
+ * shown the map player is in and the player, and chooses an action with the same controls a person has: a move
+ * (W/S/A/D), viewing inventory (I), interacting with the Space next to the player in a direction (E), or exiting
+ * game (Q). Questions the game would ask a person about an action, such as whether to use a key on a locked door, are
+ * answered in the action itself. Agents are told the seed of each game before it starts, so an agent that makes
+ * random choices draws them from that seed and a game played by it is the same every time it is played with that
+ * seed.
+ * Functions: Default Destructor - Abstract Agent class virtual default destructor.
+ * startGame - Get ready to play a new game of seed passed.
+ * chooseAction - Return action of player for this turn.
+ * spaceInDirection - Return Space next to player on map in direction of interaction passed.
+*/
+
+#include "Agent.hpp"
+
+//Abstract Agent class virtual default destructor
+Agent::~Agent() {}
+
+//Return Space next to player on map passed in direction of interaction passed (1 up, 2 down, 3 left, 4 right)
+Space* Agent::spaceInDirection(Map* inputMap, Player* inputPlayer, int inputDirection) {
+    if (inputDirection == 1) {
+        return inputMap->getUp(inputPlayer);
+    }
+    else if (inputDirection == 2) {
+        return inputMap->getDown(inputPlayer);
+    }
+    else if (inputDirection == 3) {
+        return inputMap->getLeft(inputPlayer);
+    }
+
+    return inputMap->getRight(inputPlayer);
+}
@@ -0,0 +1,50 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Agent class is the abstract parent class of players driven by a program instead of a person, used by
+ * Game::playAgent to play whole games with no terminal input, such as in the Simulator program. Each turn the agent is
+ * shown the map player is in and the player, and chooses an action with the same controls a person has: a move
+ * (W/S/A/D), viewing inventory (I), interacting with the Space next to the player in a direction (E), or exiting
+ * game (Q). Questions the game would ask a person about an action, such as whether to use a key on a locked door, are
+ * answered in the action itself. Agents are told the seed of each game before it starts, so an agent that makes
+ * random choices draws them from that seed and a game played by it is the same every time it is played with that
+ * seed.
+ * Functions: Default Destructor - Abstract Agent class virtual default destructor.
+ * startGame - Get ready to play a new game of seed passed.
+ * chooseAction - Return action of player for this turn.
+ * spaceInDirection - Return Space next to player on map in direction of interaction passed.
+*/
+
+#ifndef AGENT_HPP
+#define AGENT_HPP
+
+#include <cstdint>
+#include "Map.hpp"
+#include "Player.hpp"
+
+//Action an agent takes on its turn: control selection (W, S, A, D, I, E or Q) and, for E, direction to interact in
+//(1 up, 2 down, 3 left, 4 right) and answer to whether key is used should Space there be a locked door and player hold
+//a key (1 yes, 2 no)
+struct AgentAction {
+    char selection;
+    int direction;
+    int keyChoice;
+};
+
+class Agent {
+public:
+    //Abstract Agent class virtual default destructor
+    virtual ~Agent();
+
+    //Get ready to play a new game of seed passed, called before each game
+    virtual void startGame(uint64_t inputSeed) = 0;
+
+    //Return action of player passed for this turn, on map player is in. Called again in the same turn when action
+    //did not take a turn (a move into a wall or viewing inventory).
+    virtual AgentAction chooseAction(Map* inputMap, Player* inputPlayer) = 0;
+
+    //Return Space next to player on map passed in direction of interaction passed (1 up, 2 down, 3 left, 4 right)
+    static Space* spaceInDirection(Map* inputMap, Player* inputPlayer, int inputDirection);
+};
+
+#endif //AGENT_HPP
@@ -0,0 +1,130 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Arena class is a monotonic allocator that objects of a map (doors, items and exit points) are
+ * created from. Memory is handed out by bumping an offset through large blocks rather than by one heap allocation per
+ * object, and all of it is given back at once through reset or when the arena is destroyed. Objects that need a
+ * destructor (any Space, as its destructor is virtual) are chained on a finalizer list inside the arena so they are
+ * destroyed before their memory is reused. Reset keeps one block large enough for everything the arena held, so
+ * rebuilding a map of the same contents after a reset allocates nothing from the heap.
+ * Variables: blocks - Most recently allocated block of memory, each block links to the block before it.
+ * offset - Bytes used in newest block. finalizers - Most recently created object needing destruction, each links to the
+ * object created before it. blockSize - Size of next block allocated. blockCount - Number of blocks currently held.
+ * Functions: Constructor takes size of first block to allocate.
+ * Destructor destroys all objects still alive in arena and frees all blocks.
+ * allocate - Return memory for size passed from newest block, allocating a new block if it does not fit.
+ * create - Construct object of type given in arena memory from constructor arguments passed and return pointer to it.
+ * destroy - Destroy object created in arena before reset, memory is not reused until reset.
+ * reset - Destroy all objects still alive in arena and rewind to start of a single block. If more than one block was
+ * held they are replaced by one block of their combined size.
+ * getBlockCount - Return number of blocks currently held by arena.
+ * getUsedBytes - Return bytes handed out by arena since it was last reset, including headers and blocks filled.
+*/
+
+#include <algorithm>
+#include "Arena.hpp"
+
+//Constructor takes size of first block to allocate. No memory is allocated until first object is created.
+Arena::Arena(std::size_t inputBlockSize) {
+    blocks = nullptr;
+    offset = 0;
+    finalizers = nullptr;
+    blockSize = inputBlockSize;
+    blockCount = 0;
+}
+
+//Destructor destroys all objects still alive in arena and frees all blocks.
+Arena::~Arena() {
+    runFinalizers();
+    freeBlocks();
+}
+
+//Run destructors of all objects still alive in arena, newest first
+void Arena::runFinalizers() {
+    for (Finalizer* finalizer = finalizers; finalizer != nullptr; finalizer = finalizer->previous) {
+        //Objects already destroyed through destroy have no destructor left to run
+        if (finalizer->destroy != nullptr) {
+            finalizer->destroy(reinterpret_cast<char*>(finalizer) + headerSize);
+        }
+    }
+
+    finalizers = nullptr;
+}
+
+//Add new block of size passed (including its header) in front of blocks
+void Arena::addBlock(std::size_t inputSize) {
+    Block* block = static_cast<Block*>(::operator new(inputSize));
+    block->previous = blocks;
+    block->size = inputSize;
+
+    blocks = block;
+    offset = headerSize;
+    blockCount++;
+}
+
+//Free all blocks held by arena
+void Arena::freeBlocks() {
+    while (blocks != nullptr) {
+        Block* previous = blocks->previous;
+        ::operator delete(blocks);
+        blocks = previous;
+    }
+
+    offset = 0;
+    blockCount = 0;
+}
+
+//Return memory for size passed from newest block, allocating a new block if it does not fit.
+void* Arena::allocate(std::size_t inputSize) {
+    //Keep every allocation aligned for any type
+    const std::size_t size = (inputSize + alignment - 1) / alignment * alignment;
+
+    if (blocks == nullptr || offset + size > blocks->size) {
+        //Grow block size so that the number of blocks stays small as arena fills
+        addBlock(std::max(blockSize, headerSize + size));
+        blockSize *= 2;
+    }
+
+    void* memory = reinterpret_cast<char*>(blocks) + offset;
+    offset += size;
+
+    return memory;
+}
+
+//Destroy all objects still alive in arena and rewind to start of a single block. If more than one block was held
+//they are replaced by one block of their combined size.
+void Arena::reset() {
+    runFinalizers();
+
+    //Replace several blocks by one holding all of them, so the next fill of the same contents fits in it
+    if (blockCount > 1) {
+        std::size_t totalSize = 0;
+        for (Block* block = blocks; block != nullptr; block = block->previous) {
+            totalSize += block->size;
+        }
+
+        freeBlocks();
+        addBlock(totalSize);
+    }
+
+    offset = headerSize;
+}
+
+//Return number of blocks currently held by arena
+unsigned Arena::getBlockCount() {
+    return blockCount;
+}
+
+//Return bytes handed out by arena since it was last reset, counting headers and every block filled before newest
+std::size_t Arena::getUsedBytes() {
+    if (blocks == nullptr) {
+        return 0;
+    }
+
+    std::size_t usedBytes = offset;
+    for (Block* block = blocks->previous; block != nullptr; block = block->previous) {
+        usedBytes += block->size;
+    }
+
+    return usedBytes;
+}
@@ -0,0 +1,167 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Arena class is a monotonic allocator that objects of a map (doors, items and exit points) are
+ * created from. Memory is handed out by bumping an offset through large blocks rather than by one heap allocation per
+ * object, and all of it is given back at once through reset or when the arena is destroyed. Objects that need a
+ * destructor (any Space, as its destructor is virtual) are chained on a finalizer list inside the arena so they are
+ * destroyed before their memory is reused. Reset keeps one block large enough for everything the arena held, so
+ * rebuilding a map of the same contents after a reset allocates nothing from the heap.
+ * Variables: blocks - Most recently allocated block of memory, each block links to the block before it.
+ * offset - Bytes used in newest block. finalizers - Most recently created object needing destruction, each links to the
+ * object created before it. blockSize - Size of next block allocated. blockCount - Number of blocks currently held.
+ * Functions: Constructor takes size of first block to allocate.
+ * Destructor destroys all objects still alive in arena and frees all blocks.
+ * allocate - Return memory for size passed from newest block, allocating a new block if it does not fit.
+ * create - Construct object of type given in arena memory from constructor arguments passed and return pointer to it.
+ * destroy - Destroy object created in arena before reset, memory is not reused until reset.
+ * reset - Destroy all objects still alive in arena and rewind to start of a single block. If more than one block was
+ * held they are replaced by one block of their combined size.
+ * getBlockCount - Return number of blocks currently held by arena.
+ * getUsedBytes - Return bytes handed out by arena since it was last reset, including headers and blocks filled.
+ * ArenaAllocator - Standard container allocator handing out memory from an Arena, so that node based containers such as
+ * std::unordered_map can be released along with the arena. Deallocation does nothing, memory is given back on reset.
+*/
+
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+class Arena {
+private:
+    //Header at start of each block linking to block allocated before it
+    struct Block {
+        Block* previous;
+        std::size_t size;
+    };
+
+    //Header placed directly before each object that needs a destructor, linking to the object created before it
+    struct Finalizer {
+        Finalizer* previous;
+        void (*destroy)(void*);
+    };
+
+    //Alignment of every allocation and size of Block/Finalizer headers rounded to it
+    static const std::size_t alignment = 16;
+    static const std::size_t headerSize = (sizeof(Finalizer) + alignment - 1) / alignment * alignment;
+
+    //Newest block and bytes used in it
+    Block* blocks;
+    std::size_t offset;
+
+    //Newest object needing destruction
+    Finalizer* finalizers;
+
+    //Size of next block allocated and number of blocks held
+    std::size_t blockSize;
+    unsigned blockCount;
+
+    //Call destructor of object of type given at address passed
+    template <class T>
+    static void destroyObject(void* inputObject) {
+        static_cast<T*>(inputObject)->~T();
+    }
+
+    //Run destructors of all objects still alive in arena, newest first
+    void runFinalizers();
+
+    //Add new block of size passed (including its header) in front of blocks
+    void addBlock(std::size_t);
+
+    //Free all blocks held by arena
+    void freeBlocks();
+
+    //Arena owns its blocks and cannot be copied
+    Arena(const Arena&);
+    Arena& operator=(const Arena&);
+
+public:
+    //Constructor takes size of first block to allocate. No memory is allocated until first object is created.
+    explicit Arena(std::size_t inputBlockSize = 4096);
+
+    //Destructor destroys all objects still alive in arena and frees all blocks.
+    ~Arena();
+
+    //Return memory for size passed from newest block, allocating a new block if it does not fit.
+    void* allocate(std::size_t inputSize);
+
+    //Construct object of type given in arena memory from constructor arguments passed and return pointer to it.
+    //Defined in header as it is a template.
+    template <class T, class... Args>
+    T* create(Args&&... inputArgs) {
+        Finalizer* finalizer = static_cast<Finalizer*>(allocate(headerSize + sizeof(T)));
+        T* object = new (reinterpret_cast<char*>(finalizer) + headerSize) T(std::forward<Args>(inputArgs)...);
+
+        finalizer->destroy = &destroyObject<T>;
+        finalizer->previous = finalizers;
+        finalizers = finalizer;
+
+        return object;
+    }
+
+    //Destroy object created in arena before reset, memory is not reused until reset. Type passed must be polymorphic
+    //so that the object created (possibly of a child class) can be found from a parent class pointer.
+    template <class T>
+    void destroy(T* inputObject) {
+        char* object = static_cast<char*>(dynamic_cast<void*>(inputObject));
+        Finalizer* finalizer = reinterpret_cast<Finalizer*>(object - headerSize);
+
+        finalizer->destroy(object);
+        finalizer->destroy = nullptr;
+    }
+
+    //Destroy all objects still alive in arena and rewind to start of a single block. If more than one block was held
+    //they are replaced by one block of their combined size.
+    void reset();
+
+    //Return number of blocks currently held by arena
+    unsigned getBlockCount();
+
+    //Return bytes handed out by arena since it was last reset, counting headers and every block filled before newest
+    std::size_t getUsedBytes();
+};
+
+//Standard container allocator handing out memory from an Arena. Deallocation does nothing, memory is given back when
+//the arena is reset, so a container using it must be emptied (swapped with an empty container) before that reset.
+template <class T>
+class ArenaAllocator {
+private:
+    Arena* arena;
+
+    template <class U>
+    friend class ArenaAllocator;
+
+public:
+    typedef T value_type;
+
+    //Constructor takes arena that memory is handed out from
+    explicit ArenaAllocator(Arena& inputArena) : arena(&inputArena) {}
+
+    //Copy allocator for another value type, used by containers for their internal nodes
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& inputAllocator) : arena(inputAllocator.arena) {}
+
+    //Return memory for number of values passed from arena
+    T* allocate(std::size_t inputCount) {
+        return static_cast<T*>(arena->allocate(inputCount * sizeof(T)));
+    }
+
+    //Memory is given back when arena is reset
+    void deallocate(T*, std::size_t) {}
+
+    //Allocators are equal when they hand out memory from same arena
+    template <class U>
+    bool operator==(const ArenaAllocator<U>& inputAllocator) const {
+        return arena == inputAllocator.arena;
+    }
+
+    template <class U>
+    bool operator!=(const ArenaAllocator<U>& inputAllocator) const {
+        return arena != inputAllocator.arena;
+    }
+};
+
+#endif //ARENA_HPP
@@ -0,0 +1,1592 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Benchmark program for engine performance work. Builds maps outside of the interactive game and times
+ * the hot paths of the Map class. Run through "make bench" or directly as Benchmark.bin with a benchmark name and
+ * optional arguments.
+ * Benchmarks:
+ * grid [sizes...] - Full map scans and neighbor lookups on square maps of each size given (default 20, 1000 and
+ * 10000). Compares the Map terrain store against a replica of the original jagged Space*** layout, with one heap
+ * Floor/Wall per cell, in which neighbors are found by following the up/down/left/right pointer graph. The replica is
+ * skipped for maps too large to hold one heap tile per cell. Memory used by each layout is also output.
+ * reset [count] - Heap allocations and time per game reset (default 1000 resets). Compares rebuilding all four maps
+ * from scratch, as resets were originally done, against Game::resetWorld, which restores each map from the image it
+ * took when it was set up. Then, for each standard map and a large scenario outdoors map, compares setting map up again
+ * in its arena (Map::resetMap) against Map::restoreImage, and outputs slowest restore. Heap allocations are counted by
+ * replacing global operator new for the benchmark program.
+ * rng [count] - Nanoseconds per random direction drawn (default 1000000 draws). Compares the original zombie randomInt,
+ * which built a std::random_device and std::mt19937 on every call, against the counter-based Random service.
+ * zombies [size] [count] [turns] - Zombie steps per second on a square map (default 1000x1000 with 100000 zombies
+ * moved for 100 turns). Compares a replica of the original per-object zombie loop, one heap Zombie per zombie moved
+ * through virtual Space calls on the cells around it, against the ZombieSwarm batched move kernel. Both draw from the
+ * same random streams, so they must leave every zombie in the same cell, which is checked.
+ * tick [maps] [zombies] [turns] [threads] - Turns per second moving every map of a world (default 32 maps of 256x256
+ * with 5000 zombies each, 100 turns). Compares moving maps one after another against moving them as one task per map
+ * on a ThreadPool (default one thread per core), and checks that both leave every zombie in the same cell.
+ * lod [maps] [zombies] [turns] [interval] - Turns per second and slowest turn for a world whose player moves to the
+ * next map every 50 turns (default 32 maps of 256x256 with 5000 zombies each, 400 turns). Compares moving every map
+ * every turn against maps player is not in skipping turns and being caught up every interval turns (default 8) as Game
+ * does, and against only catching a map up when player enters it. Checks that all leave every zombie in the same cell
+ * once every map is caught up.
+ * horde [size] [zombies] [turns] [threads] - Zombie steps per second for one large horde (default 1000x1000 with
+ * 200000 zombies, 50 turns). Compares moving zombies in order against two phase moves on calling thread and on a
+ * ThreadPool (default one thread per core), and checks that two phase moves end the same for any thread count.
+ * chase [size] [radius] [turns] - Nanoseconds per zombie per turn for 1000, 10000 and 100000 zombies chasing a player
+ * that steps back and forth every turn (default 1000x1000, chase radius 64, 100 turns), so that the flow field is built
+ * again every turn. Compares against the same zombies wandering at random, and outputs time of one field build alone,
+ * which is the same however many zombies chase.
+ * path [tiles] [searches] [zombies] [turns] - Pathfinding on the grocery store layout (shelves, counters and pharmacy
+ * walls) repeated tiles by tiles times, default 10 by 10 for a map 100 times the size of the store. Times A* against
+ * jump point search over random pairs of floor cells (default 200 searches) and checks both find paths of the same
+ * length. Then gives zombies (default 2000) one shared far goal and moves them (default 200 turns), outputting time per
+ * zombie per turn and how many full searches the path cache left, against one full search per zombie per turn.
+ * attack [size] [radius] - Nanoseconds per attack check around the player and per radius query (default radius 8)
+ * for 1000 up to 1000000 zombies on a square map (default 2000x2000). Compares a replica of the original checkZombies,
+ * which looked around every zombie for the player, against Map::checkZombies reading the cells around the player, and
+ * a scan of every zombie against Map::zombiesNear. Checks both radius queries find the same number of zombies.
+ * deaths [size] [zombies] - Time for zombies of one turn to die (default 100000 zombies on 1000x1000), with every
+ * zombie, every other zombie and every tenth zombie dying. Compares a replica of the original removal, which erased
+ * each dead zombie from the middle of the zombie vector, against Map killing zombies and removing them after the loop
+ * by moving the last zombie into each index. Checks that handles taken before find every survivor in its cell and
+ * every dead zombie stale.
+ * sight [tiles] [radius] [zombies] - Line of sight on the grocery store layout repeated tiles by tiles times (default
+ * 10 by 10) with zombies scattered over it (default 20000). Player visits a round of floor cells, and every zombie
+ * within sight radius (default 10) of player is checked for whether player sees it. Compares walking a ray to each
+ * zombie against one bit test of the player's view cached by SightTable, and outputs time to cast a view the first
+ * time player stands in a cell. Outputs how many zombies each way finds in sight.
+ * noise [tiles] [noises] [loudness] - Noise spread on the grocery store layout repeated tiles by tiles times (default
+ * 10 by 10), with noises (default 64) of loudness steps (default that of a door) made at random floor cells in a turn.
+ * Compares a breadth first search per noise with arrays of its own, as noise would be spread without NoiseField,
+ * against a NoiseField pass per noise and one NoiseField pass for all noises of the turn. Outputs time and heap
+ * allocations per noise and checks the merged pass reaches the same cells as the passes per noise together.
+ * snapshot [size] [zombies] [count] - Save and load of map state (default 2000x2000 with 100000 zombies, 20 times
+ * each). Times Map::saveState and Map::loadState against memcpy of the same state as held in memory (terrain and
+ * occupancy layers and zombie arrays), and outputs bytes saved against bytes in memory. Then times Game::saveState
+ * and Game::loadState of a standard game. Checks that a map loaded has the state hash of the map saved.
+ * clone [size] [zombies] [count] - Time to copy a game in play (default 1000 copies), for a standard game and for a
+ * scenario game with outdoors map of size by size cells and zombies added (default 500 and 20000). Compares
+ * Game::clone, which sets up a new Game and copies into it, against Game::copyFrom into a game already set up and a
+ * round trip through Game::saveState and Game::loadState. Outputs heap allocations and microseconds per copy, and
+ * checks that each copy has the state hash of the game copied.
+ * Functions: BenchMap - Map child class with no setup so that maps of any size can be built for timing. Also
+ * scatters zombies and moves them through the replica of the original zombie loop.
+ * ReplicaZombie - Zombie state held in one heap object per zombie, as every zombie was originally.
+ * ReplicaTile - Floor carrying up/down/left/right pointers as every tile did in the original layout.
+ * elapsedSeconds - Return seconds passed since starting time point passed as parameter.
+ * benchGrid - Run grid benchmark for one map size.
+ * operator new/delete - Count every heap allocation made while benchmark program runs.
+ * benchReset - Run reset benchmark for number of resets passed.
+ * benchMapReset - Time setting one map up again against restoring its image.
+ * benchRng - Run random number benchmark for number of draws passed.
+ * benchZombies - Run zombie benchmark for map size, number of zombies and number of turns passed.
+ * benchTick - Run world tick benchmark for number of maps, zombies per map, turns and threads passed.
+ * runLodTurns - Move world for a number of turns as Game does with a level of detail interval.
+ * benchLod - Run level of detail benchmark for number of maps, zombies per map, turns and interval passed.
+ * benchHorde - Run horde benchmark for map size, number of zombies, turns and threads passed.
+ * benchChase - Run chase benchmark for map size, chase radius and turns passed.
+ * benchPath - Run pathfinding benchmark for number of store tiles, searches, zombies and turns passed.
+ * benchAttack - Run attack and radius query benchmark for map size and radius passed.
+ * benchDeaths - Run zombie death benchmark for map size and number of zombies passed.
+ * benchSight - Run line of sight benchmark for number of store tiles, sight radius and number of zombies passed.
+ * benchNoise - Run noise benchmark for number of store tiles, noises per turn and loudness passed.
+ * benchSnapshot - Run snapshot benchmark for map size, number of zombies and number of saves and loads passed.
+ * WalkAgent - Agent taking a fixed list of moves, then exiting game.
+ * benchClone - Run clone benchmark for one game and number of copies passed.
+ * main - Select benchmark from command line arguments and run it.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Map.hpp"
+#include "Game.hpp"
+#include "GroceryStore.hpp"
+#include "Agent.hpp"
+
+//Number of heap allocations made since benchmark program started, counted from any thread
+static std::atomic<unsigned long long> heapAllocations(0);
+
+//Count every heap allocation made while benchmark program runs
+void* operator new(std::size_t inputSize) {
+    heapAllocations++;
+
+    void* memory = std::malloc(inputSize ? inputSize : 1);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+//Free memory counted by operator new
+void operator delete(void* inputMemory) noexcept {
+    std::free(inputMemory);
+}
+
+//Free memory counted by operator new
+void operator delete(void* inputMemory, std::size_t) noexcept {
+    std::free(inputMemory);
+}
+
+//Zombie state held in one heap object per zombie, as every zombie was originally
+class ReplicaZombie : public GamePiece {
+public:
+    int movesLeft = 2;
+    int currentDirection = 0;
+    uint64_t randomStream;
+    uint64_t randomCounter = 0;
+
+    //Constructor takes row/col and random stream of zombie
+    ReplicaZombie(int inputRow, int inputCol, uint64_t inputStream) : GamePiece('z', inputRow, inputCol, KIND_ZOMBIE),
+            randomStream(inputStream) {}
+};
+
+//Map child class with no setup so that maps of any size can be built for timing
+class BenchMap : public Map {
+public:
+    //Replica zombies, created by scatterZombies alongside zombies of map
+    std::vector <ReplicaZombie*> replicaZombies;
+
+    //Constructor passes size of map, Random service and name to Map class, player start is unused. Maps of different
+    //names draw from different random streams.
+    BenchMap(int inputRows, int inputCols, Random* inputRandom = nullptr, std::string inputName = "bench") :
+            Map(inputName, inputRows, inputCols, 1, 1, inputRandom) {}
+
+    //Free replica zombies
+    ~BenchMap() {
+        for (unsigned count = 0; count < replicaZombies.size(); count++) {
+            delete replicaZombies[count];
+        }
+    }
+
+    //No items or zombies are added to benchmark maps by setup
+    void mapSetup() {}
+
+    //Place number of zombies passed on random free interior cells, both in map and as replica zombies drawing from
+    //same random streams. Cells are drawn from stream just below first zombie stream of map. Stops early if free cells
+    //are too hard to find, such as when more zombies are asked for than fit. Returns number of zombies placed.
+    int scatterZombies(int inputCount) {
+        const uint64_t maxDraws = 64 * static_cast<uint64_t>(inputCount) + 1024;
+        uint64_t draw = 0;
+        while (static_cast<int>(zombies.size()) < inputCount && draw < maxDraws) {
+            const int row = mapRandom->randomInt(streamBase - 1, draw++, 1, rows - 2);
+            const int col = mapRandom->randomInt(streamBase - 1, draw++, 1, cols - 2);
+
+            if (!isZombieAt(row, col) && !isPlayerAt(row, col) && isFloor(row, col)) {
+                replicaZombies.push_back(new ReplicaZombie(row, col, streamBase + zombieStreams));
+                addZombie(row, col);
+            }
+        }
+
+        return static_cast<int>(zombies.size());
+    }
+
+    //Move replica zombies as the original moveZombies did: for each zombie, look up the four Spaces around it and
+    //apply the move rule through virtual calls on them. Uses occupancy layer of map, so replica zombies and zombies
+    //of map are not moved on the same map.
+    void moveReplicaZombies() {
+        for (unsigned count = 0; count < replicaZombies.size(); count++) {
+            ReplicaZombie* zombie = replicaZombies[count];
+            occupancy[tileIndex(zombie->getRows(), zombie->getCols())] = NO_ENTITY;
+
+            const int row = zombie->getRows();
+            const int col = zombie->getCols();
+            Space* upSpace = getUp(zombie);
+            Space* downSpace = getDown(zombie);
+            Space* leftSpace = getLeft(zombie);
+            Space* rightSpace = getRight(zombie);
+
+            //No player on benchmark maps, every zombie moves
+            if (zombie->movesLeft <= 0) {
+                zombie->currentDirection = mapRandom->randomInt(zombie->randomStream, zombie->randomCounter++, 1, 4);
+                zombie->movesLeft = 2;
+            }
+
+            if (zombie->currentDirection == 1 && !upSpace->getSolid() && !upSpace->getInteract() &&
+                !isZombieAt(row - 1, col) && !upSpace->isOpenDoor()) {
+                zombie->setRows(row - 1);
+                zombie->movesLeft--;
+            }
+            else if (zombie->currentDirection == 2 && !rightSpace->getSolid() && !rightSpace->getInteract() &&
+                !isZombieAt(row, col + 1) && !rightSpace->isOpenDoor()) {
+                zombie->setCols(col + 1);
+                zombie->movesLeft--;
+            }
+            else if (zombie->currentDirection == 3 && !downSpace->getSolid() && !downSpace->getInteract() &&
+                !isZombieAt(row + 1, col) && !downSpace->isOpenDoor()) {
+                zombie->setRows(row + 1);
+                zombie->movesLeft--;
+            }
+            else if (zombie->currentDirection == 4 && !leftSpace->getSolid() && !leftSpace->getInteract() &&
+                !isZombieAt(row, col - 1) && !leftSpace->isOpenDoor()) {
+                zombie->setCols(col - 1);
+                zombie->movesLeft--;
+            }
+            else {
+                zombie->movesLeft = 0;
+            }
+
+            occupancy[tileIndex(zombie->getRows(), zombie->getCols())] = ZOMBIE_ENTITY + static_cast<int>(count);
+        }
+    }
+
+    //Move player passed to row/col of map unless a zombie is there. Returns whether player moved.
+    bool placePlayer(Player* inputPlayer, int inputRow, int inputCol) {
+        if (isZombieAt(inputRow, inputCol)) {
+            return false;
+        }
+
+        if (mapPlayer != nullptr) {
+            removePlayer(mapPlayer);
+        }
+        inputPlayer->setRows(inputRow);
+        inputPlayer->setCols(inputCol);
+        setPlayerLocation(inputPlayer, inputRow, inputCol);
+
+        return true;
+    }
+
+    //Fill map with inside of map passed (all but its outer walls) repeated tiles by tiles times from row/col 1, 1.
+    //Floor, wall and shelf cells are copied, cells holding objects become walls as zombies cannot enter them either.
+    void tileLayout(Map& inputSource, int inputTiles) {
+        const int tileRows = inputSource.getRows() - 2;
+        const int tileCols = inputSource.getCols() - 2;
+
+        for (int row = 0; row < tileRows * inputTiles; row++) {
+            for (int col = 0; col < tileCols * inputTiles; col++) {
+                const SpaceKind kind = inputSource.getTile(row % tileRows + 1, col % tileCols + 1)->getKind();
+
+                terrain[tileIndex(row + 1, col + 1)] = static_cast<unsigned char>((kind == KIND_FLOOR) ?
+                        TERRAIN_FLOOR : ((kind == KIND_SHELF) ? TERRAIN_SHELF : TERRAIN_WALL));
+            }
+        }
+    }
+
+    //Give every zombie of map row/col as goal
+    void setGoals(int inputRow, int inputCol) {
+        for (unsigned count = 0; count < zombies.size(); count++) {
+            setZombieGoal(count, inputRow, inputCol);
+        }
+    }
+
+    //Return Pathfinder of map
+    Pathfinder& getPathfinder() {
+        return pathfinder;
+    }
+
+    //Return tileIndex of every zombie of map
+    std::vector <int> zombieTiles() {
+        std::vector <int> tiles;
+        for (unsigned count = 0; count < zombies.size(); count++) {
+            tiles.push_back(tileIndex(zombies.rows[count], zombies.cols[count]));
+        }
+
+        return tiles;
+    }
+
+    //Return whether row/col is floor
+    bool isFloor(int inputRow, int inputCol) {
+        return terrain[tileIndex(inputRow, inputCol)] == TERRAIN_FLOOR;
+    }
+
+    //Return number of zombies next to player passed, found as the original checkZombies did by looking around every
+    //zombie on map for player
+    int replicaNeighbors(Player* inputPlayer) {
+        int found = 0;
+        for (unsigned count = 0; count < zombies.size(); count++) {
+            const int zombieRow = zombies.rows[count];
+            const int zombieCol = zombies.cols[count];
+
+            if (isPlayerAt(zombieRow-1, zombieCol) || isPlayerAt(zombieRow+1, zombieCol) ||
+                isPlayerAt(zombieRow, zombieCol+1) || isPlayerAt(zombieRow, zombieCol-1)) {
+                found++;
+            }
+        }
+
+        return found;
+    }
+
+    //Return number of zombies within radius rows and columns of row/col, found by looking at every zombie on map
+    int scanNear(int inputRow, int inputCol, int inputRadius) {
+        int found = 0;
+        for (unsigned count = 0; count < zombies.size(); count++) {
+            found += (std::abs(zombies.rows[count] - inputRow) <= inputRadius) &&
+                     (std::abs(zombies.cols[count] - inputCol) <= inputRadius);
+        }
+
+        return found;
+    }
+
+    //Erase every zombie whose index is a multiple of step passed from replica zombies, as the original moveZombies
+    //removed a dead zombie: deleted and erased from the middle of the vector while it was walked
+    void eraseReplicaZombies(unsigned inputStep) {
+        unsigned original = 0;
+        for (unsigned count = 0; count < replicaZombies.size(); original++) {
+            if (original % inputStep == 0) {
+                delete replicaZombies[count];
+                replicaZombies.erase(replicaZombies.begin() + count);
+            }
+            else {
+                count++;
+            }
+        }
+    }
+
+    //Kill every zombie of map whose index is a multiple of step passed, then remove them as a turn does
+    void killZombies(unsigned inputStep) {
+        for (unsigned count = 0; count < zombies.size(); count += inputStep) {
+            killZombie(count);
+        }
+
+        removeDeadZombies();
+    }
+
+    //Return number of zombies of map
+    unsigned zombieCount() {
+        return zombies.size();
+    }
+
+    //Return whether zombie at index passed is at row/col
+    bool zombieAt(unsigned zombieIndex, int inputRow, int inputCol) {
+        return zombies.rows[zombieIndex] == inputRow && zombies.cols[zombieIndex] == inputCol &&
+               isZombieAt(inputRow, inputCol);
+    }
+
+    //Set sight radius and mark every cell that blocks sight, as map does on first use after terrain is laid out
+    void prepareSight(int inputRadius) {
+        sightTable.setRadius(inputRadius);
+        fillSight();
+    }
+
+    //Return SightTable of map
+    SightTable& getSightTable() {
+        return sightTable;
+    }
+
+    //Return whether a ray walked cell by cell from viewer row/col to row/col passed reaches it, with no cell between
+    //them blocking sight. Walk is a Bresenham line, the per-query check zombies would make without cached views.
+    bool rayClear(int viewerRow, int viewerCol, int inputRow, int inputCol) {
+        const int rowSpan = std::abs(inputRow - viewerRow);
+        const int colSpan = std::abs(inputCol - viewerCol);
+        const int rowStep = (inputRow > viewerRow) ? 1 : -1;
+        const int colStep = (inputCol > viewerCol) ? 1 : -1;
+        int row = viewerRow;
+        int col = viewerCol;
+        int error = colSpan - rowSpan;
+
+        while (row != inputRow || col != inputCol) {
+            if (2 * error > -rowSpan) {
+                error -= rowSpan;
+                col += colStep;
+            }
+            if (2 * error < colSpan) {
+                error += colSpan;
+                row += rowStep;
+            }
+
+            if ((row != inputRow || col != inputCol) && blocksSight(tileIndex(row, col))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //Return number of zombies at indices passed that can be seen from player row/col, each checked by a ray
+    unsigned raySpotted(int playerRow, int playerCol, const std::vector <unsigned>& inputIndices) {
+        unsigned seen = 0;
+        for (unsigned count = 0; count < inputIndices.size(); count++) {
+            const unsigned zombieIndex = inputIndices[count];
+            seen += rayClear(playerRow, playerCol, zombies.rows[zombieIndex], zombies.cols[zombieIndex]);
+        }
+
+        return seen;
+    }
+
+    //Return number of zombies at indices passed that can be seen from player row/col, each checked by one bit test of
+    //player's cached view as spotPlayer does
+    unsigned viewSpotted(int playerRow, int playerCol, const std::vector <unsigned>& inputIndices) {
+        const std::vector <uint64_t>& view = sightTable.viewFrom(playerRow, playerCol);
+
+        unsigned seen = 0;
+        for (unsigned count = 0; count < inputIndices.size(); count++) {
+            seen += sightTable.inView(view, zombies.rows[inputIndices[count]] - playerRow,
+                                      zombies.cols[inputIndices[count]] - playerCol);
+        }
+
+        return seen;
+    }
+
+    //Return terrain layer of map, one TerrainKind byte per cell in row-major order
+    const unsigned char* terrainLayer() {
+        return terrain.data();
+    }
+
+    //Return number of floor cells within loudness steps of cell at tileIndex passed, found as a noise would be without
+    //NoiseField: a breadth first search with its own visited array and queue, allocated and cleared for every noise
+    int replicaNoise(int inputSource, int inputLoudness) {
+        std::vector <int> steps(rows * cols, -1);
+        std::vector <int> queue(1, inputSource);
+        steps[inputSource] = inputLoudness;
+
+        for (unsigned head = 0; head < queue.size(); head++) {
+            const int index = queue[head];
+            if (steps[index] == 0) {
+                continue;
+            }
+
+            const int neighbors[4] = {index - cols, index + 1, index + cols, index - 1};
+            for (int count = 0; count < 4; count++) {
+                if (steps[neighbors[count]] < 0 && terrain[neighbors[count]] == TERRAIN_FLOOR) {
+                    steps[neighbors[count]] = steps[index] - 1;
+                    queue.push_back(neighbors[count]);
+                }
+            }
+        }
+
+        return static_cast<int>(queue.size());
+    }
+
+    //Build flow field from player location, as moveZombies does when player has moved
+    void buildChaseField() {
+        flowField.buildField(terrain.data(), rows, cols, mapPlayer->getRows(), mapPlayer->getCols());
+    }
+
+    //Return hash of cells of all zombies of map, equal for maps whose zombies are all in same cells
+    uint64_t zombieCells() {
+        uint64_t hash = 0;
+        for (unsigned count = 0; count < zombies.size(); count++) {
+            hash = Random::mix(hash + static_cast<uint64_t>(tileIndex(zombies.rows[count], zombies.cols[count])));
+        }
+
+        return hash;
+    }
+
+    //Return whether every replica zombie is in same cell as zombie of map with same index
+    bool replicaMatches() {
+        for (unsigned count = 0; count < replicaZombies.size(); count++) {
+            if (replicaZombies[count]->getRows() != zombies.rows[count] ||
+                replicaZombies[count]->getCols() != zombies.cols[count]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+//Replica of an original tile: a Space carrying its own up/down/left/right pointers to the tiles around it
+class ReplicaTile : public Floor {
+public:
+    ReplicaTile* up = nullptr;
+    ReplicaTile* down = nullptr;
+    ReplicaTile* left = nullptr;
+    ReplicaTile* right = nullptr;
+};
+
+//Return seconds passed since starting time point passed as parameter
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//Largest map size for which the original one-heap-tile-per-cell replica is built
+static const int maxReplicaSize = 2000;
+
+//Run grid benchmark for one map size. Scans every tile and looks up every interior tile's four neighbors through
+//both the Map terrain store and a replica of the original jagged layout, and outputs ns per tile for each.
+static void benchGrid(int size) {
+    BenchMap map(size, size);
+
+    //Repeat small maps so that each measurement covers roughly the same number of tiles
+    const long long tiles = static_cast<long long>(size) * size;
+    const int passes = static_cast<int>(std::max(1LL, 50000000LL / tiles));
+    const double visited = static_cast<double>(tiles) * passes * 1e-9;
+    volatile long long sink = 0;
+    long long total = 0;
+
+    std::cout << std::fixed << std::setprecision(3) << size << "x" << size << std::endl;
+
+    //Replica of original layout: one heap array per row and one heap Floor/Wall per cell, neighbors found through
+    //pointer graph on each tile
+    if (size <= maxReplicaSize) {
+        ReplicaTile*** jaggedTiles = new ReplicaTile**[size];
+        for (int row = 0; row < size; row++) {
+            jaggedTiles[row] = new ReplicaTile*[size];
+            for (int col = 0; col < size; col++) {
+                jaggedTiles[row][col] = new ReplicaTile();
+
+                //Outer tiles are walls
+                if (row == 0 || col == 0 || row == size - 1 || col == size - 1) {
+                    jaggedTiles[row][col]->setSolid(true);
+                    jaggedTiles[row][col]->setVisual('#');
+                }
+            }
+        }
+        for (int row = 0; row < size; row++) {
+            for (int col = 0; col < size; col++) {
+                jaggedTiles[row][col]->up = (row > 0) ? jaggedTiles[row - 1][col] : nullptr;
+                jaggedTiles[row][col]->down = (row < size - 1) ? jaggedTiles[row + 1][col] : nullptr;
+                jaggedTiles[row][col]->left = (col > 0) ? jaggedTiles[row][col - 1] : nullptr;
+                jaggedTiles[row][col]->right = (col < size - 1) ? jaggedTiles[row][col + 1] : nullptr;
+            }
+        }
+
+        //Full map scan through jagged layout
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; pass++) {
+            for (int row = 0; row < size; row++) {
+                for (int col = 0; col < size; col++) {
+                    total += jaggedTiles[row][col]->getVisual();
+                }
+            }
+        }
+        double jaggedScan = elapsedSeconds(start);
+
+        //Neighbor lookups through pointer graph as the original moves did
+        start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; pass++) {
+            for (int row = 1; row < size - 1; row++) {
+                for (int col = 1; col < size - 1; col++) {
+                    ReplicaTile* tile = jaggedTiles[row][col];
+                    total += tile->up->getSolid() + tile->down->getSolid() +
+                             tile->left->getSolid() + tile->right->getSolid();
+                }
+            }
+        }
+        double jaggedNeighbors = elapsedSeconds(start);
+
+        for (int row = 0; row < size; row++) {
+            for (int col = 0; col < size; col++) {
+                delete jaggedTiles[row][col];
+            }
+            delete[] jaggedTiles[row];
+        }
+        delete[] jaggedTiles;
+
+        std::cout << "  jagged replica  scan " << jaggedScan / visited << " ns/tile, neighbors "
+                  << jaggedNeighbors / visited << " ns/tile, memory "
+                  << tiles * (sizeof(Space*) + sizeof(ReplicaTile)) / 1048576.0 << " MB" << std::endl;
+    }
+    else {
+        std::cout << "  jagged replica  skipped, would need "
+                  << tiles * (sizeof(Space*) + sizeof(ReplicaTile)) / 1048576.0 << " MB" << std::endl;
+    }
+
+    //Full map scan through terrain store
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int row = 0; row < size; row++) {
+            for (int col = 0; col < size; col++) {
+                total += map.getTile(row, col)->getVisual();
+            }
+        }
+    }
+    double flatScan = elapsedSeconds(start);
+
+    //Neighbor lookups through row/col indexing of terrain store
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int row = 1; row < size - 1; row++) {
+            for (int col = 1; col < size - 1; col++) {
+                total += map.getTile(row - 1, col)->getSolid() + map.getTile(row + 1, col)->getSolid() +
+                         map.getTile(row, col - 1)->getSolid() + map.getTile(row, col + 1)->getSolid();
+            }
+        }
+    }
+    double flatNeighbors = elapsedSeconds(start);
+    sink = total;
+
+    std::cout << "  Map store       scan " << flatScan / visited << " ns/tile, neighbors "
+              << flatNeighbors / visited << " ns/tile, memory " << tiles / 1048576.0 << " MB" << std::endl;
+    (void)sink;
+}
+
+//Run reset benchmark for one map, named as passed, and number of resets passed. Outputs heap allocations and
+//microseconds per reset for setting map up again in its arena and for restoring the image it took, and slowest
+//restore.
+static void benchMapReset(Map* inputMap, const std::string& inputName, int resets) {
+    inputMap->captureImage();
+
+    unsigned long long startAllocations = heapAllocations;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int count = 0; count < resets; count++) {
+        inputMap->resetMap();
+    }
+    double setupSeconds = elapsedSeconds(start);
+    unsigned long long setupAllocations = heapAllocations - startAllocations;
+
+    double slowestSeconds = 0;
+    bool restored = true;
+    startAllocations = heapAllocations;
+    start = std::chrono::steady_clock::now();
+    for (int count = 0; count < resets; count++) {
+        const std::chrono::steady_clock::time_point restoreStart = std::chrono::steady_clock::now();
+        restored = inputMap->restoreImage() && restored;
+        slowestSeconds = std::max(slowestSeconds, elapsedSeconds(restoreStart));
+    }
+    double restoreSeconds = elapsedSeconds(start);
+    unsigned long long restoreAllocations = heapAllocations - startAllocations;
+
+    std::cout << "  " << inputName << " (" << inputMap->getRows() << "x" << inputMap->getCols() << ")"
+              << std::endl;
+    std::cout << "    Map::resetMap       " << static_cast<double>(setupAllocations) / resets << " allocations, "
+              << setupSeconds / resets * 1e6 << " us per reset" << std::endl;
+    std::cout << "    Map::restoreImage   " << static_cast<double>(restoreAllocations) / resets << " allocations, "
+              << restoreSeconds / resets * 1e6 << " us per reset, slowest " << slowestSeconds * 1e6 << " us"
+              << (restored ? "" : ", IMAGE NOT RESTORED") << std::endl;
+}
+
+//Run reset benchmark for number of resets passed. Outputs heap allocations and microseconds per reset for rebuilding
+//all four maps from scratch and for resetting them through Game::resetWorld, then for each map set up again and
+//restored from its image.
+static void benchReset(int resets) {
+    Game game(1);
+    Random benchRandom(1);
+
+    std::cout << std::fixed << std::setprecision(3);
+
+    //Rebuild maps from scratch by deleting and creating each map as resets were originally done (doors and player
+    //are not included as Game links those)
+    unsigned long long startAllocations = heapAllocations;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int count = 0; count < resets; count++) {
+        delete new Outdoors("Outside", &benchRandom);
+        delete new GroceryStore("Grocery Store", &benchRandom);
+        delete new OutdoorRecSupplier("Outdoor Recreational Supplier", &benchRandom);
+        delete new Field("Field", &benchRandom);
+    }
+    double rebuildSeconds = elapsedSeconds(start);
+    unsigned long long rebuildAllocations = heapAllocations - startAllocations;
+
+    //Reset world from map images, same seed each time as a new seed only changes what zombies draw
+    game.resetWorld(1);
+    startAllocations = heapAllocations;
+    start = std::chrono::steady_clock::now();
+    for (int count = 0; count < resets; count++) {
+        game.resetWorld(1);
+    }
+    double resetSeconds = elapsedSeconds(start);
+    unsigned long long resetAllocations = heapAllocations - startAllocations;
+
+    std::cout << "rebuild maps       " << static_cast<double>(rebuildAllocations) / resets << " allocations, "
+              << rebuildSeconds / resets * 1e6 << " us per reset" << std::endl;
+    std::cout << "Game::resetWorld   " << static_cast<double>(resetAllocations) / resets << " allocations, "
+              << resetSeconds / resets * 1e6 << " us per reset (player is created again)" << std::endl;
+
+    //Each map alone, and a scenario outdoors map whose setup scatters zombies over a large map
+    Outdoors outside("Outside", &benchRandom);
+    GroceryStore groceryStore("Grocery Store", &benchRandom);
+    OutdoorRecSupplier recSupplier("Outdoor Recreational Supplier", &benchRandom);
+    Field field("Field", &benchRandom);
+    Outdoors scenario("Outside", &benchRandom, 500, 500, 20000);
+
+    benchMapReset(&outside, "Outside", resets);
+    benchMapReset(&groceryStore, "Grocery Store", resets);
+    benchMapReset(&recSupplier, "Outdoor Recreational Supplier", resets);
+    benchMapReset(&field, "Field", resets);
+    benchMapReset(&scenario, "Outside scenario, 20000 zombies", std::max(1, resets / 100));
+}
+
+//Run random number benchmark for number of draws passed. Outputs ns per direction drawn by the original per-call
+//engine and by the Random service.
+static void benchRng(int draws) {
+    long long total = 0;
+    volatile long long sink = 0;
+
+    std::cout << std::fixed << std::setprecision(3);
+
+    //Original randomInt: new random device and engine for every number drawn
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int count = 0; count < draws; count++) {
+        std::random_device randomNumDevice;
+        std::mt19937 generateNum(randomNumDevice());
+        std::uniform_int_distribution<> dis(1, 4);
+        total += dis(generateNum);
+    }
+    double engineSeconds = elapsedSeconds(start);
+
+    //Random service: one hash of seed, zombie stream and counter per number drawn
+    Random random(1);
+    start = std::chrono::steady_clock::now();
+    for (int count = 0; count < draws; count++) {
+        total += random.randomInt(static_cast<uint64_t>(count & 255), static_cast<uint64_t>(count >> 8), 1, 4);
+    }
+    double serviceSeconds = elapsedSeconds(start);
+    sink = total;
+
+    std::cout << "random_device + mt19937  " << engineSeconds / draws * 1e9 << " ns per draw" << std::endl;
+    std::cout << "Random service           " << serviceSeconds / draws * 1e9 << " ns per draw" << std::endl;
+    (void)sink;
+}
+
+//Run zombie benchmark for map size, number of zombies and number of turns passed. Outputs millions of zombie steps per
+//second for the replica of the original zombie loop and for the ZombieSwarm move kernel.
+static void benchZombies(int size, int count, int turns) {
+    Random random(1);
+    const double steps = static_cast<double>(count) * turns * 1e-6;
+
+    std::cout << std::fixed << std::setprecision(3) << size << "x" << size << ", " << count << " zombies, " << turns
+              << " turns" << std::endl;
+
+    //Replica of original loop, moved on its own map so that both start from same cells
+    BenchMap replicaMap(size, size, &random);
+    replicaMap.scatterZombies(count);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        replicaMap.moveReplicaZombies();
+    }
+    double replicaSeconds = elapsedSeconds(start);
+
+    //ZombieSwarm move kernel
+    BenchMap swarmMap(size, size, &random);
+    swarmMap.scatterZombies(count);
+    start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        swarmMap.moveZombies();
+    }
+    double swarmSeconds = elapsedSeconds(start);
+
+    //Both maps hold replica zombies and zombies in same cells, compare replica of one against zombies of other
+    swarmMap.replicaZombies.swap(replicaMap.replicaZombies);
+
+    std::cout << "  per-object zombies   " << steps / replicaSeconds << " M steps/s" << std::endl;
+    std::cout << "  ZombieSwarm kernel   " << steps / swarmSeconds << " M steps/s" << std::endl;
+    std::cout << "  final cells " << (swarmMap.replicaMatches() ? "match" : "DIFFER") << std::endl;
+}
+
+//Run world tick benchmark for number of maps, zombies per map, turns and threads passed. Outputs turns per second when
+//maps are moved one after another and when moved as one task per map on a ThreadPool.
+static void benchTick(int mapCount, int count, int turns, unsigned threads) {
+    const int size = 256;
+    Random random(1);
+    std::vector <BenchMap*> sequentialMaps;
+    std::vector <BenchMap*> pooledMaps;
+    uint64_t sequentialCells = 0;
+    uint64_t pooledCells = 0;
+
+    //Same world twice, each map named apart so that its zombies draw from their own streams
+    for (int mapIndex = 0; mapIndex < mapCount; mapIndex++) {
+        const std::string name = "bench " + std::to_string(mapIndex);
+
+        sequentialMaps.push_back(new BenchMap(size, size, &random, name));
+        sequentialMaps.back()->scatterZombies(count);
+        pooledMaps.push_back(new BenchMap(size, size, &random, name));
+        pooledMaps.back()->scatterZombies(count);
+    }
+
+    ThreadPool pool(threads - 1);
+
+    std::cout << std::fixed << std::setprecision(3) << mapCount << " maps of " << size << "x" << size << ", " << count
+              << " zombies each, " << turns << " turns, " << pool.getThreadCount() << " threads" << std::endl;
+
+    //Maps one after another
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        for (unsigned mapIndex = 0; mapIndex < sequentialMaps.size(); mapIndex++) {
+            sequentialMaps[mapIndex]->moveZombies();
+        }
+    }
+    double sequentialSeconds = elapsedSeconds(start);
+
+    //One task per map on thread pool, barrier at end of each turn
+    start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        pool.run(static_cast<unsigned>(pooledMaps.size()), [&pooledMaps](unsigned mapIndex) {
+            pooledMaps[mapIndex]->moveZombies();
+        });
+    }
+    double pooledSeconds = elapsedSeconds(start);
+
+    for (int mapIndex = 0; mapIndex < mapCount; mapIndex++) {
+        sequentialCells = Random::mix(sequentialCells + sequentialMaps[mapIndex]->zombieCells());
+        pooledCells = Random::mix(pooledCells + pooledMaps[mapIndex]->zombieCells());
+        delete sequentialMaps[mapIndex];
+        delete pooledMaps[mapIndex];
+    }
+
+    std::cout << "  one after another    " << turns / sequentialSeconds << " turns/s" << std::endl;
+    std::cout << "  ThreadPool           " << turns / pooledSeconds << " turns/s" << std::endl;
+    std::cout << "  final cells " << ((sequentialCells == pooledCells) ? "match" : "DIFFER") << std::endl;
+}
+
+//Move world of maps passed for number of turns as Game moves its maps with interval passed, player entering the next
+//map every visitTurns turns. Map player is in moves every turn, the others skip turns and are caught up every interval
+//turns, offset by map index (never if interval is 0), or when player enters. Returns seconds taken and writes slowest
+//turn.
+static double runLodTurns(std::vector <BenchMap*>& inputMaps, int turns, unsigned interval, ThreadPool& pool,
+                          double& outputSlowest) {
+    const int visitTurns = 50;
+    outputSlowest = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        std::chrono::steady_clock::time_point turnStart = std::chrono::steady_clock::now();
+        const unsigned current = static_cast<unsigned>(turn / visitTurns) % inputMaps.size();
+
+        //Player entering a map sees it caught up
+        inputMaps[current]->catchUp();
+
+        for (unsigned mapIndex = 0; mapIndex < inputMaps.size(); mapIndex++) {
+            if (mapIndex != current) {
+                inputMaps[mapIndex]->skipTurn();
+            }
+        }
+
+        pool.run(static_cast<unsigned>(inputMaps.size()), [&inputMaps, current, interval](unsigned mapIndex) {
+            if (mapIndex == current) {
+                inputMaps[mapIndex]->moveZombies();
+            }
+            else if (interval > 0 && (inputMaps[mapIndex]->getSkippedTurns() + mapIndex) % interval == 0) {
+                inputMaps[mapIndex]->catchUp();
+            }
+        });
+
+        outputSlowest = std::max(outputSlowest, elapsedSeconds(turnStart));
+    }
+
+    return elapsedSeconds(start);
+}
+
+//Run level of detail benchmark for number of maps, zombies per map, turns and interval passed. Outputs turns per second
+//and slowest turn moving every map every turn, catching maps player is not in up every interval turns and only when
+//player enters them.
+static void benchLod(int mapCount, int count, int turns, unsigned interval) {
+    const int size = 256;
+    const unsigned intervals[3] = {1, interval, 0};
+    const char* labels[3] = {"every map every turn", "caught up every ", "caught up on entry  "};
+    Random random(1);
+    ThreadPool pool(ThreadPool::defaultWorkers());
+    uint64_t firstCells = 0;
+
+    std::cout << std::fixed << std::setprecision(3) << mapCount << " maps of " << size << "x" << size << ", " << count
+              << " zombies each, " << turns << " turns, " << pool.getThreadCount() << " threads" << std::endl;
+
+    for (unsigned run = 0; run < 3; run++) {
+        //Same world each run, each map named apart so that its zombies draw from their own streams
+        std::vector <BenchMap*> maps;
+        for (int mapIndex = 0; mapIndex < mapCount; mapIndex++) {
+            maps.push_back(new BenchMap(size, size, &random, "bench " + std::to_string(mapIndex)));
+            maps.back()->scatterZombies(count);
+        }
+
+        double slowest = 0;
+        const double seconds = runLodTurns(maps, turns, intervals[run], pool, slowest);
+
+        //Catch every map up, then all runs must have every zombie in same cell
+        uint64_t cells = 0;
+        for (int mapIndex = 0; mapIndex < mapCount; mapIndex++) {
+            maps[mapIndex]->catchUp();
+            cells = Random::mix(cells + maps[mapIndex]->zombieCells());
+            delete maps[mapIndex];
+        }
+        if (run == 0) {
+            firstCells = cells;
+        }
+
+        std::cout << "  " << labels[run];
+        if (run == 1) {
+            std::cout << std::setw(4) << std::left << intervals[run] << std::right;
+        }
+        std::cout << " " << turns / seconds << " turns/s, slowest turn " << slowest * 1e3 << " ms"
+                  << ((cells == firstCells) ? "" : " (final cells DIFFER)") << std::endl;
+    }
+}
+
+//Run horde benchmark for map size, number of zombies, turns and threads passed. Outputs millions of zombie steps per
+//second moving zombies in order, in two phases on calling thread and in two phases on a ThreadPool.
+static void benchHorde(int size, int count, int turns, unsigned threads) {
+    Random random(1);
+    ThreadPool pool(threads - 1);
+    const double steps = static_cast<double>(count) * turns * 1e-6;
+
+    std::cout << std::fixed << std::setprecision(3) << size << "x" << size << ", " << count << " zombies, " << turns
+              << " turns, " << pool.getThreadCount() << " threads" << std::endl;
+
+    //Same horde three times
+    BenchMap orderedMap(size, size, &random);
+    BenchMap phasedMap(size, size, &random);
+    BenchMap pooledMap(size, size, &random);
+    orderedMap.scatterZombies(count);
+    phasedMap.scatterZombies(count);
+    pooledMap.scatterZombies(count);
+    phasedMap.setMoveMode(MOVE_TWO_PHASE);
+    pooledMap.setMoveMode(MOVE_TWO_PHASE);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        orderedMap.moveZombies();
+    }
+    double orderedSeconds = elapsedSeconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        phasedMap.moveZombies();
+    }
+    double phasedSeconds = elapsedSeconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        pooledMap.moveZombies(&pool);
+    }
+    double pooledSeconds = elapsedSeconds(start);
+
+    std::cout << "  in order             " << steps / orderedSeconds << " M steps/s" << std::endl;
+    std::cout << "  two phase, 1 thread  " << steps / phasedSeconds << " M steps/s" << std::endl;
+    std::cout << "  two phase, pool      " << steps / pooledSeconds << " M steps/s" << std::endl;
+    std::cout << "  two phase final cells " << ((phasedMap.zombieCells() == pooledMap.zombieCells()) ? "match" :
+                                                "DIFFER") << std::endl;
+}
+
+//Run chase benchmark for map size, chase radius and turns passed. For each number of zombies, outputs nanoseconds per
+//zombie per turn wandering and chasing a player that moves every turn, then time of one flow field build alone.
+static void benchChase(int size, int radius, int turns) {
+    const int counts[3] = {1000, 10000, 100000};
+    Random random(1);
+
+    std::cout << std::fixed << std::setprecision(3) << size << "x" << size << ", chase radius " << radius << ", "
+              << turns << " turns" << std::endl;
+
+    for (int countIndex = 0; countIndex < 3; countIndex++) {
+        //Small maps hold fewer zombies than asked for, so times are per zombie placed
+        int placed = 0;
+        double seconds[2];
+
+        //Same zombies wandering, then chasing, with player stepping between two cells in middle of map
+        for (int chase = 0; chase < 2; chase++) {
+            BenchMap map(size, size, &random);
+            Player player(size / 2, size / 2);
+            map.placePlayer(&player, size / 2, size / 2);
+            placed = map.scatterZombies(counts[countIndex]);
+            map.setChaseRadius(chase ? radius : 0);
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int turn = 0; turn < turns; turn++) {
+                map.placePlayer(&player, size / 2, size / 2 + turn % 2);
+                map.moveZombies();
+                player.setAlive(true);
+            }
+            seconds[chase] = elapsedSeconds(start);
+        }
+
+        const double zombieTurns = static_cast<double>(placed) * turns * 1e-9;
+        std::cout << "  " << std::setw(6) << placed << " zombies  wander "
+                  << seconds[0] / zombieTurns << " ns/zombie  chase " << seconds[1] / zombieTurns << " ns/zombie"
+                  << std::endl;
+    }
+
+    //Field build alone, on an empty map of same size
+    BenchMap map(size, size, &random);
+    Player player(size / 2, size / 2);
+    map.placePlayer(&player, size / 2, size / 2);
+    map.setChaseRadius(radius);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        map.placePlayer(&player, size / 2, size / 2 + turn % 2);
+        map.buildChaseField();
+    }
+    std::cout << "  one field build      " << elapsedSeconds(start) / turns * 1e6 << " us" << std::endl;
+}
+
+//Run pathfinding benchmark for number of store tiles, searches, zombies and turns passed. Outputs microseconds per
+//search for A* and jump point search on the tiled grocery store layout, then cost of moving zombies to a shared goal
+//with the path cache against a full search per zombie per turn.
+static void benchPath(int tiles, int searchCount, int count, int turns) {
+    Random random(1);
+    GroceryStore store("bench store", &random);
+    const int size[2] = {(store.getRows() - 2) * tiles + 2, (store.getCols() - 2) * tiles + 2};
+    BenchMap map(size[0], size[1], &random);
+    map.tileLayout(store, tiles);
+
+    std::cout << std::fixed << std::setprecision(3) << "grocery store tiled " << tiles << "x" << tiles << ", "
+              << size[0] << "x" << size[1] << std::endl;
+
+    //Random pairs of floor cells, drawn from a stream of their own
+    std::vector <int> starts;
+    std::vector <int> goals;
+    uint64_t draw = 0;
+    while (static_cast<int>(starts.size()) < searchCount) {
+        const int startRow = random.randomInt(1, draw++, 1, size[0] - 2);
+        const int startCol = random.randomInt(1, draw++, 1, size[1] - 2);
+        const int goalRow = random.randomInt(1, draw++, 1, size[0] - 2);
+        const int goalCol = random.randomInt(1, draw++, 1, size[1] - 2);
+
+        if (map.isFloor(startRow, startCol) && map.isFloor(goalRow, goalCol)) {
+            starts.push_back(startRow * size[1] + startCol);
+            goals.push_back(goalRow * size[1] + goalCol);
+        }
+    }
+
+    //Same searches by A* and by jump point search
+    std::vector <unsigned> lengths[2];
+    double seconds[2];
+    std::vector <int> path;
+    for (int jump = 0; jump < 2; jump++) {
+        map.getPathfinder().setJumpSearch(jump != 0);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int search = 0; search < searchCount; search++) {
+            map.findPath(starts[search] / size[1], starts[search] % size[1], goals[search] / size[1],
+                         goals[search] % size[1], path);
+            lengths[jump].push_back(static_cast<unsigned>(path.size()));
+        }
+        seconds[jump] = elapsedSeconds(start);
+    }
+
+    std::cout << "  A*                   " << seconds[0] / searchCount * 1e6 << " us/search" << std::endl;
+    std::cout << "  jump point search    " << seconds[1] / searchCount * 1e6 << " us/search" << std::endl;
+    std::cout << "  path lengths " << ((lengths[0] == lengths[1]) ? "match" : "DIFFER") << std::endl;
+
+    //Zombies scattered over map all head for far corner
+    map.scatterZombies(count);
+    map.setGoals(size[0] - 2, size[1] - 2);
+
+    //One full search per zombie, as finding each zombie's next step without a cache would take every turn
+    std::vector <int> zombieTiles = map.zombieTiles();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned zombie = 0; zombie < zombieTiles.size(); zombie++) {
+        map.findPath(zombieTiles[zombie] / size[1], zombieTiles[zombie] % size[1], size[0] - 2, size[1] - 2, path);
+    }
+    const double uncachedSeconds = elapsedSeconds(start) / zombieTiles.size();
+
+    const unsigned long long searchesBefore = map.getPathfinder().getSearches();
+    start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        map.moveZombies();
+    }
+    const double cachedSeconds = elapsedSeconds(start) / (static_cast<double>(count) * turns);
+
+    std::cout << "  " << count << " zombies to one goal, " << turns << " turns" << std::endl;
+    std::cout << "  search every turn    " << uncachedSeconds * 1e6 << " us/zombie/turn" << std::endl;
+    std::cout << "  path cache           " << cachedSeconds * 1e6 << " us/zombie/turn, "
+              << map.getPathfinder().getSearches() - searchesBefore << " full searches, "
+              << map.getPathfinder().getCacheHits() << " cached steps" << std::endl;
+}
+
+//Run attack and radius query benchmark for map size and radius passed. For each number of zombies, outputs nanoseconds
+//per check for zombies next to player and per radius query, each the original way (every zombie) and through the map
+//grid index.
+static void benchAttack(int size, int radius) {
+    Random random(1);
+
+    std::cout << std::fixed << std::setprecision(3) << size << "x" << size << ", radius " << radius << std::endl;
+
+    for (int count = 1000; count <= 1000000 && count < size * size / 4; count *= 10) {
+        BenchMap map(size, size, &random);
+        Player player(size / 2, size / 2);
+        map.placePlayer(&player, size / 2, size / 2);
+        map.scatterZombies(count);
+
+        //Repeat so that each measurement covers roughly the same number of zombies looked at
+        const int repeats = std::max(10, 100000000 / count);
+        volatile int sink = 0;
+        std::vector <unsigned> near;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < repeats; repeat++) {
+            sink = sink + map.replicaNeighbors(&player);
+        }
+        const double replicaSeconds = elapsedSeconds(start) / repeats;
+
+        //Player has no knife, so checks only mark player dead and leave zombies as they are
+        start = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < repeats; repeat++) {
+            map.checkZombies(&player);
+        }
+        const double checkSeconds = elapsedSeconds(start) / repeats;
+
+        int scanned = 0;
+        start = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < repeats; repeat++) {
+            scanned = map.scanNear(size / 2, size / 2, radius);
+        }
+        const double scanSeconds = elapsedSeconds(start) / repeats;
+
+        start = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < repeats; repeat++) {
+            map.zombiesNear(size / 2, size / 2, radius, near);
+        }
+        const double nearSeconds = elapsedSeconds(start) / repeats;
+
+        std::cout << "  " << std::setw(7) << count << " zombies  attack check: every zombie " << replicaSeconds * 1e9
+                  << " ns, grid " << checkSeconds * 1e9 << " ns  radius query: every zombie " << scanSeconds * 1e9
+                  << " ns, grid " << nearSeconds * 1e9 << " ns" << ((static_cast<int>(near.size()) == scanned) ?
+                  "" : " (counts DIFFER)") << std::endl;
+    }
+}
+
+//Run zombie death benchmark for map size and number of zombies passed. For every zombie, every other zombie and every
+//tenth zombie dying in one turn, outputs time to remove them the original way (erased from the middle of the vector)
+//and by Map, and checks handles taken before deaths.
+static void benchDeaths(int size, int count) {
+    Random random(1);
+    const unsigned steps[3] = {1, 2, 10};
+
+    std::cout << std::fixed << std::setprecision(3) << count << " zombies on " << size << "x" << size << std::endl;
+
+    for (unsigned step = 0; step < 3; step++) {
+        BenchMap map(size, size, &random);
+        map.scatterZombies(count);
+
+        //Handle and cell of every zombie before deaths
+        std::vector <ZombieHandle> handles;
+        std::vector <std::pair<int, int> > cells;
+        for (unsigned zombie = 0; zombie < map.zombieCount(); zombie++) {
+            handles.push_back(map.getZombieHandle(zombie));
+            cells.push_back(std::make_pair(map.replicaZombies[zombie]->getRows(),
+                                           map.replicaZombies[zombie]->getCols()));
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        map.eraseReplicaZombies(steps[step]);
+        const double replicaSeconds = elapsedSeconds(start);
+
+        start = std::chrono::steady_clock::now();
+        map.killZombies(steps[step]);
+        const double mapSeconds = elapsedSeconds(start);
+
+        //Dead zombies must be stale, survivors found in the cell they were in
+        bool handlesMatch = (map.zombieCount() == map.replicaZombies.size());
+        for (unsigned zombie = 0; zombie < handles.size(); zombie++) {
+            const int index = map.findZombie(handles[zombie]);
+
+            if (zombie % steps[step] == 0) {
+                handlesMatch = handlesMatch && (index == -1);
+            }
+            else {
+                handlesMatch = handlesMatch && (index >= 0) &&
+                               map.zombieAt(static_cast<unsigned>(index), cells[zombie].first, cells[zombie].second);
+            }
+        }
+
+        std::cout << "  " << std::setw(7) << (count + steps[step] - 1) / steps[step] << " die  erase from vector "
+                  << replicaSeconds * 1e3 << " ms, kill and remove " << mapSeconds * 1e3 << " ms"
+                  << (handlesMatch ? "" : " (handles DIFFER)") << std::endl;
+    }
+}
+
+//Run line of sight benchmark for number of store tiles, sight radius and number of zombies passed. Outputs nanoseconds
+//per zombie in sight radius checked by a ray and by the cached view, and microseconds to cast a view.
+static void benchSight(int tiles, int radius, int count) {
+    Random random(1);
+    GroceryStore store("bench store", &random);
+    const int size[2] = {(store.getRows() - 2) * tiles + 2, (store.getCols() - 2) * tiles + 2};
+    BenchMap map(size[0], size[1], &random);
+    map.tileLayout(store, tiles);
+    map.scatterZombies(count);
+    map.prepareSight(radius);
+
+    //Round of floor cells player visits, drawn from a stream of their own
+    const int cellCount = 64;
+    const int rounds = 200;
+    std::vector <int> cells;
+    uint64_t draw = 0;
+    while (static_cast<int>(cells.size()) < cellCount) {
+        const int row = random.randomInt(1, draw++, 1, size[0] - 2);
+        const int col = random.randomInt(1, draw++, 1, size[1] - 2);
+
+        if (map.isFloor(row, col)) {
+            cells.push_back(row * size[1] + col);
+        }
+    }
+
+    std::vector <std::vector<unsigned> > nearby(cellCount);
+    unsigned long long checks = 0;
+    for (int cell = 0; cell < cellCount; cell++) {
+        map.zombiesNear(cells[cell] / size[1], cells[cell] % size[1], radius, nearby[cell]);
+        checks += nearby[cell].size();
+    }
+
+    std::cout << std::fixed << std::setprecision(3) << "grocery store tiled " << tiles << "x" << tiles << ", "
+              << size[0] << "x" << size[1] << ", " << count << " zombies, sight radius " << radius << ", "
+              << checks << " zombies in radius of " << cellCount << " player cells" << std::endl;
+
+    //First visit of each cell casts its view
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int cell = 0; cell < cellCount; cell++) {
+        map.getSightTable().viewFrom(cells[cell] / size[1], cells[cell] % size[1]);
+    }
+    const double castSeconds = elapsedSeconds(start) / cellCount;
+
+    unsigned long long seen[2] = {0, 0};
+    double seconds[2];
+    for (int cached = 0; cached < 2; cached++) {
+        start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; round++) {
+            for (int cell = 0; cell < cellCount; cell++) {
+                const int row = cells[cell] / size[1];
+                const int col = cells[cell] % size[1];
+
+                seen[cached] += cached ? map.viewSpotted(row, col, nearby[cell]) :
+                                map.raySpotted(row, col, nearby[cell]);
+            }
+        }
+        seconds[cached] = elapsedSeconds(start) / (static_cast<double>(checks) * rounds);
+    }
+
+    std::cout << "  ray per zombie       " << seconds[0] * 1e9 << " ns/zombie, " << seen[0] / rounds << " seen"
+              << std::endl;
+    std::cout << "  cached view          " << seconds[1] * 1e9 << " ns/zombie, " << seen[1] / rounds << " seen"
+              << std::endl;
+    std::cout << "  view cast            " << castSeconds * 1e6 << " us/view" << std::endl;
+}
+
+//Run noise benchmark for number of store tiles, noises per turn and loudness passed. Outputs microseconds and heap
+//allocations per noise spread each way and whether the merged pass reaches the same cells.
+static void benchNoise(int tiles, int noiseCount, int loudness) {
+    Random random(1);
+    GroceryStore store("bench store", &random);
+    const int size[2] = {(store.getRows() - 2) * tiles + 2, (store.getCols() - 2) * tiles + 2};
+    BenchMap map(size[0], size[1], &random);
+    map.tileLayout(store, tiles);
+
+    //Noises of a turn made at floor cells drawn from a stream of their own
+    const int turns = 200;
+    std::vector <int> sources;
+    uint64_t draw = 0;
+    while (static_cast<int>(sources.size()) < noiseCount) {
+        const int row = random.randomInt(1, draw++, 1, size[0] - 2);
+        const int col = random.randomInt(1, draw++, 1, size[1] - 2);
+
+        if (map.isFloor(row, col)) {
+            sources.push_back(row * size[1] + col);
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(3) << "grocery store tiled " << tiles << "x" << tiles << ", "
+              << size[0] << "x" << size[1] << ", " << noiseCount << " noises of loudness " << loudness
+              << " per turn, " << turns << " turns" << std::endl;
+
+    //Search with arrays of its own for every noise
+    unsigned long long replicaCells = 0;
+    unsigned long long startAllocations = heapAllocations;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        for (int noise = 0; noise < noiseCount; noise++) {
+            replicaCells += map.replicaNoise(sources[noise], loudness);
+        }
+    }
+    const double replicaSeconds = elapsedSeconds(start);
+    const unsigned long long replicaAllocations = heapAllocations - startAllocations;
+
+    //NoiseField pass for every noise, scratch arrays allocated by a first pass outside timing
+    NoiseField field;
+    field.makeNoise(sources[0], loudness);
+    field.spread(map.terrainLayer(), size[0], size[1]);
+
+    unsigned long long separateCells = 0;
+    std::vector <uint32_t> heard(size[0] * size[1], 0);
+    unsigned heardCount = 0;
+    startAllocations = heapAllocations;
+    start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        for (int noise = 0; noise < noiseCount; noise++) {
+            field.makeNoise(sources[noise], loudness);
+            field.spread(map.terrainLayer(), size[0], size[1]);
+            separateCells += field.getReached().size();
+
+            //Cells heard by any noise, counted on first turn only so that it adds little to timing
+            for (unsigned count = 0; turn == 0 && count < field.getReached().size(); count++) {
+                heardCount += (heard[field.getReached()[count]]++ == 0);
+            }
+        }
+    }
+    const double separateSeconds = elapsedSeconds(start);
+    const unsigned long long separateAllocations = heapAllocations - startAllocations;
+
+    //One NoiseField pass for all noises of a turn
+    unsigned long long mergedCells = 0;
+    startAllocations = heapAllocations;
+    start = std::chrono::steady_clock::now();
+    for (int turn = 0; turn < turns; turn++) {
+        for (int noise = 0; noise < noiseCount; noise++) {
+            field.makeNoise(sources[noise], loudness);
+        }
+        field.spread(map.terrainLayer(), size[0], size[1]);
+        mergedCells += field.getReached().size();
+    }
+    const double mergedSeconds = elapsedSeconds(start);
+    const unsigned long long mergedAllocations = heapAllocations - startAllocations;
+
+    const double noises = static_cast<double>(noiseCount) * turns;
+    std::cout << "  search per noise     " << replicaSeconds / noises * 1e6 << " us/noise, "
+              << replicaAllocations / noises << " allocations/noise, " << replicaCells / turns << " cells/turn"
+              << std::endl;
+    std::cout << "  NoiseField per noise " << separateSeconds / noises * 1e6 << " us/noise, "
+              << separateAllocations / noises << " allocations/noise, " << separateCells / turns << " cells/turn"
+              << std::endl;
+    std::cout << "  NoiseField merged    " << mergedSeconds / noises * 1e6 << " us/noise, "
+              << mergedAllocations / noises << " allocations/noise, " << mergedCells / turns << " cells/turn"
+              << std::endl;
+    std::cout << "  merged pass " << ((mergedCells / turns == heardCount) ? "reaches same cells" : "DIFFERS")
+              << std::endl;
+}
+
+//Run snapshot benchmark for map size, number of zombies and number of saves and loads passed. Outputs microseconds
+//per save and load of a map against memcpy of its state as held in memory, then per save and load of a standard game.
+static void benchSnapshot(int size, int count, int repeats) {
+    Random random(1);
+    const double megabyte = 1.0 / 1048576.0;
+
+    std::cout << std::fixed << std::setprecision(3) << size << "x" << size << ", " << count << " zombies" << std::endl;
+
+    //Map saved and map of same size loaded into, scattered zombies give load something to place
+    BenchMap savedMap(size, size, &random);
+    savedMap.scatterZombies(count);
+    BenchMap loadedMap(size, size, &random);
+    Snapshot snapshot;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < repeats; repeat++) {
+        snapshot.clear();
+        savedMap.saveState(snapshot);
+    }
+    double saveSeconds = elapsedSeconds(start);
+
+    bool loaded = true;
+    start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < repeats; repeat++) {
+        snapshot.rewind();
+        loaded = loadedMap.loadState(snapshot) && loaded;
+    }
+    double loadSeconds = elapsedSeconds(start);
+
+    //Terrain byte and occupancy entry per cell, and row, col, direction, moves left, stream, counter and goal of each
+    //zombie, as held in memory. A load can do no better than copying these whole.
+    const std::size_t cells = static_cast<std::size_t>(size) * size;
+    const std::size_t memoryBytes = cells * (1 + sizeof(int)) + count * (5 * sizeof(int) + 2 * sizeof(uint64_t));
+    std::vector <unsigned char> memoryCopy(memoryBytes, 1);
+    std::vector <unsigned char> memoryTarget(memoryBytes, 0);
+    start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < repeats; repeat++) {
+        memoryCopy[repeat % memoryBytes]++;
+        std::memcpy(&memoryTarget[0], &memoryCopy[0], memoryBytes);
+    }
+    double copySeconds = elapsedSeconds(start);
+
+    std::cout << "  Map::saveState     " << saveSeconds / repeats * 1e6 << " us" << std::endl;
+    std::cout << "  Map::loadState     " << loadSeconds / repeats * 1e6 << " us" << std::endl;
+    std::cout << "  memcpy of state    " << copySeconds / repeats * 1e6 << " us" << std::endl;
+    std::cout << "  snapshot " << snapshot.getData().size() * megabyte << " MB against " << memoryBytes * megabyte
+              << " MB in memory" << std::endl;
+    std::cout << "  loaded map " << ((loaded && loadedMap.stateHash() == savedMap.stateHash()) ? "matches" : "DIFFERS")
+              << std::endl;
+    (void)memoryTarget[repeats % memoryBytes];
+
+    //Whole standard game, as saved to and loaded from a save file
+    Game game(1, 0, 0, 0, 0);
+    const int gameRepeats = repeats * 100;
+    start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < gameRepeats; repeat++) {
+        snapshot.clear();
+        game.saveState(snapshot);
+    }
+    saveSeconds = elapsedSeconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < gameRepeats; repeat++) {
+        snapshot.rewind();
+        loaded = game.loadState(snapshot) && loaded;
+    }
+    loadSeconds = elapsedSeconds(start);
+
+    std::cout << "standard game, " << snapshot.getData().size() << " bytes" << std::endl;
+    std::cout << "  Game::saveState    " << saveSeconds / gameRepeats * 1e6 << " us" << std::endl;
+    std::cout << "  Game::loadState    " << loadSeconds / gameRepeats * 1e6 << " us" << std::endl;
+}
+
+//Agent that takes moves of a fixed list one per action, then exits game, so that a game is left a few turns in
+class WalkAgent : public Agent {
+private:
+    std::string moves;
+    unsigned next;
+
+public:
+    //Constructor takes list of move selections (W, S, A, D) to take
+    explicit WalkAgent(const std::string& inputMoves) : moves(inputMoves), next(0) {}
+
+    //Start list again for each game
+    void startGame(uint64_t) {
+        next = 0;
+    }
+
+    //Return next move of list, or Q once list is used up
+    AgentAction chooseAction(Map*, Player*) {
+        AgentAction action = {(next < moves.size()) ? moves[next] : 'Q', 0, 0};
+        next++;
+
+        return action;
+    }
+};
+
+//Run clone benchmark for game passed, described by label passed, and number of copies passed. Outputs heap allocations
+//and microseconds per copy for Game::clone, Game::copyFrom into a game of the same scenario and a snapshot round trip.
+static void benchClone(Game& inputGame, const std::string& inputLabel, Game& inputTarget, int copies) {
+    const uint64_t hash = inputGame.stateHash();
+    bool matches = true;
+
+    std::cout << std::fixed << std::setprecision(3) << inputLabel << std::endl;
+
+    unsigned long long startAllocations = heapAllocations;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int count = 0; count < copies; count++) {
+        Game* copy = inputGame.clone();
+        matches = matches && copy->stateHash() == hash;
+        delete copy;
+    }
+    double cloneSeconds = elapsedSeconds(start);
+    unsigned long long cloneAllocations = heapAllocations - startAllocations;
+
+    //First copy may still grow arrays of target, so it is made before measuring
+    inputTarget.copyFrom(inputGame);
+    startAllocations = heapAllocations;
+    start = std::chrono::steady_clock::now();
+    for (int count = 0; count < copies; count++) {
+        inputTarget.copyFrom(inputGame);
+    }
+    double copySeconds = elapsedSeconds(start);
+    unsigned long long copyAllocations = heapAllocations - startAllocations;
+    matches = matches && inputTarget.stateHash() == hash;
+
+    Snapshot snapshot;
+    startAllocations = heapAllocations;
+    start = std::chrono::steady_clock::now();
+    for (int count = 0; count < copies; count++) {
+        snapshot.clear();
+        inputGame.saveState(snapshot);
+        inputTarget.loadState(snapshot);
+    }
+    double snapshotSeconds = elapsedSeconds(start);
+    unsigned long long snapshotAllocations = heapAllocations - startAllocations;
+    matches = matches && inputTarget.stateHash() == hash;
+
+    std::cout << "  Game::clone         " << static_cast<double>(cloneAllocations) / copies << " allocations, "
+              << cloneSeconds / copies * 1e6 << " us per copy" << std::endl;
+    std::cout << "  Game::copyFrom      " << static_cast<double>(copyAllocations) / copies << " allocations, "
+              << copySeconds / copies * 1e6 << " us per copy" << std::endl;
+    std::cout << "  save + load         " << static_cast<double>(snapshotAllocations) / copies << " allocations, "
+              << snapshotSeconds / copies * 1e6 << " us per copy" << std::endl;
+    std::cout << "  copies " << (matches ? "match" : "DIFFER") << std::endl;
+}
+
+//Select benchmark from command line arguments and run it
+int main(int argc, char* argv[]) {
+    std::string benchName = (argc > 1) ? argv[1] : "grid";
+
+    if (benchName == "grid") {
+        std::vector <int> sizes;
+        for (int count = 2; count < argc; count++) {
+            sizes.push_back(std::atoi(argv[count]));
+        }
+
+        //Default sizes
+        if (sizes.empty()) {
+            sizes.push_back(20);
+            sizes.push_back(1000);
+            sizes.push_back(10000);
+        }
+
+        for (unsigned count = 0; count < sizes.size(); count++) {
+            benchGrid(sizes[count]);
+        }
+    }
+    else if (benchName == "reset") {
+        benchReset((argc > 2) ? std::atoi(argv[2]) : 1000);
+    }
+    else if (benchName == "rng") {
+        benchRng((argc > 2) ? std::atoi(argv[2]) : 1000000);
+    }
+    else if (benchName == "zombies") {
+        benchZombies((argc > 2) ? std::atoi(argv[2]) : 1000, (argc > 3) ? std::atoi(argv[3]) : 100000,
+                     (argc > 4) ? std::atoi(argv[4]) : 100);
+    }
+    else if (benchName == "tick") {
+        benchTick((argc > 2) ? std::atoi(argv[2]) : 32, (argc > 3) ? std::atoi(argv[3]) : 5000,
+                  (argc > 4) ? std::atoi(argv[4]) : 100,
+                  (argc > 5) ? std::atoi(argv[5]) : ThreadPool::defaultWorkers() + 1);
+    }
+    else if (benchName == "lod") {
+        benchLod((argc > 2) ? std::atoi(argv[2]) : 32, (argc > 3) ? std::atoi(argv[3]) : 5000,
+                 (argc > 4) ? std::atoi(argv[4]) : 400, (argc > 5) ? std::atoi(argv[5]) : Game::defaultLodInterval);
+    }
+    else if (benchName == "horde") {
+        benchHorde((argc > 2) ? std::atoi(argv[2]) : 1000, (argc > 3) ? std::atoi(argv[3]) : 200000,
+                   (argc > 4) ? std::atoi(argv[4]) : 50,
+                   (argc > 5) ? std::atoi(argv[5]) : ThreadPool::defaultWorkers() + 1);
+    }
+    else if (benchName == "chase") {
+        benchChase((argc > 2) ? std::atoi(argv[2]) : 1000, (argc > 3) ? std::atoi(argv[3]) : 64,
+                   (argc > 4) ? std::atoi(argv[4]) : 100);
+    }
+    else if (benchName == "path") {
+        benchPath((argc > 2) ? std::atoi(argv[2]) : 10, (argc > 3) ? std::atoi(argv[3]) : 200,
+                  (argc > 4) ? std::atoi(argv[4]) : 2000, (argc > 5) ? std::atoi(argv[5]) : 200);
+    }
+    else if (benchName == "attack") {
+        benchAttack((argc > 2) ? std::atoi(argv[2]) : 2000, (argc > 3) ? std::atoi(argv[3]) : 8);
+    }
+    else if (benchName == "deaths") {
+        benchDeaths((argc > 2) ? std::atoi(argv[2]) : 1000, (argc > 3) ? std::atoi(argv[3]) : 100000);
+    }
+    else if (benchName == "noise") {
+        benchNoise((argc > 2) ? std::atoi(argv[2]) : 10, (argc > 3) ? std::atoi(argv[3]) : 64,
+                   (argc > 4) ? std::atoi(argv[4]) : NOISE_DOOR);
+    }
+    else if (benchName == "sight") {
+        benchSight((argc > 2) ? std::atoi(argv[2]) : 10, (argc > 3) ? std::atoi(argv[3]) : 10,
+                   (argc > 4) ? std::atoi(argv[4]) : 20000);
+    }
+    else if (benchName == "snapshot") {
+        benchSnapshot((argc > 2) ? std::atoi(argv[2]) : 2000, (argc > 3) ? std::atoi(argv[3]) : 100000,
+                      (argc > 4) ? std::atoi(argv[4]) : 20);
+    }
+    else if (benchName == "clone") {
+        const int size = (argc > 2) ? std::atoi(argv[2]) : 500;
+        const int count = (argc > 3) ? std::atoi(argv[3]) : 20000;
+        const int copies = (argc > 4) ? std::atoi(argv[4]) : 1000;
+
+        //Games are copied a few turns in, with zombies moved and player off its starting cell
+        std::streambuf* screen = std::cout.rdbuf(nullptr);
+        Game game(1, 0, 0, 0, 0);
+        Game target(2, 0, 0, 0, 0);
+        Game scenario(1, size, size, count, 0);
+        Game scenarioTarget(2, size, size, count, 0);
+        WalkAgent walk("DDWWDD");
+        game.setRender(false);
+        scenario.setRender(false);
+        game.playAgent(walk, nullptr);
+        scenario.playAgent(walk, nullptr);
+        std::cout.rdbuf(screen);
+
+        benchClone(game, "standard game", target, copies);
+        benchClone(scenario, "scenario game, outdoors " + std::to_string(size) + "x" + std::to_string(size) + " with " +
+                   std::to_string(count) + " zombies", scenarioTarget, std::max(1, copies / 100));
+    }
+    else {
+        std::cout << "Usage: Benchmark.bin grid [sizes...]" << std::endl;
+        std::cout << "       Benchmark.bin reset [count]" << std::endl;
+        std::cout << "       Benchmark.bin rng [count]" << std::endl;
+        std::cout << "       Benchmark.bin zombies [size] [count] [turns]" << std::endl;
+        std::cout << "       Benchmark.bin tick [maps] [zombies] [turns] [threads]" << std::endl;
+        std::cout << "       Benchmark.bin lod [maps] [zombies] [turns] [interval]" << std::endl;
+        std::cout << "       Benchmark.bin horde [size] [zombies] [turns] [threads]" << std::endl;
+        std::cout << "       Benchmark.bin chase [size] [radius] [turns]" << std::endl;
+        std::cout << "       Benchmark.bin path [tiles] [searches] [zombies] [turns]" << std::endl;
+        std::cout << "       Benchmark.bin attack [size] [radius]" << std::endl;
+        std::cout << "       Benchmark.bin deaths [size] [zombies]" << std::endl;
+        std::cout << "       Benchmark.bin sight [tiles] [radius] [zombies]" << std::endl;
+        std::cout << "       Benchmark.bin noise [tiles] [noises] [loudness]" << std::endl;
+        std::cout << "       Benchmark.bin snapshot [size] [zombies] [count]" << std::endl;
+        std::cout << "       Benchmark.bin clone [size] [zombies] [count]" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
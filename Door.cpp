@@ -7,37 +7,42 @@
  * Variables: doorClosedVisual: Closed door visualization by char
  * doorClosedSolid: Door is set to solid by default for closed door.
  * interactable: Door is set to true for being interactable to open/close object.
- * isLocked: Door is set to false initially for isLocked for unlocked doors, but can be changed.
- * Functions: Door Constructor initialized through Space class and takes three paramaters. One string for
- * the map name that the door is in, and two int values for the row/column that door is in on map.
+ * doorMap: Map that door is placed in, told when door opens or closes so that zombie chase paths stay current.
+ * Functions: Door Constructor initialized through Space class and takes three paramaters. One MapId for
+ * the map that the door is in, and two int values for the row/column that door is in on map.
  * Door destructor is default destructor properties.
- * openDoor - Opens door and sets visualization/door properties to allow player to travel through them.
+ * openDoor - Opens door and sets visualization/door properties to allow player to travel through them. Opening a door
+ * makes a noise in its map.
  * closeDoor - Closes door and sets visualization/door properties to make object solid in game.
- * getLocked - Returns boolean value for whether or not door is locked.
- * setLocked - Takes boolean value as parameter and sets locked status of door.
+ * setMap - Set Map that door is placed in, set by Map when door is added to it.
+ * getLocked - Returns boolean value for whether or not door is locked, read from DoorState of door.
+ * setLocked - Takes boolean value as parameter and sets DoorState of door to locked or closed.
+ * restoreState - Set door closed, locked or open as loaded from a save, without a noise or telling its map.
  * interactObject - Overridden function from abstract Space class. Takes Space pointer (although not used in
  * this class and checks whether door is open, closed, or locked and performs actions to open or close door and
  * inform user if door is locked.
 */
 
 #include "Door.hpp"
+#include "Map.hpp"
 
 //ExitPoint default constructor for door Spaces
-Door::Door(std::string inputMapName, int inputRow, int inputCol) : Space("closed door", doorClosedVisual,
-        doorClosedSolid, interactable) {
-    mapName = inputMapName;
+Door::Door(MapId inputMapId, int inputRow, int inputCol) : Space(KIND_DOOR, doorClosedVisual, doorClosedSolid,
+        interactable) {
+    mapId = inputMapId;
 
     //Set rows and columns of door objects
     row = inputRow;
     col = inputCol;
 
-    isLocked = false;
+    //Door is not in a map until added to one
+    doorMap = nullptr;
 }
 
 //Default destructor for door object
 Door::~Door() {}
 
-//Open door - set visual to open and space to passable
+//Open door - set visual to open and space to passable. Makes a noise in map door is in.
 void Door::openDoor() {
     //ExitPoint set to passable
     setSolid(false);
@@ -45,8 +50,14 @@ void Door::openDoor() {
     //Change door visual to open
     setVisual('/');
 
-    //Set door string description to open
-    setName("open door");
+    //Set door state to open
+    setDoorState(DOOR_OPEN);
+
+    //Let map know door changed, and let zombies of map hear it open
+    if (doorMap != nullptr) {
+        doorMap->tileChanged(row, col);
+        doorMap->makeNoise(row, col, NOISE_DOOR);
+    }
 }
 
 //Close door - set visual to closed and space to solid
@@ -57,8 +68,18 @@ void Door::closeDoor() {
     //Change door visual to closed
     setVisual('|');
 
-    //Set door string description to closed
-    setName("closed door");
+    //Set door state to closed
+    setDoorState(DOOR_CLOSED);
+
+    //Let map know door changed
+    if (doorMap != nullptr) {
+        doorMap->tileChanged(row, col);
+    }
+}
+
+//Set Map that door is placed in, set by Map when door is added to it
+void Door::setMap(Map* inputMap) {
+    doorMap = inputMap;
 }
 
 //Door object interaction - If interaction is available for object, perform interaction. This is abstract virtual
@@ -67,14 +88,14 @@ void Door::closeDoor() {
 void Door::interactObject(Space *inputSpace) {
 
     //If door is closed (whether locked or just closed) output same message.
-    if (this->getName() == "closed door" || this->getName() == "locked door") {
+    if (doorState == DOOR_CLOSED || doorState == DOOR_LOCKED) {
         std::cout << "You see a closed door and reach for the handle." << std::endl;
     }
 
     //If door is open, output that door is open instead.
     else {
         //If this is an open alley, output message informing user of such.
-        if (this->getName() == "open space") {
+        if (doorState == DOOR_OPEN_SPACE) {
             std::cout << "You reached an open corridor, you may freely pass through." << std::endl;
         }
         //This is a door and you reach for handle
@@ -85,7 +106,7 @@ void Door::interactObject(Space *inputSpace) {
 
     //If door is interactable, perform opening or closing action unless it is locked, display message informing user
     //If the door is locked, inform user that key is needed
-    if (this->isLocked) {
+    if (doorState == DOOR_LOCKED) {
         std::cout << "The door is locked, you must have a key to enter!" << std::endl;
     }
 
@@ -93,7 +114,7 @@ void Door::interactObject(Space *inputSpace) {
     else if (this->getInteract()) {
         //Set door to open or closed based on current status
         //If door is closed, open it.
-        if (this->getVisual() == '|') {
+        if (doorState == DOOR_CLOSED) {
             openDoor();
             std::cout << "You pull the door open." << std::endl;
         }
@@ -109,10 +130,24 @@ void Door::interactObject(Space *inputSpace) {
 
 //Return boolean value of whether door is locked or not
 bool Door::getLocked() {
-    return isLocked;
+    return doorState == DOOR_LOCKED;
 }
 
 //Set boolean value of whether door is locked or not
 void Door::setLocked(bool inputLocked) {
-    isLocked = inputLocked;
+    setDoorState(inputLocked ? DOOR_LOCKED : DOOR_CLOSED);
+}
+
+//Set door closed, locked or open (DOOR_CLOSED, DOOR_LOCKED or DOOR_OPEN) as loaded from a save, with the visualization
+//and solidity of that state. No noise is made and map is not told, as map loading it drops what it has worked out
+//from its tiles once all are loaded. Open corridors (DOOR_OPEN_SPACE) never change and are left.
+void Door::restoreState(DoorState inputState) {
+    if (doorState == DOOR_OPEN_SPACE || inputState == DOOR_OPEN_SPACE) {
+        return;
+    }
+
+    const bool open = (inputState == DOOR_OPEN);
+    setSolid(!open);
+    setVisual(open ? '/' : '|');
+    setDoorState(inputState);
 }
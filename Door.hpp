@@ -7,14 +7,17 @@
  * Variables: doorClosedVisual: Closed door visualization by char
  * doorClosedSolid: Door is set to solid by default for closed door.
  * interactable: Door is set to true for being interactable to open/close object.
- * isLocked: Door is set to false initially for isLocked for unlocked doors, but can be changed.
- * Functions: Door Constructor initialized through Space class and takes three paramaters. One string for
- * the map name that the door is in, and two int values for the row/column that door is in on map.
+ * doorMap: Map that door is placed in, told when door opens or closes so that zombie chase paths stay current.
+ * Functions: Door Constructor initialized through Space class and takes three paramaters. One MapId for
+ * the map that the door is in, and two int values for the row/column that door is in on map.
  * Door destructor is default destructor properties.
- * openDoor - Opens door and sets visualization/door properties to allow player to travel through them.
+ * openDoor - Opens door and sets visualization/door properties to allow player to travel through them. Opening a door
+ * makes a noise in its map.
  * closeDoor - Closes door and sets visualization/door properties to make object solid in game.
- * getLocked - Returns boolean value for whether or not door is locked.
- * setLocked - Takes boolean value as parameter and sets locked status of door.
+ * setMap - Set Map that door is placed in, set by Map when door is added to it.
+ * getLocked - Returns boolean value for whether or not door is locked, read from DoorState of door.
+ * setLocked - Takes boolean value as parameter and sets DoorState of door to locked or closed.
+ * restoreState - Set door closed, locked or open as loaded from a save, without a noise or telling its map.
  * interactObject - Overridden function from abstract Space class. Takes Space pointer (although not used in
  * this class and checks whether door is open, closed, or locked and performs actions to open or close door and
  * inform user if door is locked.
@@ -25,6 +28,8 @@
 
 #include "Space.hpp"
 
+class Map;
+
 class Door : public Space {
 private:
     //Map output visualization
@@ -33,27 +38,36 @@ private:
     static const bool doorClosedSolid = true,
                       interactable = true;
 
-    bool isLocked = false;
+    //Map that door is placed in, nullptr until added to one
+    Map* doorMap;
 
 public:
     //ExitPoint default constructor for door Spaces
-    Door(std::string, int, int);
+    Door(MapId, int, int);
 
     //Default destructor for door object
     ~Door();
 
-    //Open door - set visual to open and space to passable
+    //Open door - set visual to open and space to passable. Makes a noise in map door is in.
     void openDoor();
 
     //Close door - set visual to closed and space to solid
     void closeDoor();
 
+    //Set Map that door is placed in, set by Map when door is added to it
+    void setMap(Map*);
+
     //Return boolean value of whether door is locked or not
     bool getLocked();
 
     //Set boolean value of whether door is locked or not
     void setLocked(bool);
 
+    //Set door closed, locked or open (DOOR_CLOSED, DOOR_LOCKED or DOOR_OPEN) as loaded from a save, with the
+    //visualization and solidity of that state. No noise is made and map is not told, as map loading it drops what it
+    //has worked out from its tiles once all are loaded. Open corridors (DOOR_OPEN_SPACE) never change and are left.
+    void restoreState(DoorState);
+
     //ExitPoint object interaction - If interaction is available for object, perform interaction. This is abstract virtual
     //function for all Space type objects. Non-interactable objects describe what is seen while interactable objects
     //perform action if possible
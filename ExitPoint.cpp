@@ -20,7 +20,7 @@
 #include "ExitPoint.hpp"
 
 //ExitPoint default constructor for door Spaces
-ExitPoint::ExitPoint(int inputRow, int inputCol) : Space("exit point", doorClosedVisual, exitPtSolid, interactable) {
+ExitPoint::ExitPoint(int inputRow, int inputCol) : Space(KIND_EXIT_POINT, doorClosedVisual, exitPtSolid, interactable) {
     row = inputRow;
     col = inputCol;
 
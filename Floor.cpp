@@ -16,7 +16,7 @@
 #include "Floor.hpp"
 
 //Default constructor for wall object.
-Floor::Floor() : Space ("floor", floorVisual, floorSolid, interactable) {}
+Floor::Floor() : Space (KIND_FLOOR, floorVisual, floorSolid, interactable) {}
 
 //Default destructor for wall object
 Floor::~Floor() {}
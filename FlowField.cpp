@@ -0,0 +1,148 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: FlowField class holds the walking distance from the player to every floor cell of a map within a chase
+ * radius, shared by all zombies of the map. A zombie that chases steps toward the neighbor cell closest to the player,
+ * so each zombie only reads four distances per turn and the cost of chasing does not grow with the number of zombies.
+ * The field is built by one breadth first search from the player bounded by the chase radius, so building it costs
+ * the area around the player rather than the whole map. Cells are stamped with the build they were reached in instead
+ * of being cleared, so cells outside the field need no work at all. The field is only built again when the player
+ * has moved or when a cell changes between passable and blocked in a way that can change distances in the field:
+ * a cell in the field becoming blocked, or a blocked cell next to the field becoming floor. Door changes, item pick
+ * ups and all other tile changes that do not change passability leave the field as it is.
+ * Variables: distances - Steps from player to each cell, valid only where stamps holds current build. stamps - Build
+ * each cell was last reached in. build - Number of current build. queue - Cells waiting to be searched during a build.
+ * rows/cols - Size of map. radius - Chase radius, cells further away from player are not in field.
+ * sourceRow/sourceCol - Player location field was built from. stale - Set when a tile change may have changed
+ * distances in field.
+ * Functions: Constructor sets up empty field with no chase radius.
+ * setRadius - Set chase radius, field is built again on next use.
+ * getRadius - Return chase radius.
+ * invalidate - Mark field stale so that it is built again on next use.
+ * needsBuild - Return whether field must be built again for player location passed.
+ * buildField - Build field by bounded breadth first search from player location over floor cells of terrain layer.
+ * tileChanged - Mark field stale if passability change of cell passed can change distances in field.
+ * inField - Return whether cell was reached by current build.
+ * chaseDirection - Return direction (1 up, 2 right, 3 down, 4 left) toward player from cell passed, or 0 if cell is
+ * not in field or no neighbor is closer to player.
+*/
+
+#include "FlowField.hpp"
+#include "Space.hpp"
+
+//Constructor sets up empty field with no chase radius
+FlowField::FlowField() {
+    build = 0;
+    rows = 0;
+    cols = 0;
+    radius = 0;
+    sourceRow = -1;
+    sourceCol = -1;
+    stale = true;
+}
+
+//Set chase radius, field is built again on next use. Distances are held in 16 bits, so radius is capped below that.
+void FlowField::setRadius(int inputRadius) {
+    radius = (inputRadius < 0) ? 0 : ((inputRadius > 65534) ? 65534 : inputRadius);
+    stale = true;
+}
+
+//Return chase radius, 0 when zombies do not chase
+int FlowField::getRadius() {
+    return radius;
+}
+
+//Mark field stale so that it is built again on next use, such as after whole terrain layer was replaced
+void FlowField::invalidate() {
+    stale = true;
+}
+
+//Return whether field must be built again for player location passed
+bool FlowField::needsBuild(int playerRow, int playerCol) {
+    return stale || playerRow != sourceRow || playerCol != sourceCol;
+}
+
+//Build field by bounded breadth first search from player location over floor cells of terrain layer (TerrainKind
+//byte per cell in row-major order of map size passed). Player cell itself may be any terrain.
+void FlowField::buildField(const unsigned char* inputTerrain, int inputRows, int inputCols, int playerRow,
+                           int playerCol) {
+    //Stamps only need clearing when map size changed or build number wraps around
+    if (inputRows != rows || inputCols != cols || build == ~0u) {
+        rows = inputRows;
+        cols = inputCols;
+        distances.assign(rows * cols, 0);
+        stamps.assign(rows * cols, 0);
+        build = 0;
+    }
+    build++;
+
+    sourceRow = playerRow;
+    sourceCol = playerCol;
+    stale = false;
+
+    const int source = playerRow * cols + playerCol;
+    stamps[source] = build;
+    distances[source] = 0;
+
+    queue.clear();
+    queue.push_back(source);
+
+    //Search outward from player one ring of cells at a time, stopping at chase radius
+    for (unsigned head = 0; head < queue.size(); head++) {
+        const int index = queue[head];
+        const int distance = distances[index];
+        if (distance >= radius) {
+            continue;
+        }
+
+        const int row = index / cols;
+        const int col = index - row * cols;
+        const int neighbors[4] = {(row > 0) ? index - cols : -1, (col < cols-1) ? index + 1 : -1,
+                                  (row < rows-1) ? index + cols : -1, (col > 0) ? index - 1 : -1};
+
+        for (int count = 0; count < 4; count++) {
+            const int neighbor = neighbors[count];
+            if (neighbor < 0 || stamps[neighbor] == build || inputTerrain[neighbor] != TERRAIN_FLOOR) {
+                continue;
+            }
+
+            stamps[neighbor] = build;
+            distances[neighbor] = static_cast<uint16_t>(distance + 1);
+            queue.push_back(neighbor);
+        }
+    }
+}
+
+//Mark field stale if passability change of cell passed can change distances in field. Takes tileIndex of cell and
+//whether cell is now floor.
+void FlowField::tileChanged(int inputIndex, bool inputPassable) {
+    if (stale || rows == 0) {
+        return;
+    }
+
+    //Player cell is always in field whatever is under player
+    if (inputIndex == sourceRow * cols + sourceCol) {
+        return;
+    }
+
+    //Cell in field that became blocked cuts paths through it
+    if (inField(inputIndex)) {
+        stale = !inputPassable;
+        return;
+    }
+
+    //Cell outside field that became floor opens new paths only if a neighbor in field could still expand into it
+    if (inputPassable) {
+        const int row = inputIndex / cols;
+        const int col = inputIndex - row * cols;
+        const int neighbors[4] = {(row > 0) ? inputIndex - cols : -1, (col < cols-1) ? inputIndex + 1 : -1,
+                                  (row < rows-1) ? inputIndex + cols : -1, (col > 0) ? inputIndex - 1 : -1};
+
+        for (int count = 0; count < 4; count++) {
+            if (neighbors[count] >= 0 && inField(neighbors[count]) && distances[neighbors[count]] < radius) {
+                stale = true;
+                return;
+            }
+        }
+    }
+}
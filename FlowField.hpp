@@ -0,0 +1,108 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: FlowField class holds the walking distance from the player to every floor cell of a map within a chase
+ * radius, shared by all zombies of the map. A zombie that chases steps toward the neighbor cell closest to the player,
+ * so each zombie only reads four distances per turn and the cost of chasing does not grow with the number of zombies.
+ * The field is built by one breadth first search from the player bounded by the chase radius, so building it costs
+ * the area around the player rather than the whole map. Cells are stamped with the build they were reached in instead
+ * of being cleared, so cells outside the field need no work at all. The field is only built again when the player
+ * has moved or when a cell changes between passable and blocked in a way that can change distances in the field:
+ * a cell in the field becoming blocked, or a blocked cell next to the field becoming floor. Door changes, item pick
+ * ups and all other tile changes that do not change passability leave the field as it is.
+ * Variables: distances - Steps from player to each cell, valid only where stamps holds current build. stamps - Build
+ * each cell was last reached in. build - Number of current build. queue - Cells waiting to be searched during a build.
+ * rows/cols - Size of map. radius - Chase radius, cells further away from player are not in field.
+ * sourceRow/sourceCol - Player location field was built from. stale - Set when a tile change may have changed
+ * distances in field.
+ * Functions: Constructor sets up empty field with no chase radius.
+ * setRadius - Set chase radius, field is built again on next use.
+ * getRadius - Return chase radius.
+ * invalidate - Mark field stale so that it is built again on next use.
+ * needsBuild - Return whether field must be built again for player location passed.
+ * buildField - Build field by bounded breadth first search from player location over floor cells of terrain layer.
+ * tileChanged - Mark field stale if passability change of cell passed can change distances in field.
+ * inField - Return whether cell was reached by current build.
+ * chaseDirection - Return direction (1 up, 2 right, 3 down, 4 left) toward player from cell passed, or 0 if cell is
+ * not in field or no neighbor is closer to player.
+*/
+
+#ifndef FLOWFIELD_HPP
+#define FLOWFIELD_HPP
+
+#include <cstdint>
+#include <vector>
+
+class FlowField {
+private:
+    //Steps from player to each cell, valid only where stamps holds current build
+    std::vector <uint16_t> distances;
+    std::vector <uint32_t> stamps;
+    uint32_t build;
+
+    //Cells waiting to be searched during a build, kept between builds so building allocates nothing
+    std::vector <int> queue;
+
+    //Size of map and chase radius
+    int rows,
+        cols,
+        radius;
+
+    //Player location field was built from and whether a tile change may have changed distances since
+    int sourceRow,
+        sourceCol;
+    bool stale;
+
+public:
+    //Constructor sets up empty field with no chase radius
+    FlowField();
+
+    //Set chase radius, field is built again on next use
+    void setRadius(int inputRadius);
+
+    //Return chase radius, 0 when zombies do not chase
+    int getRadius();
+
+    //Mark field stale so that it is built again on next use, such as after whole terrain layer was replaced
+    void invalidate();
+
+    //Return whether field must be built again for player location passed
+    bool needsBuild(int playerRow, int playerCol);
+
+    //Build field by bounded breadth first search from player location over floor cells of terrain layer (TerrainKind
+    //byte per cell in row-major order of map size passed). Player cell itself may be any terrain.
+    void buildField(const unsigned char* inputTerrain, int inputRows, int inputCols, int playerRow, int playerCol);
+
+    //Mark field stale if passability change of cell passed can change distances in field. Takes tileIndex of cell
+    //and whether cell is now floor.
+    void tileChanged(int inputIndex, bool inputPassable);
+
+    //Return whether cell was reached by current build. Defined in header as it is called for every chasing zombie.
+    bool inField(int inputIndex) const {
+        return stamps[inputIndex] == build;
+    }
+
+    //Return direction (1 up, 2 right, 3 down, 4 left) toward player from cell passed, or 0 if cell is not in field or
+    //no neighbor is closer to player. Ties go to first of up, right, down, left. Defined in header as it is called
+    //for every chasing zombie.
+    int chaseDirection(int inputIndex) const {
+        if (!inField(inputIndex)) {
+            return 0;
+        }
+
+        const int neighbors[4] = {inputIndex - cols, inputIndex + 1, inputIndex + cols, inputIndex - 1};
+        unsigned bestDistance = distances[inputIndex];
+        int bestDirection = 0;
+
+        for (int count = 0; count < 4; count++) {
+            if (inField(neighbors[count]) && distances[neighbors[count]] < bestDistance) {
+                bestDistance = distances[neighbors[count]];
+                bestDirection = count + 1;
+            }
+        }
+
+        return bestDirection;
+    }
+};
+
+#endif //FLOWFIELD_HPP
@@ -11,20 +11,70 @@
  * outdoorRecSupplier: Map pointer to the outdoor rec supplier map.
  * finalMap: Map pointer to the final map location (Field)
  * player: Player pointer to the player object in game.
- * Functions: Constructor sets up Game object by setting timeToDeath, allocating space for all maps, setting currentMap to outdoors,
- * allocating space to player, place player on currentMap, and call addDoors function to manually add linked doors
- * between maps.
- * Destructor deletes all instances of Map that was dynamically allocated.
+ * random: Seeded Random service that all maps draw from. The same seed plays out the same game.
+ * maps: All maps of world, in the order zombies of each map were originally moved.
+ * pool: ThreadPool that maps are moved on concurrently each turn.
+ * lodInterval: Number of turns maps player is not in skip before their zombies are caught up in one go, 0 to only
+ * catch them up when player enters.
+ * tickRate: Number of times a second world moves in real-time mode, 0 for turn-based play.
+ * render: Whether map is drawn each turn, off when a replay is played headless.
+ * turnsPlayed: Number of turns finished since game was set up, over every game played.
+ * savePath: Save file game is saved to when player exits game, empty to not save.
+ * scenarioRows/scenarioCols/scenarioZombies: Scenario outdoors map was set up with, so that a clone sets up the same.
+ * Functions: Constructor takes seed for Random service and sets up Game object by setting timeToDeath, allocating
+ * space for all maps, setting currentMap to outdoors, allocating space to player, place player on currentMap, and call
+ * addDoors function to manually add linked doors between maps. It may also take a scenario: size of outdoors map and
+ * number of zombies scattered over it on top of the standard ones, and number of worker threads of its thread pool.
+ * Destructor deletes all instances of Map that was dynamically allocated and player.
+ * resetWorld - Reset game to its starting state without rebuilding maps. Each map is restored from an image taken as
+ * it was set up, or set up again in the same memory if image does not fit. Random service is moved on to a new seed
+ * derived from the last one, or to seed passed.
+ * setChaseRadius - Set number of steps from player within which zombies of every map chase player, 0 to wander.
+ * setSightRadius - Set number of cells from player within which zombies of every map may spot player, 0 for none.
+ * setHearing - Set whether zombies of every map are drawn by noise of doors opening, items picked up and knife kills.
+ * setLodInterval - Set number of turns maps player is not in skip before they are caught up, 0 to wait for player.
+ * setTickRate - Set number of times a second world moves in real-time mode, 0 for turn-based play (default).
+ * setRender - Set whether map is drawn each turn.
+ * getTurnsPlayed - Return number of turns finished since game was set up.
+ * stateHash - Return hash of state of world and player, equal for games in the same state.
+ * saveState - Write state of world and player to a Snapshot.
+ * loadState - Set world and player to state read from a Snapshot, in place.
+ * saveGame/loadGame - Save state of game to a save file, or load it from one.
+ * setSavePath - Set save file game is saved to when player exits game.
+ * clone - Return new Game, moving maps on calling thread, holding an independent copy of world and player.
+ * copyFrom - Set world and player to a copy of those of another Game set up with the same scenario, in place.
+ * saveOnExit - Save game to save file, if one is set, as player exits game.
+ * playAgent - Play game to its end with player driven by agent passed in place of movePlayer, with no terminal input.
+ * Returns GameOutcome of game.
+ * playAction - Carry out one action of an agent for player, finishing turn if it took one. Returns false once game
+ * ended.
+ * getCurrentMap/getPlayer/getMaps - Return map player is in, player and all maps of world, for agents that search.
  * runGame - Primary controller for game, runs all menu options and combines functionality. If user starts playing game,
  * menu prints allowing user to reset game when either user elects to quit or game ends due to loss or win.
+ * finishTurn - Move zombies, check player surroundings and count down time left after player acted. Returns false if
+ * game was lost or won.
+ * runRealTime - Run game with world moved tickRate times a second by a fixed timestep scheduler, keys read without
+ * waiting and carried out on next tick. Reports tick timing jitter once game ends.
+ * applyKey - Carry out key pressed in real-time mode.
+ * reportTiming - Output lateness and run time of ticks of a real-time game.
+ * drawCurrentMap - Draw map player is in, unless rendering is off.
+ * moveAllZombies - Move zombies of every map, one task per map on thread pool, except maps moved in two phases which
+ * spread their own zombies across pool. Maps player is not in skip turns and are caught up every lodInterval turns.
+ * Returns once all maps due have moved.
+ * catchUpDue - Return whether map player is not in is caught up this turn.
  * movePlayer - Controller to allow for user selection for player movement on board. Prompts user for input of
  * direction to move and moves player piece in that direction. Returns boolean value for exit game. True to exit,
  * false to keep playing.
+ * takeAction - Carry out one validated control selection, moving player if it was a move. Returns false to exit game.
+ * takeAgentAction - Carry out one action of an agent, as takeAction does for a person. Returns false to exit game.
+ * endOutcome - Return how game ended, once finishTurn returned false.
  * controlsDisplay - Output game controls to terminal for user viewing.
  * interactObject - If player elects to engage with a Space object, function is called to interact with object.
  * Function outputs and accepts/validates direction of object to interact with and performs interaction with object.
+ * spaceInDirection - Return Space object next to player in direction passed.
+ * interactDirection - Interact with Space object next to player in direction passed.
  * changeMaps - If moving through door linked to another map, change map location of player as movement and set player
- * in the new map location. Takes Space pointer as parameter.
+ * in the new map location, after catching up turns the new map skipped. Takes Space pointer as parameter.
  * addDoors - Add/link doors between maps on game to allow for traversal between maps within the world.
  * startMenu - Allow user to select to start or exit game. Return boolean value for user selection.
  * gameDesc - Outputs information/introduction of game and its premise.
@@ -35,45 +85,420 @@
  * resetMenu - Allow user to select reset game from scratch. Returns boolean value for user selection.
 */
 
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <thread>
 #include "Game.hpp"
-
-//Sets up Game object by setting timeToDeath, allocating space for all maps, setting currentMap to outdoors, allocating
-//space to player, place player on currentMap, and call addDoors function to manually add linked doors between maps.
-Game::Game() {
+#include "RawTerminal.hpp"
+
+//Takes seed for Random service. Sets up Game object by setting timeToDeath, allocating space for all maps, setting
+//currentMap to outdoors, allocating space to player, place player on currentMap, and call addDoors function to
+//manually add linked doors between maps. Optionally takes a scenario: rows/cols of outdoors map (standard size when 0
+//or smaller) and number of zombies scattered over it on top of the standard ones, and number of worker threads of
+//thread pool maps are moved on (default one per core besides calling thread, 0 to move them on calling thread).
+Game::Game(uint64_t inputSeed, int outdoorRows, int outdoorCols, int outdoorZombies, unsigned inputWorkers) :
+        random(inputSeed), pool(inputWorkers), lodInterval(defaultLodInterval), tickRate(0),
+        render(true), turnsPlayed(0), savePath(""), scenarioRows(outdoorRows), scenarioCols(outdoorCols),
+        scenarioZombies(outdoorZombies) {
     //Set step limit for game until loss
     timeToDeath = 800;
 
     //Space locations setup - Outdoors (store fronts)
-    outdoors = new Outdoors("Outside");
+    outdoors = new Outdoors("Outside", &random, outdoorRows, outdoorCols, outdoorZombies);
 
     //Space locations setup - Grocery store
-    groceryStore = new GroceryStore("Grocery Store");
+    groceryStore = new GroceryStore("Grocery Store", &random);
 
     //Space locations setup - Outdoor rec supplier
-    outdoorRecSupplier = new OutdoorRecSupplier("Outdoor Recreational Supplier");
+    outdoorRecSupplier = new OutdoorRecSupplier("Outdoor Recreational Supplier", &random);
 
     //Space locations setup - Final map
-    finalMap = new Field("Field");
+    finalMap = new Field("Field", &random);
+
+    //Maps moved each turn
+    maps.push_back(outdoors);
+    maps.push_back(groceryStore);
+    maps.push_back(outdoorRecSupplier);
+    maps.push_back(finalMap);
 
     //Add doors to maps with map links
     addDoors();
 
+    //Maps as set up are kept as images that resets restore
+    for (unsigned count = 0; count < maps.size(); count++) {
+        maps[count]->captureImage();
+    }
+
     //Set current map to outdoors for start of game
     currentMap = outdoors;
 
     //Set player and location
-    player = new Player("player", currentMap->getStartRow(), currentMap->getStartCol());
+    player = new Player(currentMap->getStartRow(), currentMap->getStartCol());
 
     //Set player in map
     currentMap->setPlayerLocation(player, player->getRows(), player->getCols());
 }
 
-//Free all dynamically allocated memory - deletes all instances of Map that was dynamically allocated.
+//Free all dynamically allocated memory - deletes all instances of Map that was dynamically allocated and player.
 Game::~Game() {
-    delete outdoors;
-    delete groceryStore;
-    delete outdoorRecSupplier;
-    delete finalMap;
+    for (unsigned count = 0; count < maps.size(); count++) {
+        delete maps[count];
+    }
+    delete player;
+}
+
+//Reset game to its starting state without rebuilding maps. Each map is restored from the image it took when it was set
+//up, copying its layers and zombies whole, and a new player is placed outdoors. If any map's image does not fit, every
+//map releases all of its objects at once through its arena, is set up again in the same memory and takes a new image,
+//and doors are linked again. Random service is moved on to a new seed derived from the last one so that each game
+//plays out differently.
+void Game::resetWorld() {
+    //Next game draws from a new seed, still fully determined by the starting seed
+    resetWorld(Random::mix(random.getSeed()));
+}
+
+//Reset game to its starting state as above, with seed passed for Random service. World is then the same as a Game
+//newly set up with that seed.
+void Game::resetWorld(uint64_t inputSeed) {
+    //Set step limit for game until loss
+    timeToDeath = 800;
+
+    random.setSeed(inputSeed);
+
+    //Restore all maps from their images. Maps restored keep their doors and links.
+    bool restored = true;
+    for (unsigned count = 0; count < maps.size(); count++) {
+        restored = maps[count]->restoreImage() && restored;
+    }
+
+    //Doors are linked between maps, so if one map must be set up again all of them are
+    if (!restored) {
+        for (unsigned count = 0; count < maps.size(); count++) {
+            maps[count]->resetMap();
+        }
+
+        //Add doors to maps with map links
+        addDoors();
+
+        for (unsigned count = 0; count < maps.size(); count++) {
+            maps[count]->captureImage();
+        }
+    }
+
+    //Set current map to outdoors for start of game
+    currentMap = outdoors;
+
+    //Set player and location
+    delete player;
+    player = new Player(currentMap->getStartRow(), currentMap->getStartCol());
+
+    //Set player in map
+    currentMap->setPlayerLocation(player, player->getRows(), player->getCols());
+}
+
+//Play game to its end with player driven by agent passed in place of movePlayer: each turn agent chooses an action with
+//the same controls as a person, then world moves as in turn-based play. Nothing is read from terminal and game output
+//still goes to standard output. Takes agent, which is started with seed of game, and list that milliseconds each turn
+//took (agent choosing, player acting and world moving) are added to, or nullptr. Returns how game ended.
+GameOutcome Game::playAgent(Agent& inputAgent, std::vector <double>* outputTurnTimes) {
+    inputAgent.startGame(random.getSeed());
+
+    while (true) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        //Agent acts until it takes an action that takes a turn, as movePlayer asks a person again
+        bool playerEngaged = false;
+        for (unsigned count = 0; count < maxIdleActions && !playerEngaged; count++) {
+            if (!takeAgentAction(inputAgent.chooseAction(currentMap, player), playerEngaged)) {
+                return OUTCOME_QUIT;
+            }
+        }
+
+        const bool playGame = finishTurn();
+
+        if (outputTurnTimes != nullptr) {
+            outputTurnTimes->push_back(
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        if (!playGame) {
+            return endOutcome();
+        }
+    }
+}
+
+//Carry out one action of an agent for player, as playAgent does, then finish turn (move world) if action took a turn.
+//An action that does not take a turn, such as moving through a door into another map, leaves world as it is, like
+//playAgent asking agent again. Used by agents that search by playing actions out on copies of a game. Takes action and
+//outcome set once game ends. Returns false once game ended, true to keep playing.
+bool Game::playAction(const AgentAction& inputAction, GameOutcome& outputOutcome) {
+    bool playerEngaged = false;
+    if (!takeAgentAction(inputAction, playerEngaged)) {
+        outputOutcome = OUTCOME_QUIT;
+        return false;
+    }
+
+    if (playerEngaged && !finishTurn()) {
+        outputOutcome = endOutcome();
+        return false;
+    }
+
+    return true;
+}
+
+//Return map player is in
+Map* Game::getCurrentMap() {
+    return currentMap;
+}
+
+//Return player of game
+Player* Game::getPlayer() {
+    return player;
+}
+
+//Return all maps of world, in the order zombies of each map are moved
+const std::vector <Map*>& Game::getMaps() {
+    return maps;
+}
+
+//Carry out one action of an agent: E interacts in direction of action, answering whether key is used with action, and
+//other selections are carried out by takeAction. Sets boolean passed to true if player performed an action that takes
+//a turn. Returns false to exit game, true to keep playing.
+bool Game::takeAgentAction(const AgentAction& inputAction, bool& playerEngaged) {
+    //Agent answers question about using a key along with its action
+    if (inputAction.selection == 'E') {
+        player->setKeyChoice(inputAction.keyChoice);
+        interactDirection(inputAction.direction);
+        player->setKeyChoice(0);
+        playerEngaged = true;
+        return true;
+    }
+
+    return takeAction(std::string(1, inputAction.selection), playerEngaged);
+}
+
+//Return how game ended once finishTurn returned false: lost if player was killed, won if player won, otherwise timed
+//out
+GameOutcome Game::endOutcome() {
+    if (!player->getAlive()) {
+        return OUTCOME_LOST;
+    }
+    if (player->getWin()) {
+        return OUTCOME_WON;
+    }
+    return OUTCOME_TIMEOUT;
+}
+
+//Magic bytes and version of save files written by saveGame
+static const char saveMagic[4] = {'Z', 'S', 'A', 'V'};
+static const unsigned char saveVersion = 1;
+
+//Write state of world and player to snapshot passed: seed of Random service, time left, turns played, map player is in,
+//player location, status and items, then state of every map (see Map::saveState). Options such as chase radius are not
+//part of state and are kept as set.
+void Game::saveState(Snapshot& outputSnapshot) {
+    outputSnapshot.writeVarint(random.getSeed());
+    outputSnapshot.writeSigned(timeToDeath);
+    outputSnapshot.writeVarint(turnsPlayed);
+
+    unsigned mapIndex = 0;
+    while (maps[mapIndex] != currentMap) {
+        mapIndex++;
+    }
+    outputSnapshot.writeVarint(mapIndex);
+
+    outputSnapshot.writeVarint(player->getRows());
+    outputSnapshot.writeVarint(player->getCols());
+    outputSnapshot.writeByte(static_cast<unsigned char>(player->getAlive() | player->getWin() << 1));
+
+    const std::vector <SpaceKind>& inventory = player->getInventory();
+    outputSnapshot.writeVarint(inventory.size());
+    for (unsigned count = 0; count < inventory.size(); count++) {
+        outputSnapshot.writeByte(inventory[count]);
+    }
+
+    outputSnapshot.writeVarint(maps.size());
+    for (unsigned count = 0; count < maps.size(); count++) {
+        maps[count]->saveState(outputSnapshot);
+    }
+}
+
+//Set world and player to state read from snapshot passed, as written by saveState of a Game set up with the same
+//scenario size. Maps are loaded in place rather than built again. Returns false if snapshot does not hold a state of
+//this world, and world is then reset to its starting state.
+bool Game::loadState(Snapshot& inputSnapshot) {
+    const uint64_t seed = inputSnapshot.readVarint();
+    const int64_t timeLeft = inputSnapshot.readSigned();
+    const uint64_t turns = inputSnapshot.readVarint();
+    const uint64_t mapIndex = inputSnapshot.readVarint();
+    const uint64_t playerRow = inputSnapshot.readVarint();
+    const uint64_t playerCol = inputSnapshot.readVarint();
+    const unsigned char status = inputSnapshot.readByte();
+
+    //Bag is read only up to what it holds, so that a count out of range is not read as a smaller one
+    const uint64_t inventoryCount = inputSnapshot.readVarint();
+    if (inventoryCount > static_cast<uint64_t>(player->getMaxInventory())) {
+        inputSnapshot.fail();
+    }
+
+    std::vector <SpaceKind> inventory(inputSnapshot.good() ? static_cast<unsigned>(inventoryCount) : 0);
+    for (unsigned count = 0; count < inventory.size(); count++) {
+        inventory[count] = static_cast<SpaceKind>(inputSnapshot.readByte());
+        if (inventory[count] >= KIND_COUNT) {
+            inputSnapshot.fail();
+        }
+    }
+
+    bool loaded = inputSnapshot.good() && inputSnapshot.readVarint() == maps.size() && mapIndex < maps.size();
+    for (unsigned count = 0; count < maps.size() && loaded; count++) {
+        loaded = maps[count]->loadState(inputSnapshot);
+    }
+
+    //Player must stand on a free cell of its map, floor or an open door, and countdown must fit in an int
+    Map* playerMap = loaded ? maps[mapIndex] : nullptr;
+    loaded = loaded && inputSnapshot.atEnd() && playerRow < static_cast<uint64_t>(playerMap->getRows()) &&
+             playerCol < static_cast<uint64_t>(playerMap->getCols()) &&
+             !playerMap->isZombieAt(static_cast<int>(playerRow), static_cast<int>(playerCol)) &&
+             timeLeft >= INT_MIN && timeLeft <= INT_MAX;
+    if (loaded) {
+        Space* playerTile = playerMap->getTile(static_cast<int>(playerRow), static_cast<int>(playerCol));
+        loaded = playerTile->getKind() == KIND_FLOOR || playerTile->isOpenDoor();
+    }
+
+    Player* loadedPlayer = new Player(static_cast<int>(playerRow), static_cast<int>(playerCol));
+    loaded = loaded && loadedPlayer->setInventory(inventory);
+
+    if (!loaded) {
+        delete loadedPlayer;
+        resetWorld(random.getSeed());
+        return false;
+    }
+
+    random.setSeed(seed);
+    timeToDeath = static_cast<int>(timeLeft);
+    turnsPlayed = turns;
+
+    //Maps took player off while loading
+    delete player;
+    player = loadedPlayer;
+    player->setAlive((status & 1) != 0);
+    player->setWin((status & 2) != 0);
+
+    currentMap = playerMap;
+    currentMap->setPlayerLocation(player, player->getRows(), player->getCols());
+
+    return true;
+}
+
+//Save state of game to save file at path passed. Save file is a 4 byte magic "ZSAV" and a version byte followed by
+//state as written by saveState. Returns false if file could not be written.
+bool Game::saveGame(const std::string& inputPath) {
+    Snapshot snapshot;
+    snapshot.writeBytes(reinterpret_cast<const unsigned char*>(saveMagic), sizeof(saveMagic));
+    snapshot.writeByte(saveVersion);
+    saveState(snapshot);
+
+    return snapshot.saveFile(inputPath);
+}
+
+//Load state of game from save file at path passed. Returns false if file could not be read or is not a save of a
+//version this game loads, leaving game as it was, or if it is not a save of this world, and world is then reset to its
+//starting state.
+bool Game::loadGame(const std::string& inputPath) {
+    Snapshot snapshot;
+    if (!snapshot.loadFile(inputPath)) {
+        return false;
+    }
+
+    for (unsigned count = 0; count < sizeof(saveMagic); count++) {
+        if (snapshot.readByte() != static_cast<unsigned char>(saveMagic[count])) {
+            return false;
+        }
+    }
+    if (snapshot.readByte() != saveVersion) {
+        return false;
+    }
+
+    return loadState(snapshot);
+}
+
+//Set save file game is saved to when player exits game (Q), empty (default) to not save
+void Game::setSavePath(const std::string& inputPath) {
+    savePath = inputPath;
+}
+
+//Return new Game holding an independent copy of world and player of this game, for search and what-if play. Clone is
+//set up with the same seed and scenario, with no worker threads so that many clones can be played at once, and then
+//copies this game through copyFrom. Caller owns clone and deletes it.
+Game* Game::clone() {
+    Game* copy = new Game(random.getSeed(), scenarioRows, scenarioCols, scenarioZombies, 0);
+    copy->setRender(render);
+    copy->copyFrom(*this);
+
+    return copy;
+}
+
+//Set world and player to a copy of those of game passed, which was set up with the same scenario: every map is copied
+//through Map::copyFrom, in place, and player is given the location, status and items of its player. Seed, time left,
+//turns played and options (chase and sight radius, hearing, level of detail interval) are copied, while tick rate,
+//rendering and save file are kept. Game passed is only read, so several games may copy it at once. Copying a game
+//between turns, its zombies move as they would in it, except that zombies heading for a goal may take another shortest
+//path of the same length as cached paths are not copied. Returns false if game passed is of another scenario, and world
+//is then reset to its starting state.
+bool Game::copyFrom(Game& inputGame) {
+    if (inputGame.scenarioRows != scenarioRows || inputGame.scenarioCols != scenarioCols ||
+        inputGame.scenarioZombies != scenarioZombies) {
+        resetWorld(random.getSeed());
+        return false;
+    }
+
+    //Items created again by earlier copies are only given back by setting maps up again, which links doors again
+    bool outgrown = false;
+    for (unsigned count = 0; count < maps.size(); count++) {
+        outgrown = maps[count]->arenaOutgrown() || outgrown;
+    }
+    if (outgrown) {
+        for (unsigned count = 0; count < maps.size(); count++) {
+            maps[count]->resetMap();
+        }
+        addDoors();
+        for (unsigned count = 0; count < maps.size(); count++) {
+            maps[count]->captureImage();
+        }
+    }
+
+    unsigned mapIndex = 0;
+    bool copied = true;
+    for (unsigned count = 0; count < maps.size(); count++) {
+        copied = maps[count]->copyFrom(*inputGame.maps[count]) && copied;
+        if (inputGame.maps[count] == inputGame.currentMap) {
+            mapIndex = count;
+        }
+    }
+
+    if (!copied || !player->setInventory(inputGame.player->getInventory())) {
+        resetWorld(random.getSeed());
+        return false;
+    }
+
+    random.setSeed(inputGame.random.getSeed());
+    timeToDeath = inputGame.timeToDeath;
+    turnsPlayed = inputGame.turnsPlayed;
+    lodInterval = inputGame.lodInterval;
+
+    //Maps copied hold the cell of player of game passed, own player is placed there
+    player->setRows(inputGame.player->getRows());
+    player->setCols(inputGame.player->getCols());
+    player->setAlive(inputGame.player->getAlive());
+    player->setWin(inputGame.player->getWin());
+    currentMap = maps[mapIndex];
+    currentMap->setPlayerLocation(player, player->getRows(), player->getCols());
+
+    return true;
 }
 
 //Primary controller for game, runs all menu options and combines functionality.
@@ -94,46 +519,25 @@ void Game::runGame() {
             outdoorDesc();
             std::cout << std::endl;
 
+            //Real-time mode moves world on its own clock, otherwise world moves once per player action
+            if (tickRate > 0) {
+                runRealTime();
+                playGame = false;
+            }
+
             while (playGame) {
                 //Draw current map
-                currentMap->drawMap();
+                drawCurrentMap();
 
                 //Allow user to move player during turn, displays controls and accepts/validates selection.
                 //Moves player in direction selected.
                 playGame = movePlayer();
-
-                //Move zombies in all maps
-                outdoors->moveZombies();
-                groceryStore->moveZombies();
-                outdoorRecSupplier->moveZombies();
-                finalMap->moveZombies();
-
-                //Check surroundings around player, if player is near a zombie, player is attacked (player attack check occurs
-                //twice, once when zombie moves and once after zombie has moved).
-                currentMap->checkZombies(player);
-
-                timeToDeath--;
-
-                //Check for player alive status
-                if (!player->getAlive()) {
-                    //Draw current map to show user contact with zombie
-                    currentMap->drawMap();
-
-                    std::cout << std::endl << "GAME OVER\nPlayer was overcome by a zombie and has fallen!" << std::endl;
-                    playGame = false;
-                } else if (player->getWin()) {
-                    std::cout << std::endl
-                              << "GAME WON!\nYou successfully retrieved the medicine for your group. You all live" <<
-                              " to fight another day.\nYou make it back to your colony and are welcomed with open arms "
-                              <<
-                              "as the hero you are." << std::endl;
-                    playGame = false;
+                if (!playGame) {
+                    saveOnExit();
                 }
 
-                    //Check turn counter, if no turns are left, game ends. Set playGame to false.
-                else if (timeToDeath <= 0) {
-                    std::cout << std::endl << "GAME OVER\n" <<
-                              "You did not receive the medicine in time to save your group!" << std::endl;
+                //Move zombies, check player surroundings and end game if it was lost or won
+                if (!finishTurn()) {
                     playGame = false;
                 }
             }
@@ -143,49 +547,381 @@ void Game::runGame() {
 
             if (resetGame) {
                 playGame = true;
-                //Delete all current game aspects and free memory.
-                delete outdoors;
-                delete groceryStore;
-                delete outdoorRecSupplier;
-                delete finalMap;
 
-                //Setup game again
-                //Set step limit for game until loss
-                timeToDeath = 800;
+                //Release all current game aspects and set up game again
+                resetWorld();
+            }
+        }
+
+        //User elected to quit game at start, no need to reset game
+        else {
+            resetGame = false;
+        }
+
+    } while (resetGame);
+
+}
 
-                //Space locations setup - Outdoors (store fronts)
-                outdoors = new Outdoors("Outside");
+//Finish a turn after player acted: move zombies of all maps, check surroundings of player for zombies and count down
+//time left. Outputs end of game and returns false if game was lost or won this turn, true to keep playing.
+bool Game::finishTurn() {
+    bool turnGame = true;
+
+    //Move zombies in all maps, all maps have moved before player surroundings are checked
+    moveAllZombies();
+
+    //Check surroundings around player, if player is near a zombie, player is attacked (player attack check occurs
+    //twice, once when zombie moves and once after zombie has moved).
+    currentMap->checkZombies(player);
+
+    timeToDeath--;
+    turnsPlayed++;
+
+    //Check for player alive status
+    if (!player->getAlive()) {
+        //Draw current map to show user contact with zombie
+        drawCurrentMap();
+
+        std::cout << std::endl << "GAME OVER\nPlayer was overcome by a zombie and has fallen!" << std::endl;
+        turnGame = false;
+    } else if (player->getWin()) {
+        std::cout << std::endl
+                  << "GAME WON!\nYou successfully retrieved the medicine for your group. You all live" <<
+                  " to fight another day.\nYou make it back to your colony and are welcomed with open arms "
+                  <<
+                  "as the hero you are." << std::endl;
+        turnGame = false;
+    }
 
-                //Space locations setup - Grocery store
-                groceryStore = new GroceryStore("Grocery Store");
+        //Check turn counter, if no turns are left, game ends. Set turnGame to false.
+    else if (timeToDeath <= 0) {
+        std::cout << std::endl << "GAME OVER\n" <<
+                  "You did not receive the medicine in time to save your group!" << std::endl;
+        turnGame = false;
+    }
 
-                //Space locations setup - Outdoor rec supplier
-                outdoorRecSupplier = new OutdoorRecSupplier("Outdoor Recreational Supplier");
+    return turnGame;
+}
 
-                //Space locations setup - Final map
-                finalMap = new Field("Field");
+//Run game in real-time mode until it is lost, won or player exits. World is moved by a fixed timestep scheduler
+//tickRate times a second whether player acts or not. Keys are read from a raw terminal without waiting for Enter while
+//waiting for next tick, and the oldest key pressed is carried out at start of next tick. Ticks due while an earlier
+//tick ran late are run at once, unless world fell more than maxLateTicks behind, then missed ticks are dropped. Tick
+//timing is reported once game ends. Key carried out on each tick is recorded to input replay, if one is set, and a
+//replay being played gives the key of each tick instead, with ticks run one after another without waiting.
+void Game::runRealTime() {
+    RawTerminal terminal;
+
+    const std::chrono::steady_clock::duration period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / tickRate));
+
+    //Keys pressed since last tick, carried out one per tick
+    std::vector <int> keys;
+    int prompt = 0;
+
+    //Milliseconds each tick started after it was due and took to run, and number of ticks dropped
+    std::vector <double> lateness;
+    std::vector <double> tickTimes;
+    unsigned dropped = 0;
+
+    std::cout << "REAL-TIME MODE: The world moves " << tickRate << " times a second whether you act or not. Press a"
+              << " control key without Enter, E then a movement key to interact, Y or N to answer a question."
+              << std::endl;
+
+    //A replay being played gives the key of each tick instead, and runs ticks as fast as they can be played
+    Replay* replay = getInputReplay();
+    const bool replaying = replay != nullptr && replay->isPlaying();
+
+    //Wait for a key so that descriptions can be read before clock starts
+    if (terminal.isRaw() && !replaying) {
+        std::cout << "Press any key to start." << std::endl;
+        terminal.readKey(-1);
+    }
 
-                //Add doors to maps with map links
-                addDoors();
+    bool playGame = true;
+    bool inputClosed = false;
+    std::chrono::steady_clock::time_point due = std::chrono::steady_clock::now();
+    while (playGame) {
+        //Wait for tick to be due, collecting keys as they are pressed. Once input has ended there is nothing to wait
+        //for, so ticks run straight away until keys read before are carried out and game is exited.
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        while (now < due && !inputClosed && !replaying) {
+            //poll waits whole milliseconds, so the last part of a millisecond is slept instead
+            const int waitMilliseconds = static_cast<int>(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(due - now).count());
+            if (waitMilliseconds == 0) {
+                std::this_thread::sleep_until(due);
+                now = std::chrono::steady_clock::now();
+                continue;
+            }
 
-                //Set current map to outdoors for start of game
-                currentMap = outdoors;
+            int key = terminal.readKey(waitMilliseconds);
 
-                //Set player and location
-                player = new Player("player", currentMap->getStartRow(), currentMap->getStartCol());
+            //Ctrl-C and Ctrl-D exit game, as raw terminal reads them as keys
+            if (key == KEY_CLOSED || key == 3 || key == 4) {
+                inputClosed = (key == KEY_CLOSED);
+                key = 'Q';
+            }
 
-                //Set player in map
-                currentMap->setPlayerLocation(player, player->getRows(), player->getCols());
+            //Only control keys are kept, and keys held down are not let run ahead of world by more than a few ticks
+            if (key != KEY_NONE) {
+                key = std::toupper(key);
+            }
+            if (key != KEY_NONE && key != 0 && std::strchr("WSADIEQYN", key) != nullptr &&
+                (keys.size() < maxPendingKeys || key == 'Q')) {
+                keys.push_back(key);
             }
+
+            now = std::chrono::steady_clock::now();
         }
+        lateness.push_back(std::max(0.0, std::chrono::duration<double, std::milli>(now - due).count()));
 
-        //User elected to quit game at start, no need to reset game
-        else {
-            resetGame = false;
+        //Screen is cleared at start of tick so that messages of this tick stay above map drawn at its end
+        if (terminal.isRaw() && render) {
+            std::cout << "\033[H\033[2J";
         }
 
-    } while (resetGame);
+        //Carry out oldest key pressed (or key of tick of replay being played, 0 for none), then move world
+        int key = 0;
+        if (replaying) {
+            key = replay->nextTick();
+        }
+        else if (!keys.empty()) {
+            key = keys.front();
+            keys.erase(keys.begin());
+        }
+        if (replay != nullptr) {
+            replay->recordTick(key);
+        }
+        if (key != 0) {
+            playGame = applyKey(key, prompt);
+            if (!playGame) {
+                saveOnExit();
+            }
+        }
+
+        if (!finishTurn()) {
+            playGame = false;
+        }
+        else if (playGame) {
+            drawCurrentMap();
+            std::cout << "Time Left: " << timeToDeath << std::endl;
+        }
 
+        tickTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - now).count());
+
+        //Next tick is due one period after this one was due, so lateness of one tick does not push back the rest
+        due += period;
+        if (std::chrono::steady_clock::now() - due > period * static_cast<int>(maxLateTicks)) {
+            const std::chrono::steady_clock::time_point restart = std::chrono::steady_clock::now();
+            dropped += static_cast<unsigned>((restart - due) / period);
+            due = restart;
+        }
+    }
+
+    reportTiming(lateness, tickTimes, dropped);
+}
+
+//Carry out key pressed in real-time mode, same controls as turn-based mode. After E, next key chooses direction of
+//interaction (W up, S down, A left, D right) instead of being asked for, and when that finds a locked door and player
+//holds a key, next key answers whether key is used (Y yes, N no, any other key carried out as usual), so that no prompt
+//waits for a line. Takes key and what it answers, which is updated: 0 nothing, -1 direction after E, or 1-4 direction
+//of locked door asked about. Returns boolean value for exit game. True to exit, false to keep playing.
+bool Game::applyKey(int inputKey, int& prompt) {
+    const char key = static_cast<char>(std::toupper(inputKey));
+
+    if (prompt > 0) {
+        const int doorDirection = prompt;
+        prompt = 0;
+
+        //Any other key leaves the key in the bag and is carried out as usual
+        if (key == 'Y' || key == 'N') {
+            player->useKey(spaceInDirection(doorDirection), (key == 'Y') ? 1 : 2);
+            return true;
+        }
+    }
+
+    if (prompt < 0) {
+        prompt = 0;
+
+        const std::string directions = "WSAD";
+        const std::string::size_type direction = directions.find(key);
+        if (direction != std::string::npos) {
+            player->setKeyChoice(3);
+            interactDirection(static_cast<int>(direction) + 1);
+            player->setKeyChoice(0);
+
+            if (player->getKeyAsked()) {
+                prompt = static_cast<int>(direction) + 1;
+            }
+        }
+
+        return true;
+    }
+
+    if (key == 'E') {
+        prompt = -1;
+        std::cout << "Which direction would you like to interact with? W/S/A/D" << std::endl;
+        return true;
+    }
+
+    if (std::string("WSADIQ").find(key) == std::string::npos) {
+        return true;
+    }
+
+    bool playerEngaged = false;
+    return takeAction(std::string(1, key), playerEngaged);
+}
+
+//Output timing of ticks of a real-time game: how late ticks started after they were due (jitter) and how long they
+//took to run, as mean, median, 99th percentile and worst in milliseconds, and number of ticks dropped. Takes lateness
+//and run time of every tick and number dropped.
+void Game::reportTiming(std::vector <double>& lateness, std::vector <double>& tickTimes, unsigned dropped) {
+    if (lateness.empty()) {
+        return;
+    }
+
+    std::vector <double>* samples[2] = {&lateness, &tickTimes};
+    const char* names[2] = {"Tick jitter (late start)", "Tick run time           "};
+
+    std::cout << std::endl << std::fixed << std::setprecision(3) << "Real-time timing: " << lateness.size()
+              << " ticks at " << tickRate << " Hz (" << 1000.0 / tickRate << " ms period), " << dropped
+              << " dropped" << std::endl;
+
+    for (int count = 0; count < 2; count++) {
+        std::vector <double>& sample = *samples[count];
+        std::sort(sample.begin(), sample.end());
+
+        double total = 0;
+        for (unsigned index = 0; index < sample.size(); index++) {
+            total += sample[index];
+        }
+
+        std::cout << names[count] << ": mean " << total / sample.size() << " ms, median "
+                  << sample[sample.size() / 2] << " ms, p99 " << sample[(sample.size() * 99) / 100] << " ms, max "
+                  << sample.back() << " ms" << std::endl;
+    }
+
+    std::cout.unsetf(std::ios::fixed);
+    std::cout << std::setprecision(6);
+}
+
+//Set number of times a second the world moves in real-time mode, 0 (default) for turn-based play in which world moves
+//once per player action. Kept when world is reset.
+void Game::setTickRate(unsigned inputRate) {
+    tickRate = inputRate;
+
+    if (tickRate > maxTickRate) {
+        tickRate = maxTickRate;
+    }
+}
+
+//Set whether map is drawn each turn, on by default. Turned off to play a replay headless, where drawing is most of the
+//time a turn takes.
+void Game::setRender(bool inputRender) {
+    render = inputRender;
+}
+
+//Return number of turns finished since game was set up, over every game played
+unsigned long long Game::getTurnsPlayed() {
+    return turnsPlayed;
+}
+
+//Return hash of state of world and player: every map (see Map::stateHash), map player is in, player location, whether
+//player is alive or has won, time left and seed of Random service. Equal for games in the same state, so a replay can
+//be checked to end the same as the session it recorded.
+uint64_t Game::stateHash() {
+    uint64_t hash = Random::mix(random.getSeed());
+
+    for (unsigned count = 0; count < maps.size(); count++) {
+        hash = Random::mix(hash ^ maps[count]->stateHash());
+        if (maps[count] == currentMap) {
+            hash = Random::mix(hash + count);
+        }
+    }
+
+    hash = Random::mix(hash + (static_cast<uint64_t>(player->getRows()) << 32) +
+                       static_cast<uint32_t>(player->getCols()));
+    hash = Random::mix(hash + (static_cast<uint64_t>(player->getAlive()) << 1) + player->getWin());
+
+    return Random::mix(hash + static_cast<uint32_t>(timeToDeath));
+}
+
+//Set number of steps from player within which zombies of every map chase player, 0 (default) for zombies to wander at
+//random. Kept when world is reset.
+void Game::setChaseRadius(int inputRadius) {
+    for (unsigned count = 0; count < maps.size(); count++) {
+        maps[count]->setChaseRadius(inputRadius);
+    }
+}
+
+//Set number of cells from player within which zombies of every map may spot player and head for where they saw player,
+//0 (default) for none. Kept when world is reset.
+void Game::setSightRadius(int inputRadius) {
+    for (unsigned count = 0; count < maps.size(); count++) {
+        maps[count]->setSightRadius(inputRadius);
+    }
+}
+
+//Set whether zombies of every map are drawn by noise of doors opening, items picked up and knife kills, off by
+//default. Kept when world is reset.
+void Game::setHearing(bool inputHearing) {
+    for (unsigned count = 0; count < maps.size(); count++) {
+        maps[count]->setHearing(inputHearing);
+    }
+}
+
+//Set number of turns maps player is not in skip before their zombies are caught up in one go (default
+//defaultLodInterval). 1 moves every map every turn, 0 only catches a map up when player enters it. Game plays out the
+//same for any interval.
+void Game::setLodInterval(unsigned inputInterval) {
+    lodInterval = inputInterval;
+}
+
+//Move zombies of every map, one task per map on thread pool. Maps share no state while zombies move: zombies only read
+//their own map and draw from their own random streams, and only the map holding player touches player. So result is
+//the same as moving maps one after another. Maps moved in two phases spread their own zombies across pool instead, so
+//they are moved one at a time after the others. Maps player is not in skip the turn instead, and are caught up once
+//they have skipped lodInterval turns, each map on its own turns. Returns once all maps due have moved.
+void Game::moveAllZombies() {
+    //Nothing sees a map player is not in until player enters it, so its turns can wait to be moved together
+    for (unsigned count = 0; count < maps.size(); count++) {
+        if (maps[count] != currentMap) {
+            maps[count]->skipTurn();
+        }
+    }
+
+    pool.run(static_cast<unsigned>(maps.size()), [this](unsigned mapIndex) {
+        if (maps[mapIndex]->getMoveMode() != MOVE_IN_ORDER) {
+            return;
+        }
+
+        if (maps[mapIndex] == currentMap) {
+            maps[mapIndex]->moveZombies();
+        }
+        else if (catchUpDue(mapIndex)) {
+            maps[mapIndex]->catchUp();
+        }
+    });
+
+    for (unsigned count = 0; count < maps.size(); count++) {
+        if (maps[count]->getMoveMode() != MOVE_TWO_PHASE) {
+            continue;
+        }
+
+        if (maps[count] == currentMap) {
+            maps[count]->moveZombies(&pool);
+        }
+        else if (catchUpDue(count)) {
+            maps[count]->catchUp(&pool);
+        }
+    }
+}
+
+//Return whether map at index of maps, which player is not in, is caught up this turn. A map is caught up every
+//lodInterval turns it skips, offset by its index so that maps are not all caught up on the same turn.
+bool Game::catchUpDue(unsigned mapIndex) {
+    return lodInterval > 0 && (maps[mapIndex]->getSkippedTurns() + mapIndex) % lodInterval == 0;
 }
 
 //Controller to allow for user selection for player movement on board. Prompts user for input
@@ -204,141 +940,170 @@ bool Game::movePlayer() {
         //Accept and validate input from user for movement selection
         moveSelection = validateMove();
 
-        //Move up on map
-        if (moveSelection == "W") {
-            //Check to see if a map change is needed if moving from open door space, out of current map bounds.
-            if ((currentMap->getCurrentSpace()->getName() == "open door" || currentMap->getCurrentSpace()->getName()
-                == "open space") && player->getUp()->getMapName() != "") {
-                changeMaps(player->getUp());
-            }
-
-            //If move location is not null, then check to make sure object can be passed through/over and move if so
-            else if (!player->getUp()->getSolid()) {
-                //Remove old player position from map to move to next position
-                currentMap->removePlayer(player);
+        //Carry out selection, moving player if it was a move
+        playGame = takeAction(moveSelection, playerEngaged);
 
-                //Adjust player character position
-                player->setRows((player->getRows() - 1));
-
-                playerEngaged = true;
-            }
-            //Player cannot move there, output message as to why
-            else {
-                std::cout << "Player could not be moved to that location, there is a " <<
-                          player->getUp()->getName() << " there!" << std::endl << std::endl;
-            }
+        //If player could not be moved and user did not elect to exit game, inform user that wall was hit.
+        if (!playerEngaged && playGame) {
+            //Display map again
+            drawCurrentMap();
         }
 
-        //Move down on map
-        else if (moveSelection == "S") {
-            //Check to see if a map change is needed if moving from open door space, out of current map bounds.
-            if ((currentMap->getCurrentSpace()->getName() == "open door" || currentMap->getCurrentSpace()->getName()
-                == "open space") && player->getDown()->getMapName() != "") {
-                changeMaps(player->getDown());
-            }
+    } while (!playerEngaged && playGame);
 
-            //If move location is not null, then check to make sure object can be passed through/over and move if so
-            else if (!player->getDown()->getSolid()) {
-                //Remove old player position from map to move to next position
-                currentMap->removePlayer(player);
+    return playGame;
+}
 
-                //Adjust player character position
-                player->setRows((player->getRows() + 1));
+//Carry out one control selection (W/S/A/D move, E interact, I inventory, Q exit game) as validated by validateMove.
+//Takes selection and sets boolean passed to true if player performed an action that takes a turn. Returns boolean
+//value for exit game. True to exit, false to keep playing.
+bool Game::takeAction(std::string moveSelection, bool& playerEngaged) {
+    bool playGame = true;
 
-                playerEngaged = true;
-            }
-            //Player cannot move there, output message as to why
-            else {
-                std::cout << "Player could not be moved to that location, there is a " <<
-                          player->getDown()->getName() << " there!" << std::endl << std::endl;
-            }
+    //Move up on map
+    if (moveSelection == "W") {
+        //Check to see if a map change is needed if moving from open door space, out of current map bounds.
+        if (currentMap->getCurrentSpace()->isOpenDoor() && currentMap->getUp(player)->getMapId() != MAP_NONE) {
+            changeMaps(currentMap->getUp(player));
         }
 
-        //Move left on map
-        else if (moveSelection == "A") {
-            //Check to see if a map change is needed if moving from open door space, out of current map bounds.
-            if ((currentMap->getCurrentSpace()->getName() == "open door" || currentMap->getCurrentSpace()->getName()
-                == "open space") && player->getLeft()->getMapName() != "") {
-                changeMaps(player->getLeft());
-            }
-
-            //If move location is not null, then check to make sure object can be passed through/over and move if so
-            else if (!player->getLeft()->getSolid()) {
-                //Remove old player position from map to move to next position
-                currentMap->removePlayer(player);
+        //If move location is not null, then check to make sure object can be passed through/over and move if so
+        else if (!currentMap->getUp(player)->getSolid()) {
+            //Remove old player position from map to move to next position
+            currentMap->removePlayer(player);
 
-                //Adjust player character position
-                player->setCols((player->getCols() - 1));
+            //Adjust player character position
+            player->setRows((player->getRows() - 1));
 
-                playerEngaged = true;
-            }
+            playerEngaged = true;
+        }
+        //Player cannot move there, output message as to why
+        else {
+            std::cout << "Player could not be moved to that location, there is a " <<
+                      currentMap->getUp(player)->getName() << " there!" << std::endl << std::endl;
+        }
+    }
 
-            //Player cannot move there, output message as to why
-            else {
-                std::cout << "Player could not be moved to that location, there is a " <<
-                          player->getLeft()->getName() << " there!" << std::endl << std::endl;
-            }
+    //Move down on map
+    else if (moveSelection == "S") {
+        //Check to see if a map change is needed if moving from open door space, out of current map bounds.
+        if (currentMap->getCurrentSpace()->isOpenDoor() && currentMap->getDown(player)->getMapId() != MAP_NONE) {
+            changeMaps(currentMap->getDown(player));
         }
 
-        //Move right on map
-        else if (moveSelection == "D") {
-            //Check to see if a map change is needed if moving from open door space, out of current map bounds.
-            if ((currentMap->getCurrentSpace()->getName() == "open door" || currentMap->getCurrentSpace()->getName()
-                == "open space") && player->getRight()->getMapName() != "") {
-                changeMaps(player->getRight());
-            }
+        //If move location is not null, then check to make sure object can be passed through/over and move if so
+        else if (!currentMap->getDown(player)->getSolid()) {
+            //Remove old player position from map to move to next position
+            currentMap->removePlayer(player);
 
-            //If move location is not null, then check to make sure object can be passed through/over and move if so
-            else if (!player->getRight()->getSolid()) {
-                //Remove old player position from map to move to next position
-                currentMap->removePlayer(player);
+            //Adjust player character position
+            player->setRows((player->getRows() + 1));
 
-                //Adjust player character position
-                player->setCols((player->getCols() + 1));
+            playerEngaged = true;
+        }
+        //Player cannot move there, output message as to why
+        else {
+            std::cout << "Player could not be moved to that location, there is a " <<
+                      currentMap->getDown(player)->getName() << " there!" << std::endl << std::endl;
+        }
+    }
 
-                playerEngaged = true;
-            }
-            //Player cannot move there, output message as to why
-            else {
-                std::cout << "Player could not be moved to that location, there is a " <<
-                    player->getRight()->getName() << " there!" << std::endl << std::endl;
-            }
+    //Move left on map
+    else if (moveSelection == "A") {
+        //Check to see if a map change is needed if moving from open door space, out of current map bounds.
+        if (currentMap->getCurrentSpace()->isOpenDoor() && currentMap->getLeft(player)->getMapId() != MAP_NONE) {
+            changeMaps(currentMap->getLeft(player));
         }
 
-        //Interact with Space object (up, down, left, or right of players current position)
-        else if (moveSelection == "E") {
-            //Interact with Space object. Request user input for which direction to interact with
-            //and interact with that object.
-            interactObject();
+        //If move location is not null, then check to make sure object can be passed through/over and move if so
+        else if (!currentMap->getLeft(player)->getSolid()) {
+            //Remove old player position from map to move to next position
+            currentMap->removePlayer(player);
+
+            //Adjust player character position
+            player->setCols((player->getCols() - 1));
 
             playerEngaged = true;
         }
 
-        else if (moveSelection == "I") {
-            player->viewInventory();
+        //Player cannot move there, output message as to why
+        else {
+            std::cout << "Player could not be moved to that location, there is a " <<
+                      currentMap->getLeft(player)->getName() << " there!" << std::endl << std::endl;
         }
+    }
 
-        //Exit game
-        else if (moveSelection == "Q") {
-            playGame = false;
+    //Move right on map
+    else if (moveSelection == "D") {
+        //Check to see if a map change is needed if moving from open door space, out of current map bounds.
+        if (currentMap->getCurrentSpace()->isOpenDoor() && currentMap->getRight(player)->getMapId() != MAP_NONE) {
+            changeMaps(currentMap->getRight(player));
         }
 
-        if (moveSelection != "E" && moveSelection != "I" && playerEngaged && moveSelection != "Q") {
-            //Move player to new space
-            currentMap->setPlayerLocation(player, player->getRows(), player->getCols());
-        }
+        //If move location is not null, then check to make sure object can be passed through/over and move if so
+        else if (!currentMap->getRight(player)->getSolid()) {
+            //Remove old player position from map to move to next position
+            currentMap->removePlayer(player);
 
-        //If player could not be moved and user did not elect to exit game, inform user that wall was hit.
-        if (!playerEngaged && playGame) {
-            //Display map again
-            currentMap->drawMap();
+            //Adjust player character position
+            player->setCols((player->getCols() + 1));
+
+            playerEngaged = true;
         }
+        //Player cannot move there, output message as to why
+        else {
+            std::cout << "Player could not be moved to that location, there is a " <<
+                currentMap->getRight(player)->getName() << " there!" << std::endl << std::endl;
+        }
+    }
 
-    } while (!playerEngaged && playGame);
+    //Interact with Space object (up, down, left, or right of players current position)
+    else if (moveSelection == "E") {
+        //Interact with Space object. Request user input for which direction to interact with
+        //and interact with that object.
+        interactObject();
+
+        playerEngaged = true;
+    }
+
+    else if (moveSelection == "I") {
+        player->viewInventory();
+    }
+
+    //Exit game
+    else if (moveSelection == "Q") {
+        playGame = false;
+    }
+
+    if (moveSelection != "E" && moveSelection != "I" && playerEngaged && moveSelection != "Q") {
+        //Move player to new space
+        currentMap->setPlayerLocation(player, player->getRows(), player->getCols());
+    }
 
     return playGame;
 }
 
+//Save game to save file, if one is set, as player exits game and tell player it was saved
+void Game::saveOnExit() {
+    if (savePath.empty()) {
+        return;
+    }
+
+    if (saveGame(savePath)) {
+        std::cout << "Game saved to " << savePath << ", load it to carry on from here." << std::endl;
+    }
+    else {
+        std::cout << "Game could not be saved to " << savePath << "!" << std::endl;
+    }
+}
+
+//Draw map player is in, unless rendering is off
+void Game::drawCurrentMap() {
+    if (render) {
+        currentMap->drawMap();
+    }
+}
+
 //Output game controls to terminal for user viewing
 void Game::controlsDisplay() {
     //Output turns left in game
@@ -369,23 +1134,44 @@ void Game::interactObject() {
     //Accept/validate integer input from user. Re-prompt if necessary.
     menuSelection = validateInputRangeInt(1, 4);
 
+    interactDirection(menuSelection);
+}
+
+//Return Space object next to player in direction passed (1 up, 2 down, 3 left, 4 right)
+Space* Game::spaceInDirection(int inputDirection) {
+    if (inputDirection == 1) {
+        return currentMap->getUp(player);
+    }
+    else if (inputDirection == 2) {
+        return currentMap->getDown(player);
+    }
+    else if (inputDirection == 3) {
+        return currentMap->getLeft(player);
+    }
+
+    return currentMap->getRight(player);
+}
+
+//Interact with Space object next to player in direction passed (1 up, 2 down, 3 left, 4 right), picking up and
+//removing item objects from map. Used by interactObject once direction is chosen and by real-time mode.
+void Game::interactDirection(int menuSelection) {
     std::string objectName = "";
 
     //If menu selection was for up, attempt to interact with Space object above player
     if (menuSelection == 1) {
 
         //Interact with object
-        player->interactObject(player->getUp());
+        player->interactObject(currentMap->getUp(player));
 
         std::cout << std::endl;
 
         //Check if interaction from player is on an item object, if so item is picked up and is removed from map
-        if (player->getUp()->getIsItem()) {
+        if (currentMap->getUp(player)->getIsItem()) {
 
             //If the item is set to true for picked up, remove item from board
-            if (dynamic_cast<GamePiece*>(player->getUp())->getPickedUp()) {
+            if (dynamic_cast<GamePiece*>(currentMap->getUp(player))->getPickedUp()) {
                 //Remove object that is picked up from map
-                currentMap->removeObject(player->getUp());
+                currentMap->removeObject(currentMap->getUp(player));
             }
         }
     }
@@ -393,16 +1179,16 @@ void Game::interactObject() {
     //If menu selection was for down, attempt to interact with Space object above player
     if (menuSelection == 2) {
         //Interact with object
-        player->interactObject(player->getDown());
+        player->interactObject(currentMap->getDown(player));
 
         std::cout << std::endl;
 
         //Check if interaction from player is on an item object, if so item is picked up and is removed from map
-        if (player->getDown()->getIsItem()) {
+        if (currentMap->getDown(player)->getIsItem()) {
             //If the item is set to true for picked up, remove item from board
-            if (dynamic_cast<GamePiece*>(player->getDown())->getPickedUp()) {
+            if (dynamic_cast<GamePiece*>(currentMap->getDown(player))->getPickedUp()) {
                 //Remove object that is picked up from map
-                currentMap->removeObject(player->getDown());
+                currentMap->removeObject(currentMap->getDown(player));
             }
         }
     }
@@ -410,16 +1196,16 @@ void Game::interactObject() {
     //If menu selection was for left, attempt to interact with Space object above player
     if (menuSelection == 3) {
         //Interact with object
-        player->interactObject(player->getLeft());
+        player->interactObject(currentMap->getLeft(player));
 
         std::cout << std::endl;
 
         //Check if interaction from player is on an item object, if so item is picked up and is removed from map
-        if (player->getLeft()->getIsItem()) {
+        if (currentMap->getLeft(player)->getIsItem()) {
             //If the item is set to true for picked up, remove item from board
-            if (dynamic_cast<GamePiece*>(player->getLeft())->getPickedUp()) {
+            if (dynamic_cast<GamePiece*>(currentMap->getLeft(player))->getPickedUp()) {
                 //Remove object that is picked up from map
-                currentMap->removeObject(player->getLeft());
+                currentMap->removeObject(currentMap->getLeft(player));
             }
         }
     }
@@ -427,16 +1213,16 @@ void Game::interactObject() {
     //If menu selection was for right, attempt to interact with Space object above player
     if (menuSelection == 4) {
         //Interact with object
-        player->interactObject(player->getRight());
+        player->interactObject(currentMap->getRight(player));
 
         std::cout << std::endl;
 
         //Check if interaction from player is on an item object, if so item is picked up and is removed from map
-        if (player->getRight()->getIsItem()) {
+        if (currentMap->getRight(player)->getIsItem()) {
             //If the item is set to true for picked up, remove item from board
-            if (dynamic_cast<GamePiece*>(player->getRight())->getPickedUp()) {
+            if (dynamic_cast<GamePiece*>(currentMap->getRight(player))->getPickedUp()) {
                 //Remove object that is picked up from map
-                currentMap->removeObject(player->getRight());
+                currentMap->removeObject(currentMap->getRight(player));
             }
         }
     }
@@ -449,7 +1235,7 @@ void Game::changeMaps(Space* inputMoveSpace) {
         currentMap->removePlayer(player);
 
         //If player moves to grocery store, change map to grocery and output map description
-        if (inputMoveSpace->getMapName() == "grocery store") {
+        if (inputMoveSpace->getMapId() == MAP_GROCERY_STORE) {
             //Output map description
             groceryStoreDesc();
             std::cout << std::endl;
@@ -459,7 +1245,7 @@ void Game::changeMaps(Space* inputMoveSpace) {
         }
 
         //If player moves through door to outdoors, change map to outdoors
-        else if (inputMoveSpace->getMapName() == "outdoors") {
+        else if (inputMoveSpace->getMapId() == MAP_OUTDOORS) {
             //Output map description
             outdoorDesc();
             std::cout << std::endl;
@@ -469,7 +1255,7 @@ void Game::changeMaps(Space* inputMoveSpace) {
         }
 
         //If player moves through door to outdoor rec supplier, change map to rec supplier
-        else if (inputMoveSpace->getMapName() == "outdoor rec supplier") {
+        else if (inputMoveSpace->getMapId() == MAP_REC_SUPPLIER) {
             //Output map description
             recSupplierDesc();
             std::cout << std::endl;
@@ -479,7 +1265,7 @@ void Game::changeMaps(Space* inputMoveSpace) {
         }
 
         //If player moves through door to field from outdoors, change map to field
-        else if (inputMoveSpace->getMapName() == "field") {
+        else if (inputMoveSpace->getMapId() == MAP_FIELD) {
             //Output map description
             finalFieldDesc();
             std::cout << std::endl;
@@ -488,6 +1274,9 @@ void Game::changeMaps(Space* inputMoveSpace) {
             currentMap = finalMap;
         }
 
+        //Move zombies of new map for turns it skipped while player was elsewhere, before player is in it
+        currentMap->catchUp(&pool);
+
         //Adjust player character position
         player->setRows(inputMoveSpace->getRows());
         player->setCols(inputMoveSpace->getCols());
@@ -496,11 +1285,10 @@ void Game::changeMaps(Space* inputMoveSpace) {
         currentMap->setPlayerLocation(player, player->getRows(), player->getCols());
 
         //If the door starts out closed, set door on other side to open
-        if (currentMap->getCurrentSpace()->getName() == "closed door") {
+        if (currentMap->getCurrentSpace()->getKind() == KIND_DOOR &&
+            currentMap->getCurrentSpace()->getDoorState() == DOOR_CLOSED) {
             //Set door to open on new map
-            currentMap->getCurrentSpace()->setVisual('/');
-            currentMap->getCurrentSpace()->setSolid(false);
-            currentMap->getCurrentSpace()->setName("open door");
+            static_cast<Door*>(currentMap->getCurrentSpace())->openDoor();
         }
 }
 
@@ -508,12 +1296,13 @@ void Game::changeMaps(Space* inputMoveSpace) {
 //Add/link doors between maps on game to allow for traversal between maps within the world.
 void Game::addDoors() {
     //Create door spaces to add to maps
-    Space* outsideGroceryDoor = new Door("outdoors", 15, 0);
-    Space* groceryOutsideDoor = new Door("grocery store", 9, 34);
-    Space* outsideRecSupplier = new Door("outdoors", 4, 0);
-    Space* recSupplierOutside = new Door("outdoor rec supplier", 4, 11);
-    Space* outsideField = new Door("outdoors", 19, 9);
-    Space* fieldOutside = new Door("field", 0, 9);
+    //Each door is created from the arena of map it is added to
+    Space* outsideGroceryDoor = outdoors->create<Door>(MAP_OUTDOORS, 15, 0);
+    Space* groceryOutsideDoor = groceryStore->create<Door>(MAP_GROCERY_STORE, 9, 34);
+    Space* outsideRecSupplier = outdoors->create<Door>(MAP_OUTDOORS, 4, 0);
+    Space* recSupplierOutside = outdoorRecSupplier->create<Door>(MAP_REC_SUPPLIER, 4, 11);
+    Space* outsideField = outdoors->create<Door>(MAP_OUTDOORS, outdoors->getRows() - 1, 9);
+    Space* fieldOutside = finalMap->create<Door>(MAP_FIELD, 0, 9);
 
     //Change visuals of field/outside and set to open and not interactable - Open space entryway
     outsideField->setSolid(false);
@@ -522,8 +1311,8 @@ void Game::addDoors() {
     fieldOutside->setVisual('_');
     outsideField->setInteract(false);
     fieldOutside->setInteract(false);
-    outsideField->setName("open space");
-    fieldOutside->setName("open space");
+    outsideField->setDoorState(DOOR_OPEN_SPACE);
+    fieldOutside->setDoorState(DOOR_OPEN_SPACE);
 
     //Add door spaces to map
     //Doors between grocery and outside
@@ -535,22 +1324,22 @@ void Game::addDoors() {
     outdoorRecSupplier->addSpaceObject(recSupplierOutside, 4, 11);
 
     //Space between outside and field
-    outdoors->addSpaceObject(outsideField, 19, 9);
+    outdoors->addSpaceObject(outsideField, outdoors->getRows() - 1, 9);
     finalMap->addSpaceObject(fieldOutside, 0, 9);
 
 
-    //Set doors to link to other map location
+    //Set doors to link to other map location, reached by moving off the edge of the map from the door
     //Link doors between grocery and outside
-    outsideGroceryDoor->setLeft(groceryOutsideDoor);
-    groceryOutsideDoor->setRight(outsideGroceryDoor);
+    outdoors->linkEdge(15, 0, groceryOutsideDoor);
+    groceryStore->linkEdge(9, 34, outsideGroceryDoor);
 
     //Link doors between rec supplier and outside
-    outsideRecSupplier->setLeft(recSupplierOutside);
-    recSupplierOutside->setRight(outsideRecSupplier);
+    outdoors->linkEdge(4, 0, recSupplierOutside);
+    outdoorRecSupplier->linkEdge(4, 11, outsideRecSupplier);
 
     //Link doors between field and outside
-    outsideField->setDown(fieldOutside);
-    fieldOutside->setUp(outsideField);
+    outdoors->linkEdge(outdoors->getRows() - 1, 9, fieldOutside);
+    finalMap->linkEdge(0, 9, outsideField);
 }
 
 //Allow user to select to start or exit game. Return boolean value for user selection.
@@ -11,20 +11,70 @@
  * outdoorRecSupplier: Map pointer to the outdoor rec supplier map.
  * finalMap: Map pointer to the final map location (Field)
  * player: Player pointer to the player object in game.
- * Functions: Constructor sets up Game object by setting timeToDeath, allocating space for all maps, setting currentMap to outdoors,
- * allocating space to player, place player on currentMap, and call addDoors function to manually add linked doors
- * between maps.
- * Destructor deletes all instances of Map that was dynamically allocated.
+ * random: Seeded Random service that all maps draw from. The same seed plays out the same game.
+ * maps: All maps of world, in the order zombies of each map were originally moved.
+ * pool: ThreadPool that maps are moved on concurrently each turn.
+ * lodInterval: Number of turns maps player is not in skip before their zombies are caught up in one go, 0 to only
+ * catch them up when player enters.
+ * tickRate: Number of times a second world moves in real-time mode, 0 for turn-based play.
+ * render: Whether map is drawn each turn, off when a replay is played headless.
+ * turnsPlayed: Number of turns finished since game was set up, over every game played.
+ * savePath: Save file game is saved to when player exits game, empty to not save.
+ * scenarioRows/scenarioCols/scenarioZombies: Scenario outdoors map was set up with, so that a clone sets up the same.
+ * Functions: Constructor takes seed for Random service and sets up Game object by setting timeToDeath, allocating
+ * space for all maps, setting currentMap to outdoors, allocating space to player, place player on currentMap, and call
+ * addDoors function to manually add linked doors between maps. It may also take a scenario: size of outdoors map and
+ * number of zombies scattered over it on top of the standard ones, and number of worker threads of its thread pool.
+ * Destructor deletes all instances of Map that was dynamically allocated and player.
+ * resetWorld - Reset game to its starting state without rebuilding maps. Each map is restored from an image taken as
+ * it was set up, or set up again in the same memory if image does not fit. Random service is moved on to a new seed
+ * derived from the last one, or to seed passed.
+ * setChaseRadius - Set number of steps from player within which zombies of every map chase player, 0 to wander.
+ * setSightRadius - Set number of cells from player within which zombies of every map may spot player, 0 for none.
+ * setHearing - Set whether zombies of every map are drawn by noise of doors opening, items picked up and knife kills.
+ * setLodInterval - Set number of turns maps player is not in skip before they are caught up, 0 to wait for player.
+ * setTickRate - Set number of times a second world moves in real-time mode, 0 for turn-based play (default).
+ * setRender - Set whether map is drawn each turn.
+ * getTurnsPlayed - Return number of turns finished since game was set up.
+ * stateHash - Return hash of state of world and player, equal for games in the same state.
+ * saveState - Write state of world and player to a Snapshot.
+ * loadState - Set world and player to state read from a Snapshot, in place.
+ * saveGame/loadGame - Save state of game to a save file, or load it from one.
+ * setSavePath - Set save file game is saved to when player exits game.
+ * clone - Return new Game, moving maps on calling thread, holding an independent copy of world and player.
+ * copyFrom - Set world and player to a copy of those of another Game set up with the same scenario, in place.
+ * saveOnExit - Save game to save file, if one is set, as player exits game.
+ * playAgent - Play game to its end with player driven by agent passed in place of movePlayer, with no terminal input.
+ * Returns GameOutcome of game.
+ * playAction - Carry out one action of an agent for player, finishing turn if it took one. Returns false once game
+ * ended.
+ * getCurrentMap/getPlayer/getMaps - Return map player is in, player and all maps of world, for agents that search.
  * runGame - Primary controller for game, runs all menu options and combines functionality. If user starts playing game,
  * menu prints allowing user to reset game when either user elects to quit or game ends due to loss or win.
+ * finishTurn - Move zombies, check player surroundings and count down time left after player acted. Returns false if
+ * game was lost or won.
+ * runRealTime - Run game with world moved tickRate times a second by a fixed timestep scheduler, keys read without
+ * waiting and carried out on next tick. Reports tick timing jitter once game ends.
+ * applyKey - Carry out key pressed in real-time mode.
+ * reportTiming - Output lateness and run time of ticks of a real-time game.
+ * drawCurrentMap - Draw map player is in, unless rendering is off.
+ * moveAllZombies - Move zombies of every map, one task per map on thread pool, except maps moved in two phases which
+ * spread their own zombies across pool. Maps player is not in skip turns and are caught up every lodInterval turns.
+ * Returns once all maps due have moved.
+ * catchUpDue - Return whether map player is not in is caught up this turn.
  * movePlayer - Controller to allow for user selection for player movement on board. Prompts user for input of
  * direction to move and moves player piece in that direction. Returns boolean value for exit game. True to exit,
  * false to keep playing.
+ * takeAction - Carry out one validated control selection, moving player if it was a move. Returns false to exit game.
+ * takeAgentAction - Carry out one action of an agent, as takeAction does for a person. Returns false to exit game.
+ * endOutcome - Return how game ended, once finishTurn returned false.
  * controlsDisplay - Output game controls to terminal for user viewing.
  * interactObject - If player elects to engage with a Space object, function is called to interact with object.
  * Function outputs and accepts/validates direction of object to interact with and performs interaction with object.
+ * spaceInDirection - Return Space object next to player in direction passed.
+ * interactDirection - Interact with Space object next to player in direction passed.
  * changeMaps - If moving through door linked to another map, change map location of player as movement and set player
- * in the new map location. Takes Space pointer as parameter.
+ * in the new map location, after catching up turns the new map skipped. Takes Space pointer as parameter.
  * addDoors - Add/link doors between maps on game to allow for traversal between maps within the world.
  * startMenu - Allow user to select to start or exit game. Return boolean value for user selection.
  * gameDesc - Outputs information/introduction of game and its premise.
@@ -46,6 +96,18 @@
 #include "inputValidation.hpp"
 #include "Field.hpp"
 #include "Door.hpp"
+#include "Random.hpp"
+#include "ThreadPool.hpp"
+#include "Agent.hpp"
+#include "Snapshot.hpp"
+
+//How a game ended: won, player killed, time ran out or player exited game
+enum GameOutcome {
+    OUTCOME_WON,
+    OUTCOME_LOST,
+    OUTCOME_TIMEOUT,
+    OUTCOME_QUIT
+};
 
 class Game {
 private:
@@ -64,6 +126,45 @@ private:
     //Player variable pointer
     Player* player;
 
+    //Seeded Random service that all maps draw from
+    Random random;
+
+    //All maps of world, in the order zombies of each map were originally moved
+    std::vector <Map*> maps;
+
+    //Thread pool that maps are moved on concurrently each turn
+    ThreadPool pool;
+
+    //Number of turns maps player is not in skip before their zombies are caught up in one go, 0 to only catch them up
+    //when player enters. Maps player is not in change only through their own zombies, so the interval changes how
+    //work is spread over turns but never how a map looks when player sees it.
+    unsigned lodInterval;
+
+    //Number of times a second world moves in real-time mode, 0 for turn-based play
+    unsigned tickRate;
+
+    //Whether map is drawn each turn, off when a replay is played headless
+    bool render;
+
+    //Number of turns finished since game was set up, over every game played
+    unsigned long long turnsPlayed;
+
+    //Save file game is saved to when player exits game, empty to not save
+    std::string savePath;
+
+    //Rows/cols and extra zombies of outdoors map as passed to constructor, so that a clone is set up the same
+    int scenarioRows;
+    int scenarioCols;
+    int scenarioZombies;
+
+    //Keys pressed in real-time mode that wait for a tick before more are ignored, and number of ticks world may fall
+    //behind before ticks missed are dropped
+    static const unsigned maxPendingKeys = 4;
+    static const int maxLateTicks = 5;
+
+    //Actions an agent may take in a row that do not take a turn (moves into walls, viewing inventory) before turn is
+    //passed for it, so that an agent stuck against a wall cannot stop game
+    static const unsigned maxIdleActions = 64;
 
     //Output game description to player at start of the game
     void gameDesc();
@@ -85,6 +186,45 @@ private:
     //exit game. True to exit, false to keep playing.
     bool movePlayer();
 
+    //Carry out one control selection (W/S/A/D move, E interact, I inventory, Q exit game) as validated by
+    //validateMove. Takes selection and sets boolean passed to true if player performed an action that takes a turn.
+    //Returns boolean value for exit game. True to exit, false to keep playing.
+    bool takeAction(std::string, bool&);
+
+    //Carry out one action of an agent: E interacts in direction of action, answering whether key is used with action,
+    //and other selections are carried out by takeAction. Sets boolean passed to true if player performed an action
+    //that takes a turn. Returns false to exit game, true to keep playing.
+    bool takeAgentAction(const AgentAction&, bool&);
+
+    //Return how game ended once finishTurn returned false: lost if player was killed, won if player won, otherwise
+    //timed out
+    GameOutcome endOutcome();
+
+    //Finish a turn after player acted: move zombies of all maps, check surroundings of player for zombies and count
+    //down time left. Outputs end of game and returns false if game was lost or won this turn, true to keep playing.
+    bool finishTurn();
+
+    //Run game in real-time mode until it is lost, won or player exits. World is moved by a fixed timestep scheduler
+    //tickRate times a second whether player acts or not. Keys are read from a raw terminal without waiting for Enter
+    //while waiting for next tick, and the oldest key pressed is carried out at start of next tick. Tick timing is
+    //reported once game ends. A replay being played gives the key of each tick instead, without waiting.
+    void runRealTime();
+
+    //Carry out key pressed in real-time mode, same controls as turn-based mode. After E, next key chooses direction
+    //of interaction, and next key after that answers whether key is used on a locked door found (Y/N). Takes key and
+    //what it answers (0 nothing, -1 direction, 1-4 door direction), which is updated. Returns false to exit game.
+    bool applyKey(int, int&);
+
+    //Output timing of ticks of a real-time game: lateness of tick starts (jitter) and run time of ticks, as mean,
+    //median, 99th percentile and worst, and number of ticks dropped. Sorts lateness and run times passed.
+    void reportTiming(std::vector <double>&, std::vector <double>&, unsigned);
+
+    //Draw map player is in, unless rendering is off
+    void drawCurrentMap();
+
+    //Save game to save file, if one is set, as player exits game and tell player it was saved
+    void saveOnExit();
+
     //Output game controls to terminal for user viewing
     void controlsDisplay();
 
@@ -92,22 +232,151 @@ private:
     //and accepts/validates direction of object to interact with and performs interaction with object.
     void interactObject();
 
+    //Return Space object next to player in direction passed (1 up, 2 down, 3 left, 4 right)
+    Space* spaceInDirection(int);
+
+    //Interact with Space object next to player in direction passed (1 up, 2 down, 3 left, 4 right), picking up and
+    //removing item objects from map. Used by interactObject once direction is chosen and by real-time mode.
+    void interactDirection(int);
+
     //If moving through door linked to another map, change map location of player as movement and set player in the new map
-    //location. Takes Space pointer as parameter.
+    //location, after catching up turns the new map skipped. Takes Space pointer as parameter.
     void changeMaps(Space*);
 
     //Add/link doors between maps on game to allow for traversal between maps within the world.
     void addDoors();
 
+    //Move zombies of every map, one task per map on thread pool. Maps share no state while zombies move: zombies only
+    //read their own map and draw from their own random streams, and only the map holding player touches player. So
+    //result is the same as moving maps one after another. Maps moved in two phases spread their own zombies across
+    //pool instead, so they are moved one at a time after the others. Maps player is not in skip the turn instead, and
+    //are caught up once they have skipped lodInterval turns, each map on its own turns. Returns once all maps due have
+    //moved.
+    void moveAllZombies();
+
+    //Return whether map at index of maps, which player is not in, is caught up this turn. A map is caught up every
+    //lodInterval turns it skips, offset by its index so that maps are not all caught up on the same turn.
+    bool catchUpDue(unsigned);
+
 public:
-    //Sets up Game object by setting timeToDeath, allocating space for all maps, setting currentMap to outdoors,
-    //allocating space to player, place player on currentMap, and call addDoors function to manually add linked doors
-    //between maps.
-    Game();
+    //Takes seed for Random service. Sets up Game object by setting timeToDeath, allocating space for all maps, setting
+    //currentMap to outdoors, allocating space to player, place player on currentMap, and call addDoors function to
+    //manually add linked doors between maps. Optionally takes a scenario: rows/cols of outdoors map (standard size when
+    //0 or smaller) and number of zombies scattered over it on top of the standard ones, and number of worker threads of
+    //thread pool maps are moved on (default one per core besides calling thread, 0 to move them on calling thread).
+    explicit Game(uint64_t, int = 0, int = 0, int = 0, unsigned = ThreadPool::defaultWorkers());
 
-    //Free all dynamically allocated memory - deletes all instances of Map that was dynamically allocated.
+    //Free all dynamically allocated memory - deletes all instances of Map that was dynamically allocated and player.
     ~Game();
 
+    //Reset game to its starting state without rebuilding maps. Each map is restored from the image it took when it was
+    //set up, copying its layers and zombies whole, and a new player is placed outdoors. If any map's image does not
+    //fit, every map releases all of its objects at once through its arena, is set up again in the same memory and
+    //takes a new image, and doors are linked again. Random service is moved on to a new seed derived from the last one
+    //so that each game plays out differently.
+    void resetWorld();
+
+    //Reset game to its starting state as above, with seed passed for Random service. World is then the same as a Game
+    //newly set up with that seed.
+    void resetWorld(uint64_t);
+
+    //Set number of steps from player within which zombies of every map chase player, 0 (default) for zombies to wander
+    //at random. Kept when world is reset.
+    void setChaseRadius(int);
+
+    //Set number of cells from player within which zombies of every map may spot player and head for where they saw
+    //player, 0 (default) for none. Kept when world is reset.
+    void setSightRadius(int);
+
+    //Set whether zombies of every map are drawn by noise of doors opening, items picked up and knife kills, off by
+    //default. Kept when world is reset.
+    void setHearing(bool);
+
+    //Set number of turns maps player is not in skip before their zombies are caught up in one go (default
+    //defaultLodInterval). 1 moves every map every turn, 0 only catches a map up when player enters it. Game plays out
+    //the same for any interval.
+    void setLodInterval(unsigned);
+
+    //Default number of turns maps player is not in skip before they are caught up
+    static const unsigned defaultLodInterval = 8;
+
+    //Set number of times a second world moves in real-time mode, up to maxTickRate. 0 (default) for turn-based play
+    //in which world moves once per player action. Kept when world is reset.
+    void setTickRate(unsigned);
+
+    //Fastest tick rate of real-time mode
+    static const unsigned maxTickRate = 1000;
+
+    //Set whether map is drawn each turn, on by default. Turned off to play a replay headless, where drawing is most
+    //of the time a turn takes.
+    void setRender(bool);
+
+    //Return number of turns finished since game was set up, over every game played
+    unsigned long long getTurnsPlayed();
+
+    //Return hash of state of world and player: every map (see Map::stateHash), map player is in, player location,
+    //whether player is alive or has won, time left and seed of Random service. Equal for games in the same state, so
+    //a replay can be checked to end the same as the session it recorded.
+    uint64_t stateHash();
+
+    //Write state of world and player to snapshot passed: seed of Random service, time left, turns played, map player is
+    //in, player location, status and items, then state of every map (see Map::saveState). Options such as chase radius
+    //are not part of state and are kept as set.
+    void saveState(Snapshot&);
+
+    //Set world and player to state read from snapshot passed, as written by saveState of a Game set up with the same
+    //scenario size. Maps are loaded in place rather than built again. Returns false if snapshot does not hold a state
+    //of this world, and world is then reset to its starting state.
+    bool loadState(Snapshot&);
+
+    //Save state of game to save file at path passed. Save file is a 4 byte magic "ZSAV" and a version byte followed by
+    //state as written by saveState. Returns false if file could not be written.
+    bool saveGame(const std::string&);
+
+    //Load state of game from save file at path passed. Returns false if file could not be read or is not a save of a
+    //version this game loads, leaving game as it was, or if it is not a save of this world, and world is then reset to
+    //its starting state.
+    bool loadGame(const std::string&);
+
+    //Set save file game is saved to when player exits game (Q), empty (default) to not save
+    void setSavePath(const std::string&);
+
+    //Return new Game holding an independent copy of world and player of this game, for search and what-if play. Clone
+    //is set up with the same seed and scenario, with no worker threads so that many clones can be played at once, and
+    //then copies this game through copyFrom. Caller owns clone and deletes it.
+    Game* clone();
+
+    //Set world and player to a copy of those of game passed, which was set up with the same scenario: every map is
+    //copied through Map::copyFrom, in place, and player is given the location, status and items of its player. Seed,
+    //time left, turns played and options (chase and sight radius, hearing, level of detail interval) are copied, while
+    //tick rate, rendering and save file are kept. Game passed is only read, so several games may copy it at once.
+    //Copying a game between turns, its zombies move as they would in it, except that zombies heading for a goal may
+    //take another shortest path of the same length as cached paths are not copied. Returns false if game passed is of
+    //another scenario, and world is then reset to its starting state.
+    bool copyFrom(Game&);
+
+    //Play game to its end with player driven by agent passed in place of movePlayer: each turn agent chooses an action
+    //with the same controls as a person, then world moves as in turn-based play. Nothing is read from terminal and
+    //game output still goes to standard output. Takes agent, which is started with seed of game, and list that
+    //milliseconds each turn took (agent choosing, player acting and world moving) are added to, or nullptr. Returns
+    //how game ended.
+    GameOutcome playAgent(Agent&, std::vector <double>*);
+
+    //Carry out one action of an agent for player, as playAgent does, then finish turn (move world) if action took a
+    //turn. An action that does not take a turn, such as moving through a door into another map, leaves world as it
+    //is, like playAgent asking agent again. Used by agents that search by playing actions out on copies of a game.
+    //Takes action and outcome set once game ends. Returns false once game ended, true to keep playing.
+    bool playAction(const AgentAction&, GameOutcome&);
+
+    //Return map player is in
+    Map* getCurrentMap();
+
+    //Return player of game
+    Player* getPlayer();
+
+    //Return all maps of world, in the order zombies of each map are moved
+    const std::vector <Map*>& getMaps();
+
     //Primary controller for game, runs all menu options and combines functionality. Returns boolean value fo true while
     //game is running, allowing for loop of gameplay while resetting game.
     void runGame();
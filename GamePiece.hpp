@@ -8,10 +8,10 @@
  * pickedUp - boolean value specific to GamePiece that is set to false initially to indicate that item is not picked
  * up. Set to to true once item is picked up from map by player.
  * Functions: Class has two constructors: Constructor to set up object attributes primarily for items that can be
- * interacted with. Takes string value for name of object, char for visualization, and row/column of object to be on
+ * interacted with. Takes SpaceKind of object, char for visualization, and row/column of object to be on
  * map. objectPassable and interactable static const values are passed to Space class for creation.
  * Constructor to set up object or player attributes - Takes char for visualization on board, row/col of object on
- * board, string for name of object, and passes all values to Space class for object creation.
+ * board, SpaceKind of object, and passes all values to Space class for object creation.
  * Default Destructor
  * interactObject - Game piece/item object interaction - If interaction is available for object, perform interaction.
  * This is abstract virtual function for all Space type objects.  Non-interactable objects describe what is seen while
@@ -36,14 +36,14 @@ private:
     bool pickedUp = false;
 
 public:
-    //Constructor to set up object attributes primarily for items that can be interacted with. Takes string value
-    //for name of object, char for visualization, and row/column of object to be on map. objectPassable and interactable
+    //Constructor to set up object attributes primarily for items that can be interacted with. Takes SpaceKind
+    //of object, char for visualization, and row/column of object to be on map. objectPassable and interactable
     //static const values are passed to Space class for creation.
-    GamePiece(std::string, char, int, int);
+    GamePiece(SpaceKind, char, int, int);
 
     //Constructor to set up object or player attributes - Takes char for visualization on board, row/col of object on board,
-    //string for name of object, and passes all values to Space class for object creation.
-    GamePiece(char, int, int, std::string);
+    //SpaceKind of object, and passes all values to Space class for object creation.
+    GamePiece(char, int, int, SpaceKind);
 
     //Default Destructor
     ~GamePiece();
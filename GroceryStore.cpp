@@ -5,28 +5,23 @@
  * map in game, which is used as the map location of the pharmacy and locked up medication required for game win.
  * Variables: Integer variables for rows/cols of map size and startingRow/startingColumn (if needed for map) of player
  * when placed on map.
- * Functions: Constructor takes string for name of map and passes the four integer values to the Map class constructor
- * for map size and starting player location. Calls mapSetup to setup map objects.
- * Field destructor destroys all zombies associated with zombies vector to free memory.
+ * Functions: Constructor takes string for name of map and Random service of game, and passes the four integer values to
+ * the Map class constructor for map size and starting player location along with Random service. Calls mapSetup to
+ * setup map objects.
  * mapSetup - Sets up the grocery store map by adding zombies and objects/items needed in the map.
 */
 
 #include "GroceryStore.hpp"
 
-//Primary constructor for grocery store map area - Constructor takes string for name of map and passes the four
-//integer values to the Map class constructor for map size and starting player location. Calls mapSetup.
-GroceryStore::GroceryStore(std::string inputName) : Map(inputName, rows, cols, startingRow, startingCol) {
+//Primary constructor for grocery store map area - Constructor takes string for name of map and Random service of game
+//and passes the four integer values to the Map class constructor for map size and starting player location. Calls
+//mapSetup.
+GroceryStore::GroceryStore(std::string inputName, Random* inputRandom) :
+        Map(inputName, rows, cols, startingRow, startingCol, inputRandom) {
     mapSetup();
 }
 
 
-//Destructor for grocery store map
-GroceryStore::~GroceryStore() {
-    for (unsigned count = 0; count < zombies.size(); count++) {
-        delete zombies[count]->getCurrentSpace();
-    }
-}
-
 //Set up grocery store map - Add in all doors/items as necessary and adds zombies/objects/items needed in map.
 //Such as medication for game win.
 void GroceryStore::mapSetup() {
@@ -34,81 +29,59 @@ void GroceryStore::mapSetup() {
     //Add column 6 shelves
     for (int row = 2; row < rows; row++) {
         if (row != 6 && row < 11) {
-            Space* newWall = new Wall();
-
-            newWall->setName("shelf");
-
-            addSpaceObject(newWall, row, 6);
+            setTerrain(row, 6, TERRAIN_SHELF);
         }
     }
 
     //Add column 12 shelves
     for (int row = 2; row < rows; row++) {
         if (row != 6 && row < 11) {
-            Space* newWall = new Wall();
-
-            newWall->setName("shelf");
-
-            addSpaceObject(newWall, row, 12);
+            setTerrain(row, 12, TERRAIN_SHELF);
         }
     }
 
     //Add column 18 shelves
     for (int row = 2; row < rows; row++) {
         if (row != 6 && row < 11) {
-            Space* newWall = new Wall();
-
-            newWall->setName("shelf");
-
-            addSpaceObject(newWall, row, 18);
+            setTerrain(row, 18, TERRAIN_SHELF);
         }
     }
 
     //add column 24 shelves
     for (int row = 2; row < rows; row++) {
         if (row != 6 && row < 11) {
-            Space* newWall = new Wall();
-
-            newWall->setName("shelf");
-
-            addSpaceObject(newWall, row, 24);
+            setTerrain(row, 24, TERRAIN_SHELF);
         }
     }
 
     //Add additional wall units to make one wall into a locked "pharmacy" to hold medication
-    addSpaceObject(new Wall(), 5, 5);
-    addSpaceObject(new Wall(), 5, 4);
-    addSpaceObject(new Wall(), 5, 3);
-    addSpaceObject(new Wall(), 5, 2);
-    addSpaceObject(new Wall(), 5, 1);
+    setTerrain(5, 5, TERRAIN_WALL);
+    setTerrain(5, 4, TERRAIN_WALL);
+    setTerrain(5, 3, TERRAIN_WALL);
+    setTerrain(5, 2, TERRAIN_WALL);
+    setTerrain(5, 1, TERRAIN_WALL);
 
     //Add locked door to "pharmacy"
-    Space* lockedDoor = new Door("grocery store", 1, 6);
-    dynamic_cast<Door*>(lockedDoor)->setName("locked door");
+    Space* lockedDoor = create<Door>(MAP_GROCERY_STORE, 1, 6);
     dynamic_cast<Door*>(lockedDoor)->setLocked(true);
     addSpaceObject(lockedDoor, 1, 6);
 
 
     //Add register counters (col 30/31)
-    addSpaceObject(new Wall(), 3, 30);
-    addSpaceObject(new Wall(), 3, 31);
-    addSpaceObject(new Wall(), 5, 30);
-    addSpaceObject(new Wall(), 5, 31);
-    addSpaceObject(new Wall(), 7, 30);
-    addSpaceObject(new Wall(), 7, 31);
+    setTerrain(3, 30, TERRAIN_WALL);
+    setTerrain(3, 31, TERRAIN_WALL);
+    setTerrain(5, 30, TERRAIN_WALL);
+    setTerrain(5, 31, TERRAIN_WALL);
+    setTerrain(7, 30, TERRAIN_WALL);
+    setTerrain(7, 31, TERRAIN_WALL);
 
 
     //Add items to map
-    addSpaceObject(new Medicine(3, 5), 3, 5);
-
-    //Add zombies to vector container
-    zombies.push_back(new Zombie("zombie", 1, 15));
-    zombies.push_back(new Zombie("zombie", 9, 10));
-    zombies.push_back(new Zombie("zombie", 8, 3));
+    addSpaceObject(create<Medicine>(3, 5), 3, 5);
 
     //Add zombies to map
-    setZombieLocation(zombies[0]);
-    setZombieLocation(zombies[1]);
-    setZombieLocation(zombies[2]);
+    addZombie(1, 15);
+    addZombie(9, 10);
+    addZombie(8, 3);
 }
 
@@ -5,9 +5,9 @@
  * map in game, which is used as the map location of the pharmacy and locked up medication required for game win.
  * Variables: Integer variables for rows/cols of map size and startingRow/startingColumn (if needed for map) of player
  * when placed on map.
- * Functions: Constructor takes string for name of map and passes the four integer values to the Map class constructor
- * for map size and starting player location. Calls mapSetup to setup map objects.
- * Field destructor destroys all zombies associated with zombies vector to free memory.
+ * Functions: Constructor takes string for name of map and Random service of game, and passes the four integer values to
+ * the Map class constructor for map size and starting player location along with Random service. Calls mapSetup to
+ * setup map objects.
  * mapSetup - Sets up the grocery store map by adding zombies and objects/items needed in the map.
 */
 
@@ -25,12 +25,10 @@ private:
                      startingRow = 9,
                      startingCol = 34;
 public:
-    //Primary constructor for grocery store map area - Constructor takes string for name of map and passes the four
-    //integer values to the Map class constructor for map size and starting player location. Calls mapSetup.
-    GroceryStore(std::string);
-
-    //Destructor for grocery store map to free allocated memory
-    ~GroceryStore();
+    //Primary constructor for grocery store map area - Constructor takes string for name of map and Random service of
+    //game and passes the four integer values to the Map class constructor for map size and starting player location.
+    //Calls mapSetup.
+    GroceryStore(std::string, Random*);
 
     //Set up grocery store map - Add in all doors/items as necessary and adds zombies/objects/items needed in map.
     //Such as medication for game win.
@@ -5,7 +5,7 @@
  * the key to open the door for the pharmacy in game to retrieve the medication.
  * Variables: keyVisual - static const char for visualization of key on map.
  * Functions: Constructor for Key class takes two int values as parameters to represent location of row/col of key and
- * passes both integers to GamePiece constructor, as well as string value for "key" and the char visualization from
+ * passes both integers to GamePiece constructor, as well as KIND_KEY and the char visualization from
  * static const of key object. Sets isItem to true.
  * Default destructor for Key class.
  * interactObject - Overridden function from abstract Space class. For key class, this function prints a string output
@@ -25,7 +25,7 @@ private:
 
 public:
     //Constructor for Key class takes two int values as parameters to represent location of row/col of key and passes
-    //both integers to GamePiece constructor, as well as string value for "key" and the char visualization from static const
+    //both integers to GamePiece constructor, as well as KIND_KEY and the char visualization from static const
     //of key object. Sets isItem to true.
     Key(int, int);
 
@@ -6,7 +6,7 @@
  * defense.
  * Variables: knifeVisual - static const char for visualization of knife on map.
  * Functions: Constructor for Knife class takes two int values as parameters to represent location of row/col of knife and
- * passes both integers to GamePiece constructor, as well as string value for "knife" and the char visualization from
+ * passes both integers to GamePiece constructor, as well as KIND_KNIFE and the char visualization from
  * static const of knife object. Sets isItem to true.
  * Default destructor for Knife class.
  * interactObject - Overridden function from abstract Space class. For knife class, this function prints a string output
@@ -26,7 +26,7 @@ private:
 
 public:
     //Constructor for Knife class takes two int values as parameters to represent location of row/col of knife and
-    //passes both integers to GamePiece constructor, as well as string value for "knife" and the char visualization from
+    //passes both integers to GamePiece constructor, as well as KIND_KNIFE and the char visualization from
     //static const of knife object. Sets isItem to true.
     Knife(int, int);
 
@@ -4,47 +4,190 @@
  * Description: Map class is the abstract parent class of all Map types in game such as outdoors, field, etc... Class
  * sets up the basic framework of all maps and fine details (anything within walls) are initiated by child classes.
  * Doors leading between maps are created and initialized by Game class.
+ * Tiles are stored in two layers. The terrain layer holds one TerrainKind byte per cell in row-major order. Floors,
+ * walls and shelves are identical everywhere, so those cells all share one immutable prototype object per kind. Cells
+ * marked TERRAIN_OBJECT hold a stateful Space (door, item, exit point) found in the tileObjects layer. Player and
+ * zombies never replace terrain, they are tracked in a separate occupancy layer holding one EntityId per cell, so a move
+ * only rewrites two entries of occupancy and "is there a zombie here" is a single array read. Occupancy is the grid
+ * index of entity positions: zombies next to the player are found by reading the four cells around the player, never by
+ * looking at every zombie. For queries over a radius, the map also counts zombies in each square bucket of cells, kept
+ * up to date as zombies step between buckets, so that buckets with no zombies are skipped without reading their cells.
+ * Zombies killed during a turn are only marked dead and taken off the map, then removed from the zombie arrays together
+ * once the turn's loop is done by moving the last zombie into each dead zombie's index, so a death costs the same
+ * however many zombies there are and every other zombie is still looked at that turn. As indices change, zombies are
+ * referred to from outside the map by ZombieHandle (getZombieHandle/findZombie), which is found stale once a zombie is
+ * killed.
+ * Zombies move in one of two modes. In order (the default) each zombie sees moves of zombies before it. In two phases
+ * every zombie first proposes a move against the map as it was at start of turn, then conflicts are resolved by a fixed
+ * rule: a zombie may only step into a cell that was free at start of turn (never into player or another zombie, even
+ * one moving away) and when several zombies target one cell the zombie of lowest index takes it. Both phases run over
+ * ranges of zombies on a thread pool and give the same result for any number of threads.
+ * While the player is not in a map nothing but its own zombies changes it, and each zombie draws from its own random
+ * stream, so moving a map later gives the same result as moving it on time. A map may skip turns (skipTurn) and have
+ * them made up in bulk by catchUp before it is next looked at, which is how Game moves maps player is not in.
+ * Zombies wander at random unless the map is given a chase radius. Then every zombie within that many steps of the
+ * player follows a FlowField built from the player location, shared by all zombies of map. Field is only built again
+ * when the player moves or a tile change can change its distances, which the map hears about through setTile and doors
+ * through tileChanged.
+ * A zombie may also be given a goal cell to head for, such as a noise. Its steps are worked out by the map Pathfinder
+ * along a shortest path, cached so that zombies do not search again every turn. Cached paths are dropped whenever a
+ * cell changes between floor and blocked, which for items and doors happens in addSpaceObject and removeObject.
+ * Given a sight radius, zombies also spot the player from further away: every turn, zombies within sight radius whose
+ * cell the player can see (walls, shelves and closed doors block sight) are given the player's cell as goal, so they
+ * head for where they last saw the player. What can be seen from a cell is cached by a SightTable, so spotting costs a
+ * bit test per zombie near the player and views are only cast again when a door opens or closes.
+ * Once told to hear noises, zombies are also drawn by noise: opening a door, picking up an item and a knife kill each
+ * make a noise through makeNoise. Noises of a turn are spread together by a NoiseField at start of next move, and
+ * every zombie in a floor cell the noise reaches is given the cell of the loudest noise it hears as goal. Sight is
+ * worked out after noise, so a zombie that both hears a noise and sees the player heads for the player.
+ * Stateful Space objects are created from an Arena owned by the map through create, so resetMap releases all of them
+ * at once and rebuilds the map in the same memory. Zombies are not objects, their state is held in parallel arrays by
+ * a ZombieSwarm and every zombie cell returns one shared immutable Zombie.
+ * Spaces surrounding a location are computed from row/col through getUp/getDown/getLeft/getRight, so moving a piece
+ * only updates the tile it leaves and the tile it enters. Off the edge of the map, a cell may be linked to a Space in
+ * another map (doors between maps) through edgeLinks.
  * Variables: Integer variables for rows/cols of map size and startingRow/startingColumn of player when placed on map
+ * terrain - TerrainKind byte for each cell of map. tileObjects - stateful Space objects keyed by tileIndex.
+ * occupancy - EntityId for each cell of map. mapPlayer - Player pointer while player is in map, otherwise nullptr.
+ * terrainPrototypes - shared Floor/Wall/shelf objects returned for terrain cells.
+ * edgeLinks - Spaces in other maps reached by moving off the edge of the map from a cell, keyed by tileIndex.
+ * zombies - ZombieSwarm holding state of all zombies of map. zombiePrototype - shared Zombie returned for zombie cells.
+ * arena - Arena that all stateful Space objects of map, and nodes of tileObjects and edgeLinks, are created from.
+ * mapRandom - Random service of game that zombies of map draw from. streamBase - First random stream id of map, derived
+ * from map name. zombieStreams - Number of random streams given to zombies of map since setup.
+ * moveMode - ZombieMoveMode used by moveZombies. claims - Lowest index of zombie claiming each cell in a two phase
+ * move, or unclaimed. Only allocated once map is moved in two phases. flowField - FlowField zombies chase player along.
+ * pathfinder - Pathfinder that paths of zombies to their goals, and findPath, are found through.
+ * zombieBuckets - Number of zombies in each bucketSize by bucketSize block of cells, in row-major order of blocks.
+ * bucketCols - Number of blocks across map. sightTable - SightTable player's view is cast and cached by.
+ * sightedZombies - Zombies within sight radius of player, kept between turns. sightSlack - Steps from player within
+ * which a zombie that sees player keeps the cell it last saw player in as goal. noiseField - NoiseField noises made
+ * on map are spread by. hearing - Whether zombies of map are drawn by noise. skippedTurns - Number of turns zombies of
+ * map were not moved, to be moved later by catchUp.
+ * terrainImage/occupancyImage/zombiesImage/bucketImage/objectImageCells/objectImageKinds/objectImageStates/
+ * streamsImage - Image of map as it was set up, restored by restoreImage. imageTaken - Whether an image was taken.
+ * setupDrawsRandom - Whether mapSetup drew from Random service. imageSeed - Seed image was taken with.
+ * imageArenaBytes - Bytes arena held when image was taken.
  * Functions: Declare map size and name and player starting location for map declaration. Sets up initial details for
- * all maps. Takes string value for name of map and int values for row/col of map size and row/col of starting location
- * of player if player is initially started in that map at start of game. Sets pointers to nullptr and calls
- * initializeMap to create outline of map with walls and floor spaces.
- * Destructor frees all dynamically allocated memory of Map class that is currently within the mapTiles array at end of
- * game, as well ass the playerOccupiedSpace pointer. Zombies are deleted in child classes.
- * initializeMap - Initialize map according to size and layout provided as filled with floor spaces that are surrounded
- * by walls. Pointers for each space are assigned through setSpacePtrs.
- * setSpacePtrs - Set directional space pointers for each space. Takes Space** as the space to set pointers for and the
- * row/col location of that space as parameters. Sets all surrounding spaces to point to space passed to function.
+ * all maps. Takes string value for name of map, int values for row/col of map size and row/col of starting location of
+ * player if player is initially started in that map at start of game, and Random service of game. Sets pointers to
+ * nullptr and calls initializeMap to create outline of map with walls and floor spaces.
+ * Destructor frees all stateful Space objects of map through its arena. Player is owned by Game class.
+ * resetMap - Release all stateful Space objects and zombies at once and set map up again from scratch.
+ * create - Construct Space of type given in map arena from constructor arguments passed and return pointer to it.
+ * initializeMap - Initialize map according to size and layout provided as filled with floor terrain that is surrounded
+ * by wall terrain.
+ * setTile - Place Space at row/col. Terrain prototypes set the terrain byte, all other Spaces go in tileObjects.
+ * prototypeKind - Return TerrainKind of a shared terrain prototype, or TERRAIN_OBJECT for any other Space.
  * drawMap - Output visualization of map by character representations of all Space objects
- * removeZombie - Remove zombie passed as parameter to function from board. Does not delete zombie, but removes from map.
- * setZombieLocation - Set zombie passed as parameter on board for visualization.
- * removePlayer - Remove player from board and replace space that player was on with previous space.
- * setPlayerLocation - Set player on board and save location that player is moving to in a temporary holder. Takes
- * Player pointer address as parameter and two int values indicating row/col that player is about to move to.
- * addSpaceObject - Add Space type to location on map and link surrounding pointers. Takes Space object pointer and
- * int values for location of object in map space as parameters. Calls setSpacePtrs to set surrounding objects to point
- * to Space being added.
+ * removeZombie - Remove zombie at index of zombies from occupancy layer. Does not delete zombie.
+ * setZombieLocation - Set zombie at index of zombies in occupancy layer at zombie row/col.
+ * stepZombie - Commit proposal of zombie at index of zombies, moving it in occupancy layer and zombie buckets.
+ * bucketOf - Return zombie bucket row/col location is in.
+ * playerNeighbors - Return indices of zombies next to player, in zombie order.
+ * killZombie - Kill zombie at index of zombies, removing it from map. It is removed from zombies by removeDeadZombies.
+ * removeDeadZombies - Remove all zombies killed from zombies, each by moving last zombie into its index.
+ * addZombie - Add zombie at row/col with next random stream of map and place it on map. Used by child classes in
+ * mapSetup.
+ * addRandomZombies - Add number of zombies passed on free floor cells drawn at random, away from player start. Used by
+ * child classes in mapSetup for scenario worlds.
+ * getRandom - Return Random service of game that zombies of map draw from.
+ * removePlayer - Remove player from occupancy layer of board.
+ * setPlayerLocation - Set player in occupancy layer of board at row/col. Takes Player pointer address as parameter and
+ * two int values indicating row/col that player is about to move to.
+ * addSpaceObject - Add Space type to location on map. Takes Space object pointer (created through create) and int
+ * values for location of object in map space as parameters. Doors are told map they are in.
+ * linkEdge - Link cell at row/col to a Space in another map, reached by moving off the edge of the map from that cell.
+ * getEdgeLink - Return Space linked to cell at row/col off the edge of the map, or nullptr if there is none.
+ * getUp/getDown/getLeft/getRight - Return Space (see getSpace) above/below/left/right of row/col location or of Space
+ * passed.
+ * setTerrain - Set terrain kind of row/col location, freeing any stateful Space that was there.
+ * getTile - Return Space pointer for terrain tile at row/col location in map, ignoring any player/zombie on it.
+ * getSpace - Return Space at row/col as seen by pieces: player/zombie occupying cell, otherwise terrain tile.
+ * getEntity - Return player or zombie Space pointer for EntityId.
+ * isZombieAt/isPlayerAt - Return whether a zombie/the player occupies row/col.
+ * getRows - Return number of rows in map
+ * getCols - Return number of cols in map
+ * tileIndex - Return position of row/col location within the contiguous row-major tile store.
  * getStartRow - Return integer value for starting row for player object
  * getStartCol - Return integer value for starting col for player object
- * getCurrentSpace - Return Space pointer for current player occupied space
+ * getCurrentSpace - Return Space pointer for terrain tile player is standing on
  * mapSetup - Default map setup function for abstract virtual function (no action) - Child class map types set up map
  * using overridden function.
- * removeObject - Remove/replace item object in map after pick up with Floor space. Takes Space pointer for object
- * being removed.
- * moveZombies - Move zombies around map. Activate zombie movement function for each zombie on map while looping through
- * vector. Zombies are removed from map, new locations are determined through Zombie class, and zombies are moved. If
- * zombie attacks player but player has a knife, zombie dies and is removed from game.
+ * removeObject - Remove/replace item object in map after pick up with floor terrain, making a noise. Takes Space
+ * pointer for object being removed.
+ * moveZombies - Move zombies around map. Moves of all zombies are proposed at once by the ZombieSwarm move kernel, then
+ * committed according to move mode of map. If zombie attacks player but player has a knife, zombie dies and is removed
+ * from game. Takes ThreadPool that two phase moves are spread across, or nullptr to move on calling thread.
+ * skipTurn - Count a turn zombies of map were not moved, to be moved later by catchUp.
+ * getSkippedTurns - Return number of turns skipped since zombies of map were last caught up.
+ * catchUp - Move zombies of map once for every turn skipped.
+ * moveZombiesInOrder - Commit proposals in zombie order: each zombie steps into its target cell if no zombie moved
+ * there before it.
+ * moveZombiesTwoPhase - Propose and commit in two phases over ranges of zombies on thread pool, resolving conflicts by
+ * the two phase rule.
+ * runZombieRanges - Run function passed over ranges of zombies covering all zombies, on thread pool if given.
+ * setZombieGoal - Set cell zombie at index of zombies heads for.
+ * steerZombies - Work out next step of every zombie that has a goal, dropping goals reached or out of reach.
+ * findPath - Find shortest path zombies could walk from one row/col location to another.
+ * zombiesNear - Return indices of zombies within a number of rows and columns of row/col location.
+ * getZombieHandle - Return handle of zombie at index of zombies, which stays valid while zombie changes index.
+ * findZombie - Return index of zombie a handle refers to, or -1 if zombie has been killed since.
+ * stateHash - Return hash of everything about map that can change during a game, equal for maps in the same state.
+ * saveState - Write everything about map that can change during a game to a Snapshot: terrain packed two bits a cell,
+ * stateful objects, zombies and turns skipped.
+ * loadState - Set map to state read from a Snapshot written by saveState, in place.
+ * captureImage - Take image of map as it is now set up, for restoreImage.
+ * restoreImage - Set map back to image taken by captureImage with whole copies of its layers and zombies, in place of
+ * setting it up again. Returns false if image does not fit, and map must then be reset.
+ * arenaOutgrown - Return whether items created again have grown arena so that map must be reset.
+ * copyFrom - Set map to state and options of another map of the same size and layout, copying layers and zombies whole.
+ * listObjectCells - Fill list with tileIndex of every stateful object, in order.
+ * freeStrayObjects - Free objects whose cell is no longer an object cell of terrain layer.
+ * placeObject - Give object at cell passed kind and door state passed, creating it again if it is missing.
+ * invalidateCaches - Drop flow field, cached paths and views and noises, worked out again from map on next move.
+ * setMoveMode/getMoveMode - Set/return ZombieMoveMode of map.
+ * setChaseRadius/getChaseRadius - Set/return number of steps from player within which zombies chase, 0 to wander.
+ * setSightRadius/getSightRadius - Set/return number of cells from player within which zombies may spot player, 0 for
+ * none.
+ * canSee - Return whether one row/col location can be seen from another within sight radius.
+ * blocksSight - Return whether cell blocks sight: walls, shelves and closed doors.
+ * fillSight - Size SightTable to map and mark every cell that blocks sight.
+ * spotPlayer - Give every zombie that sees player the player's cell as goal, unless it saw player close by already.
+ * setHearing/getHearing - Set/return whether zombies of map are drawn by noise.
+ * makeNoise - Make noise of loudness passed at row/col, heard by zombies at start of next move.
+ * hearNoise - Spread noises made since last move and give every zombie reached the cell of the noise it hears as goal.
+ * tileChanged - Tell map that Space at row/col changed state, so flow field is built again if that can change it.
  * checkZombies - Check surroundings around player for zombie. If zombie is present, player is attacked. Player pointer
- * is passed as parameter to check around up, down, left, right spaces from player.
+ * is passed as parameter to check around up, down, left, right spaces from player, found through occupancy layer.
 */
 
+#include <algorithm>
+#include <cstdlib>
 #include "Map.hpp"
+#include "Key.hpp"
+#include "Knife.hpp"
+#include "Medicine.hpp"
+#include "ExitPoint.hpp"
+
+//Shared terrain prototypes. Every floor, wall and shelf cell of every map returns one of these from getTile.
+static Floor floorPrototype;
+static Wall wallPrototype;
+static Wall shelfPrototype(KIND_SHELF);
+
+//Shared immutable prototype for each terrain kind, indexed by TerrainKind
+Space* const Map::terrainPrototypes[TERRAIN_OBJECT] = {&floorPrototype, &wallPrototype, &shelfPrototype};
+
+//Shared zombie. Every zombie cell of every map returns it from getSpace, zombie state is held by ZombieSwarm.
+static Zombie sharedZombie;
+Space* const Map::zombiePrototype = &sharedZombie;
 
 //Declare map size and name and player starting location for map declaration. Sets up initial details for all maps.
-//Takes string value for name of map and int values for row/col of map size and row/col of starting location of player
-//if player is initially started in that map at start of game. Sets pointers to nullptr and calls initializeMap to
-//create outline of map with walls and floor spaces.
-Map::Map(std::string inputName, int inputRow, int inputCol, int startingRow, int startingCol) {
+//Takes string value for name of map, int values for row/col of map size and row/col of starting location of player
+//if player is initially started in that map at start of game, and Random service of game. Sets pointers to nullptr
+//and calls initializeMap to create outline of map with walls and floor spaces.
+Map::Map(std::string inputName, int inputRow, int inputCol, int startingRow, int startingCol, Random* inputRandom) :
+        tileObjects(SpaceTable::allocator_type(arena)), edgeLinks(SpaceTable::allocator_type(arena)) {
     //Set map name and size of map
     mapName = inputName;
     rows = inputRow;
@@ -54,103 +197,131 @@ Map::Map(std::string inputName, int inputRow, int inputCol, int startingRow, int
     startRow = startingRow;
     startCol = startingCol;
 
-    //Set map space pointer to null
-    mapTiles = nullptr;
+    //Player is not in map until placed
+    mapPlayer = nullptr;
+
+    //Zombies of map draw from their own streams of game Random service, numbered from a base unique to map name
+    mapRandom = inputRandom;
+    streamBase = Random::nameStream(mapName);
+    zombieStreams = 0;
+
+    //Zombies move in order unless map is set to two phase moves
+    moveMode = MOVE_IN_ORDER;
 
-    //Set player occupied space to nullptr
-    playerOccupiedSpace = nullptr;
+    //Map is moved on time until it skips a turn
+    skippedTurns = 0;
+
+    //No image is taken until map is set up and Game asks for one
+    streamsImage = 0;
+    imageTaken = false;
+    setupDrawsRandom = false;
+    imageSeed = 0;
+    imageArenaBytes = 0;
+
+    //Zombies are not drawn by noise unless map is told to hear it
+    hearing = false;
 
     //Initialize map with basic walls and spaces
     initializeMap();
 }
 
-//Destructor frees all dynamically allocated memory of Map class that is currently within the mapTiles array at end
-//of game, as well ass the playerOccupiedSpace pointer. Zombies are deleted in child classes.
-Map::~Map() {
-    //Free all memory allocated to individual tile spaces
-    for (int row = 0; row < rows; row++) {
-        for (int col = 0; col < cols; col++) {
-                delete mapTiles[row][col];
-        }
+//Destructor frees all stateful Space objects of map through its arena. Player is owned by Game class.
+Map::~Map() {}
 
-        //Delete second pointer for start of array
-        delete[] mapTiles[row];
-    }
+//Release all stateful Space objects and zombies at once and set map up again from scratch through initializeMap
+//and mapSetup. Edge links to other maps and player are removed, Game links doors and places player again.
+void Map::resetMap() {
+    //Drop all pointers into arena before releasing it. Tables are swapped with empty ones rather than cleared, as
+    //their bucket arrays are in arena memory too.
+    SpaceTable(SpaceTable::allocator_type(arena)).swap(tileObjects);
+    SpaceTable(SpaceTable::allocator_type(arena)).swap(edgeLinks);
+    zombies.clear();
+    mapPlayer = nullptr;
+
+    //Zombies created by mapSetup again take same streams as at first setup, and turns skipped by old zombies are gone
+    zombieStreams = 0;
+    skippedTurns = 0;
+    setupDrawsRandom = false;
+
+    //Whole terrain layer is set up again, so flow field is rebuilt on next move and cached paths and views are dropped
+    invalidateCaches();
 
-    //Delete first pointer
-    delete[] mapTiles;
+    //Release every stateful Space and zombie of map in one operation
+    arena.reset();
 
-    //Delete player space pointer
-    delete playerOccupiedSpace;
+    //Set map up again in same memory
+    initializeMap();
+    mapSetup();
 }
 
-//Initialize map according to size and layout provided as filled with floor spaces that are surrounded by walls.
-//Pointers for each space are assigned through setSpacePtrs.
+//Initialize map according to size and layout provided as filled with floor terrain that is surrounded by wall
+//terrain.
 void Map::initializeMap() {
-    //Set row size of map
-    mapTiles = new Space**[rows];
-    //Loop through rows of map creating new space pointers for columns
-    for (int rowCount = 0; rowCount < rows; rowCount++) {
-        mapTiles[rowCount] = new Space*[cols];
-        for (int colCount = 0; colCount < cols; colCount++) {
-            mapTiles[rowCount][colCount] = new Floor();
-        }
+    //Allocate single contiguous row-major terrain store for whole map, filled with floor
+    terrain.assign(rows * cols, TERRAIN_FLOOR);
+
+    //Allocate occupancy layer in same order, with no player/zombies placed yet
+    occupancy.assign(rows * cols, NO_ENTITY);
+
+    //No zombies in any block of cells yet
+    bucketCols = (cols + bucketSize - 1) / bucketSize;
+    const int buckets = ((rows + bucketSize - 1) / bucketSize) * bucketCols;
+    if (zombieBuckets.size() != static_cast<unsigned>(buckets)) {
+        std::vector <std::atomic<unsigned> >(buckets).swap(zombieBuckets);
+    }
+    for (unsigned count = 0; count < zombieBuckets.size(); count++) {
+        zombieBuckets[count].store(0, std::memory_order_relaxed);
     }
 
     //Create walls of map on top/bottom
     for (int count = 0; count < cols; count++) {
-        //Set top row of walls and delete current allocation
-        delete mapTiles[0][count];
-        mapTiles[0][count] = new Wall();
-
-        //Set bottom row of walls and delete current allocation
-        delete mapTiles[rows-1][count];
-        mapTiles[rows-1][count] = new Wall();
+        terrain[tileIndex(0, count)] = TERRAIN_WALL;
+        terrain[tileIndex(rows-1, count)] = TERRAIN_WALL;
     }
 
     //Create walls of map on sides
     for (int count = 1; count < (rows-1); count++) {
-        //Set left column walls and delete current allocation
-        delete mapTiles[count][0];
-        mapTiles[count][0] = new Wall();
-
-        //Set right column walls and delete current allocation
-        delete mapTiles[count][cols-1];
-        mapTiles[count][cols-1] = new Wall();
+        terrain[tileIndex(count, 0)] = TERRAIN_WALL;
+        terrain[tileIndex(count, cols-1)] = TERRAIN_WALL;
     }
+}
 
-    //Once all spaces are added to map, assign pointer values to each Space
-    for (int countRow = 0; countRow < rows; countRow++) {
-        for (int countCol = 0; countCol < cols; countCol++) {
-            setSpacePtrs(&mapTiles[countRow][countCol], countRow, countCol);
-        }
+//Place Space at row/col. Terrain prototypes set the terrain byte, all other Spaces go in tileObjects.
+void Map::setTile(Space* inputSpace, int inputRow, int inputCol) {
+    const int index = tileIndex(inputRow, inputCol);
+    const int kind = prototypeKind(inputSpace);
+    const bool wasFloor = terrain[index] == TERRAIN_FLOOR;
+
+    if (kind == TERRAIN_OBJECT) {
+        tileObjects[index] = inputSpace;
+    }
+    else {
+        tileObjects.erase(index);
     }
 
-}
+    terrain[index] = static_cast<unsigned char>(kind);
 
-//Set directional space pointers for each space. Takes Space** as the space to set pointers for and the row/col
-//location of that space as parameters. Sets all surrounding spaces to point to space passed to function.
-void Map::setSpacePtrs(Space** inputSpace, int inputRow, int inputCol) {
-    //Set Space pointer above added Space
-    if (inputRow > 0) {
-        mapTiles[inputRow-1][inputCol]->setDown(*inputSpace);
+    //Zombies only walk on floor, so only a change to or from floor can alter flow field or cached paths
+    if ((kind == TERRAIN_FLOOR) != wasFloor) {
+        flowField.tileChanged(index, kind == TERRAIN_FLOOR);
+        pathfinder.clearCache();
     }
 
-    //Set Space pointer below added space
-    if(inputRow < (rows-1)) {
-        mapTiles[inputRow+1][inputCol]->setUp(*inputSpace);
+    //Views cached while map has a sight radius are dropped if cell changed between blocking and clear sight
+    if (!sightTable.isStale()) {
+        sightTable.setOpaque(index, blocksSight(index));
     }
+}
 
-
-    //Set Space pointer left of added space
-    if(inputCol > 0) {
-        mapTiles[inputRow][inputCol-1]->setRight(*inputSpace);
+//Return TerrainKind of a shared terrain prototype, or TERRAIN_OBJECT for any other Space.
+int Map::prototypeKind(Space* inputSpace) {
+    for (int kind = 0; kind < TERRAIN_OBJECT; kind++) {
+        if (terrainPrototypes[kind] == inputSpace) {
+            return kind;
+        }
     }
 
-    //Set Space pointers right of added space
-    if (inputCol < (cols-1)) {
-        mapTiles[inputRow][inputCol+1]->setLeft(*inputSpace);
-    }
+    return TERRAIN_OBJECT;
 }
 
 //Output visualization of map by character representations of all Space objects
@@ -158,103 +329,156 @@ void Map::drawMap() {
     //Print 5 lines before map draw
     std::cout << std::endl;
 
+    //Build each row into a line buffer so the tile store is scanned in row-major order with one write per row
+    std::string rowVisual(cols, ' ');
+
     for (int row = 0; row < rows; row++) {
         for (int col = 0; col < cols; col++) {
-            //If space is not empty, print out visualization
-            if (mapTiles[row][col] != nullptr) {
-                std::cout << mapTiles[row][col]->getVisual();
-            }
-            //If nullptr/empty space, print empty space
-            if (mapTiles[row][col] == nullptr) {
-                std::cout << ' ';
-            }
+            rowVisual[col] = getSpace(row, col)->getVisual();
         }
+
         //End of column, move to next line
-        std::cout << std::endl;
+        std::cout << rowVisual << '\n';
     }
+    std::cout.flush();
 }
 
-//Remove zombie passed as parameter to function from board. Does not delete zombie, but removes from map.
-void Map::removeZombie(Zombie* inputZombie) {
-    Space* oldSpace = inputZombie->getCurrentSpace();
+//Remove zombie at index of zombies from occupancy layer. Does not delete zombie, but removes from map.
+void Map::removeZombie(unsigned zombieIndex) {
+    occupancy[tileIndex(zombies.rows[zombieIndex], zombies.cols[zombieIndex])] = NO_ENTITY;
+}
 
-    //Set current zombie position to original Space value
-    mapTiles[inputZombie->getRows()][inputZombie->getCols()] = inputZombie->getCurrentSpace();
+//Set zombie at index of zombies in occupancy layer at zombie row/col.
+void Map::setZombieLocation(unsigned zombieIndex) {
+    occupancy[tileIndex(zombies.rows[zombieIndex], zombies.cols[zombieIndex])] =
+            ZOMBIE_ENTITY + static_cast<int>(zombieIndex);
+}
 
-    //Set space pointers around removed player back to original Space
-    setSpacePtrs(&oldSpace, inputZombie->getRows(), inputZombie->getCols());
+//Kill zombie at index of zombies, removing it from occupancy layer and zombie buckets. Zombie keeps its index, so
+//zombies may be killed while zombies are walked, and is removed from zombies by removeDeadZombies.
+void Map::killZombie(unsigned zombieIndex) {
+    const int bucket = bucketOf(zombies.rows[zombieIndex], zombies.cols[zombieIndex]);
+    zombieBuckets[bucket].fetch_sub(1, std::memory_order_relaxed);
 
-    //Set currentSpace in Zombie class to nullptr
-    inputZombie->setCurrentSpace(nullptr);
+    removeZombie(zombieIndex);
+    zombies.kill(zombieIndex);
 }
 
-//Set zombie passed as parameter on board for visualization.
-void Map::setZombieLocation(Zombie*& inputZombie) {
-    //Save space that player is about to occupy
-    inputZombie->setCurrentSpace(mapTiles[inputZombie->getRows()][inputZombie->getCols()]);
+//Remove all zombies killed from zombies, each by moving last zombie into its index, and renumber zombies moved in
+//occupancy layer. Cost grows with zombies killed, not with number of zombies.
+void Map::removeDeadZombies() {
+    //Walked from the end, so the zombie moved into an index has already been looked at and is alive
+    for (unsigned count = zombies.size(); count-- > 0;) {
+        if (!zombies.alive[count]) {
+            zombies.remove(count);
 
-    //Set zombie Space pointers for up, down, left, right to the same as space zombie is being moved onto
-    inputZombie->setUp(inputZombie->getCurrentSpace()->getUp());
-    inputZombie->setDown(inputZombie->getCurrentSpace()->getDown());
-    inputZombie->setLeft(inputZombie->getCurrentSpace()->getLeft());
-    inputZombie->setRight(inputZombie->getCurrentSpace()->getRight());
+            if (count < zombies.size()) {
+                setZombieLocation(count);
+            }
+        }
+    }
+}
 
-    //Place Zombie pointer onto map in new location
-    mapTiles[inputZombie->getRows()][inputZombie->getCols()] = inputZombie;
+//Add zombie at row/col with next random stream of map and place it on map. Used by child classes in mapSetup.
+void Map::addZombie(int inputRow, int inputCol) {
+    zombies.add(inputRow, inputCol, streamBase + zombieStreams++);
 
-    //Set space pointers around player to point to player
-    setSpacePtrs(&mapTiles[inputZombie->getRows()][inputZombie->getCols()], inputZombie->getRows(),
-            inputZombie->getCols());
+    setZombieLocation(zombies.size() - 1);
+    zombieBuckets[bucketOf(inputRow, inputCol)].fetch_add(1, std::memory_order_relaxed);
 }
 
-//Remove player from board and replace space that player was on with previous space.
-void Map::removePlayer(Player* inputPlayer) {
-    mapTiles[inputPlayer->getRows()][inputPlayer->getCols()] = playerOccupiedSpace;
+//Add number of zombies passed on free floor cells drawn at random, leaving cells within two steps of player starting
+//location free. Cells are drawn from the stream just below first zombie stream of map, so the same map and seed always
+//get zombies in the same cells. Stops early if free cells are too hard to find. Used by child classes in mapSetup for
+//scenario worlds larger than the standard game.
+void Map::addRandomZombies(int inputCount) {
+    setupDrawsRandom = setupDrawsRandom || inputCount > 0;
+
+    const uint64_t maxDraws = 64 * static_cast<uint64_t>(inputCount) + 1024;
+    uint64_t draw = 0;
+
+    for (int added = 0; added < inputCount && draw < maxDraws;) {
+        const int row = mapRandom->randomInt(streamBase - 1, draw++, 1, rows - 2);
+        const int col = mapRandom->randomInt(streamBase - 1, draw++, 1, cols - 2);
+        const int index = tileIndex(row, col);
+
+        if (terrain[index] == TERRAIN_FLOOR && occupancy[index] == NO_ENTITY &&
+            std::abs(row - startRow) + std::abs(col - startCol) > 2) {
+            addZombie(row, col);
+            added++;
+        }
+    }
+}
 
-    //Set space pointers around removed player back to original Space
-    setSpacePtrs(&playerOccupiedSpace, inputPlayer->getRows(), inputPlayer->getCols());
+//Remove player from occupancy layer of board.
+void Map::removePlayer(Player* inputPlayer) {
+    occupancy[tileIndex(inputPlayer->getRows(), inputPlayer->getCols())] = NO_ENTITY;
 
-    playerOccupiedSpace = nullptr;
+    mapPlayer = nullptr;
 }
 
-//Set player on board and save location that player is moving to in a temporary holder. Takes Player pointer address
-//as parameter and two int values indicating row/col that player is about to move to.
+//Set player in occupancy layer of board at row/col. Takes Player pointer address as parameter and two int values
+//indicating row/col that player is about to move to.
 void Map::setPlayerLocation(Player*& inputPlayer, int inputRow, int inputCol) {
-    //Save space that player is about to occupy
-    playerOccupiedSpace = mapTiles[inputRow][inputCol];
-
-    //Set player Space pointers for up, down, left, right to space player is being moved onto
-    inputPlayer->setUp(playerOccupiedSpace->getUp());
-    inputPlayer->setDown(playerOccupiedSpace->getDown());
-    inputPlayer->setLeft(playerOccupiedSpace->getLeft());
-    inputPlayer->setRight(playerOccupiedSpace->getRight());
+    mapPlayer = inputPlayer;
 
-    //Place Player pointer onto map in new location
-    mapTiles[inputRow][inputCol] = inputPlayer;
-
-    //Set space pointers around player to point to player
-    setSpacePtrs(&mapTiles[inputRow][inputCol], inputRow, inputCol);
+    occupancy[tileIndex(inputRow, inputCol)] = PLAYER_ENTITY;
 }
 
-//Add Space type to location on map and link surrounding pointers. Takes Space object pointer and
-//int values for location of object in map space as parameters. Calls setSpacePtrs to set surrounding
-//objects to point to Space being added.
+//Add Space type to location on map. Takes Space object pointer and int values for location of object in map space
+//as parameters. Doors are told map they are in, so that they report opening and closing.
 void Map::addSpaceObject(Space* inputSpaceObj, int inputRow, int inputCol) {
-    //Set input space object pointers to pointer values of object being replaced
-    inputSpaceObj->setUp(mapTiles[inputRow][inputCol]->getUp());
-    inputSpaceObj->setDown(mapTiles[inputRow][inputCol]->getDown());
-    inputSpaceObj->setLeft(mapTiles[inputRow][inputCol]->getLeft());
-    inputSpaceObj->setRight(mapTiles[inputRow][inputCol]->getRight());
+    Space* oldSpace = getTile(inputRow, inputCol);
 
-    //Remove previous space type
-    delete mapTiles[inputRow][inputCol];
-    //mapTiles[inputRow][inputCol] = nullptr;
+    //Remove previous space type if it was a stateful object rather than shared terrain
+    if (prototypeKind(oldSpace) == TERRAIN_OBJECT) {
+        arena.destroy(oldSpace);
+    }
 
     //Set row/col space to Space object passed to function.
-    mapTiles[inputRow][inputCol] = inputSpaceObj;
+    setTile(inputSpaceObj, inputRow, inputCol);
+
+    //Doors report opening and closing to map they are in
+    if (inputSpaceObj->getKind() == KIND_DOOR) {
+        static_cast<Door*>(inputSpaceObj)->setMap(this);
+    }
+}
+
+//Link cell at row/col to a Space in another map, reached by moving off the edge of the map from that cell. Takes
+//int values for row/col and the linked Space pointer as parameters.
+void Map::linkEdge(int inputRow, int inputCol, Space* inputLink) {
+    edgeLinks[tileIndex(inputRow, inputCol)] = inputLink;
+}
+
+//Return Space linked to cell at row/col off the edge of the map, or nullptr if there is none.
+Space* Map::getEdgeLink(int inputRow, int inputCol) {
+    SpaceTable::iterator link = edgeLinks.find(tileIndex(inputRow, inputCol));
+
+    return (link != edgeLinks.end()) ? link->second : nullptr;
+}
+
+//Set terrain kind of row/col location, freeing any stateful Space that was there. Takes int values for row/col
+//and TerrainKind as parameters.
+void Map::setTerrain(int inputRow, int inputCol, TerrainKind inputKind) {
+    Space* oldSpace = getTile(inputRow, inputCol);
+
+    //Remove previous space type if it was a stateful object rather than shared terrain
+    if (prototypeKind(oldSpace) == TERRAIN_OBJECT) {
+        arena.destroy(oldSpace);
+    }
+
+    //Set terrain to shared prototype
+    setTile(terrainPrototypes[inputKind], inputRow, inputCol);
+}
 
-    //Set pointers of surrounding Space objects to new Space object
-    setSpacePtrs(&inputSpaceObj, inputRow, inputCol);
+//Return integer value for number of rows in map
+int Map::getRows() {
+    return rows;
+}
+
+//Return integer value for number of columns in map
+int Map::getCols() {
+    return cols;
 }
 
 //Return integer value for starting row for player object
@@ -267,192 +491,909 @@ int Map::getStartCol() {
     return startCol;
 }
 
-//Return Space pointer for current player occupied space
+//Return Space pointer for terrain tile player is standing on
 Space* Map::getCurrentSpace() {
-    return playerOccupiedSpace;
+    return getTile(mapPlayer->getRows(), mapPlayer->getCols());
 }
 
 //Default map setup function for abstract virtual function (no action) - Child class map types set up map using
 //overridden function.
 void Map::mapSetup() {}
 
-//Remove/replace item object in map after pick up with floor space. Takes Space pointer for object being removed.
+//Remove/replace item object in map after pick up with floor terrain. Picking an item up makes a noise. Takes Space
+//pointer for object being removed.
 void Map::removeObject(Space* inputObject) {
-    Space* newFloor = new Floor();
+    //Replace object with floor terrain and remove object from board
+    setTerrain(inputObject->getRows(), inputObject->getCols(), TERRAIN_FLOOR);
 
-    //Set space that player is currently on to point to new floor object. If item is in direction of object being
-    //removed, set playerOccupiedSpace to point to newFloor.
-    //Check to left of player for item being removed
-    if (playerOccupiedSpace->getLeft() == inputObject) {
-        playerOccupiedSpace->setLeft(newFloor);
+    makeNoise(inputObject->getRows(), inputObject->getCols(), NOISE_PICK_UP);
+}
+
+//Move zombies around map. Moves of all zombies are proposed at once by the ZombieSwarm move kernel, then committed
+//according to move mode of map. If zombie attacks player but player has a knife, zombie dies and is removed from game.
+//Takes ThreadPool that two phase moves are spread across, or nullptr to move on calling thread. Pool must not be
+//running a task that calls this.
+void Map::moveZombies(ThreadPool* inputPool) {
+    //Player location for attacks. When player is not in map it is placed far enough outside map that no zombie is
+    //next to it.
+    const int playerRow = (mapPlayer != nullptr) ? mapPlayer->getRows() : -2;
+    const int playerCol = (mapPlayer != nullptr) ? mapPlayer->getCols() : -2;
+
+    //Zombies chase along flow field while player is in map, built again only if player moved or a tile change made
+    //it stale since last turn
+    const FlowField* field = nullptr;
+    if (mapPlayer != nullptr && flowField.getRadius() > 0) {
+        if (flowField.needsBuild(playerRow, playerCol)) {
+            flowField.buildField(terrain.data(), rows, cols, playerRow, playerCol);
+        }
+        field = &flowField;
     }
 
-    //Check to right of player for item being removed
-    else if (playerOccupiedSpace->getRight() == inputObject) {
-        playerOccupiedSpace->setRight(newFloor);
+    zombies.resizeProposals();
+
+    //Zombies that hear a noise head for it, and zombies that see player head for where they saw player instead
+    if (noiseField.hasNoise()) {
+        hearNoise();
+    }
+    if (mapPlayer != nullptr && sightTable.getRadius() > 0) {
+        spotPlayer(playerRow, playerCol);
     }
+    steerZombies();
 
-    //Check above player for item being removed
-    else if (playerOccupiedSpace->getUp() == inputObject) {
-        playerOccupiedSpace->setUp(newFloor);
+    if (moveMode == MOVE_TWO_PHASE) {
+        moveZombiesTwoPhase(inputPool, playerRow, playerCol, field);
+    }
+    else {
+        moveZombiesInOrder(playerRow, playerCol, field);
     }
+}
 
-    //Check below player for item being removed
-    else if (playerOccupiedSpace->getDown() == inputObject) {
-        playerOccupiedSpace->setDown(newFloor);
+//Count a turn zombies of map were not moved, to be moved later by catchUp. Only for maps player is not in, as zombies
+//moved late must not see a player that was not there.
+void Map::skipTurn() {
+    skippedTurns++;
+}
+
+//Return number of turns skipped since zombies of map were last caught up
+unsigned Map::getSkippedTurns() {
+    return skippedTurns;
+}
+
+//Move zombies of map once for every turn skipped, leaving map as if it had been moved every turn. Takes ThreadPool as
+//moveZombies.
+void Map::catchUp(ThreadPool* inputPool) {
+    for (; skippedTurns > 0; skippedTurns--) {
+        moveZombies(inputPool);
     }
+}
+
+//Commit proposals in zombie order: each zombie steps into its target cell if no zombie moved there before it. Takes
+//player location and FlowField as passed to propose.
+void Map::moveZombiesInOrder(int playerRow, int playerCol, const FlowField* inputField) {
+    //Propose moves of all zombies in one batch from terrain, which does not change while zombies move
+    zombies.propose(0, zombies.size(), terrain.data(), cols, playerRow, playerCol, mapRandom, inputField);
 
-    //Loop to check to make sure no zombies are next to item when it is picked up. If a zombie is next to item, must
-    //set current space that zombie is on to point to new Floor space
+    //Commit moves in zombie order. Zombies killed are only marked dead here and removed from arrays after the loop, so
+    //every zombie after them still moves.
+    bool zombieKilled = false;
     for (unsigned count = 0; count < zombies.size(); count++) {
-        //Check to right of zombie for item being removed
-        if (zombies[count]->getRight() == inputObject) {
-            zombies[count]->getCurrentSpace()->setRight(newFloor);
+        //Zombie next to player attacks. If player has a knife in inventory, use on zombie to kill zombie and keep
+        //player alive, otherwise player dies.
+        if (zombies.attacks[count]) {
+            if (mapPlayer->useItem(KIND_KNIFE)) {
+                //Inform user of what occurred
+                std::cout << "Zombie attack was stopped with a knife to its head!"
+                          << std::endl;
+
+                //Remove zombie from map and mark it dead, which is heard around player
+                killZombie(count);
+                makeNoise(playerRow, playerCol, NOISE_KILL);
+                zombieKilled = true;
+            }
+            else {
+                mapPlayer->setAlive(false);
+            }
         }
+        //Player is not in a nearby space, step into target cell if it is floor and no zombie is there
+        else {
+            stepZombie(count, zombies.opens[count] && occupancy[zombies.targets[count]] < ZOMBIE_ENTITY);
+        }
+    }
 
-        //Check to left of zombie for item being removed
-        else if (zombies[count]->getLeft() == inputObject) {
-            zombies[count]->getCurrentSpace()->setLeft(newFloor);
+    //Remove zombies killed from arrays
+    if (zombieKilled) {
+        removeDeadZombies();
+    }
+}
+
+//Propose and commit in two phases over ranges of zombies on thread pool passed (or calling thread if nullptr),
+//resolving conflicts by the two phase rule. Takes player location and FlowField as passed to propose.
+void Map::moveZombiesTwoPhase(ThreadPool* inputPool, int playerRow, int playerCol, const FlowField* inputField) {
+    //Claims are only needed by two phase moves, size them to map on first use
+    if (claims.size() != occupancy.size()) {
+        std::vector <std::atomic<unsigned> >(occupancy.size()).swap(claims);
+        for (unsigned count = 0; count < claims.size(); count++) {
+            claims[count].store(unclaimedCell, std::memory_order_relaxed);
         }
+    }
+
+    //Phase 1: every zombie proposes a move against map as it was at start of turn, and claims its target cell if that
+    //cell is floor with nobody on it. Occupancy is only read in this phase. A cell claimed by several zombies keeps
+    //lowest index, whichever thread gets there first.
+    runZombieRanges(inputPool, [this, playerRow, playerCol, inputField](unsigned inputBegin, unsigned inputEnd) {
+        zombies.propose(inputBegin, inputEnd, terrain.data(), cols, playerRow, playerCol, mapRandom, inputField);
 
-        //Check above zombie for item being removed
-        else if (zombies[count]->getUp() == inputObject) {
-            zombies[count]->getCurrentSpace()->setUp(newFloor);
+        for (unsigned count = inputBegin; count < inputEnd; count++) {
+            const int target = zombies.targets[count];
+            if (zombies.attacks[count] || !zombies.opens[count] || occupancy[target] != NO_ENTITY) {
+                continue;
+            }
+
+            unsigned claim = claims[target].load(std::memory_order_relaxed);
+            while (count < claim && !claims[target].compare_exchange_weak(claim, count, std::memory_order_relaxed)) {}
         }
+    });
+
+    //Phase 2: zombies holding claim on their target step into it, all others stay. Cells left and entered all belong
+    //to one zombie each (cells entered were free at start of turn), so ranges update occupancy without conflicts.
+    //Claims are given back by the zombie holding them.
+    runZombieRanges(inputPool, [this](unsigned inputBegin, unsigned inputEnd) {
+        for (unsigned count = inputBegin; count < inputEnd; count++) {
+            if (zombies.attacks[count]) {
+                continue;
+            }
 
-        //Check below zombie for item being removed
-        else if (zombies[count]->getDown() == inputObject) {
-            zombies[count]->getCurrentSpace()->setDown(newFloor);
+            const int target = zombies.targets[count];
+            const bool stepped = zombies.opens[count] && claims[target].load(std::memory_order_relaxed) == count;
+
+            if (stepped) {
+                stepZombie(count, stepped);
+                claims[target].store(unclaimedCell, std::memory_order_relaxed);
+            }
+            else {
+                zombies.commit(count, stepped);
+            }
+        }
+    });
+
+    //Attacks on player are made in zombie order on calling thread, as each may use up a knife. Zombies attacking did
+    //not move, so they are among the zombies next to player.
+    unsigned neighbors[4];
+    const int neighborCount = playerNeighbors(neighbors);
+
+    bool zombieKilled = false;
+    for (int neighbor = 0; neighbor < neighborCount; neighbor++) {
+        const unsigned count = neighbors[neighbor];
+        if (!zombies.attacks[count]) {
+            continue;
+        }
+
+        //If player has a knife in inventory, use on zombie to kill zombie and keep player alive, otherwise player dies.
+        if (mapPlayer->useItem(KIND_KNIFE)) {
+            std::cout << "Zombie attack was stopped with a knife to its head!"
+                      << std::endl;
+
+            //Remove zombie from map and mark it dead, which is heard around player
+            killZombie(count);
+            makeNoise(playerRow, playerCol, NOISE_KILL);
+            zombieKilled = true;
+        }
+        else {
+            mapPlayer->setAlive(false);
         }
     }
 
-    //Add new space for removed object (empty Floor) and remove object from board
-    addSpaceObject(newFloor, inputObject->getRows(), inputObject->getCols());
+    //Remove zombies killed from arrays
+    if (zombieKilled) {
+        removeDeadZombies();
+    }
 }
 
-//Move zombies around map. Activate zombie movement function for each zombie on map while looping through vector.
-//Zombies are removed from map, new locations are determined through Zombie class, and zombies are moved. If zombie
-//attacks player but player has a knife, zombie dies and is removed from game.
-void Map::moveZombies() {
-    //Find new movement location of each zombie on map. Loop through vector moving all zombies.
-    //Move each zombie through removing zombie from board and placing in new location. Restore space that zombie is
-    //currently occupied on and held in Zombie class and save new space to Zombie class before moving. Perform all
-    //functions over loop of all zombies on map.
-    for (unsigned count = 0; count < zombies.size(); count++) {
-        //Remove zombie/restore space that zombie occupied
-        removeZombie(zombies[count]);
+//Run function passed over ranges of zombies (begin and end index) covering all zombies, one task per range on thread
+//pool passed, or as one range on calling thread if nullptr. Returns when all ranges are done.
+void Map::runZombieRanges(ThreadPool* inputPool, const std::function<void(unsigned, unsigned)>& inputRange) {
+    const unsigned count = zombies.size();
 
-        //Find new coordinates and movement of zombie based on move patterns in class and surroundings.
-        zombies[count]->moveZombie();
+    if (inputPool == nullptr) {
+        inputRange(0, count);
+        return;
+    }
+
+    inputPool->run((count + zombieRange - 1) / zombieRange, [count, &inputRange](unsigned rangeIndex) {
+        inputRange(rangeIndex * zombieRange, std::min(count, (rangeIndex + 1) * zombieRange));
+    });
+}
+
+//Set cell zombie at index of zombies heads for along a shortest path until it gets there, as a goal of any kind but
+//sight. Takes index of zombie and row/col of goal.
+void Map::setZombieGoal(unsigned zombieIndex, int inputRow, int inputCol) {
+    zombies.goals[zombieIndex] = tileIndex(inputRow, inputCol);
+    zombies.sighted[zombieIndex] = 0;
+}
 
-        //If zombie is alive, set zombie on map in new location
-        if (zombies[count]->getAlive()) {
-            //Save space zombie is moving to and move zombie to new space on map
-            setZombieLocation(zombies[count]);
+//Return whether cell at tileIndex passed blocks sight: walls, shelves and closed doors. Items, exit points and open
+//doors are seen past.
+bool Map::blocksSight(int inputIndex) {
+    if (terrain[inputIndex] == TERRAIN_WALL || terrain[inputIndex] == TERRAIN_SHELF) {
+        return true;
+    }
+    if (terrain[inputIndex] != TERRAIN_OBJECT) {
+        return false;
+    }
+
+    SpaceTable::iterator object = tileObjects.find(inputIndex);
+    return object != tileObjects.end() && object->second->getKind() == KIND_DOOR && object->second->getSolid();
+}
+
+//Size SightTable to map and mark every cell that blocks sight, done on first use and after map is set up again
+void Map::fillSight() {
+    sightTable.setSize(rows, cols);
+
+    for (int index = 0; index < rows * cols; index++) {
+        if (blocksSight(index)) {
+            sightTable.setOpaque(index, true);
         }
-        //If zombie died, remove from vector and do not place on map.
-        else {
-            //Free memory for Zombie
-            delete zombies[count];
+    }
+}
 
-            //Remove zombie object from vector
-            zombies.erase(zombies.begin()+count);
+//Give every zombie within sight radius of player that player can see the player's cell as goal, so that it heads for
+//where it last saw player. A zombie that saw player before keeps that goal while it is within sightSlack steps of
+//player, so that its path is not found again for every step player takes, and any other goal, such as a noise heard
+//this turn, gives way. Takes player row/col. Zombies near player are found through zombie buckets and each is checked
+//by one bit test of player's cached view.
+void Map::spotPlayer(int playerRow, int playerCol) {
+    if (sightTable.isStale()) {
+        fillSight();
+    }
+
+    const std::vector <uint64_t>& view = sightTable.viewFrom(playerRow, playerCol);
+    zombiesNear(playerRow, playerCol, sightTable.getRadius(), sightedZombies);
+
+    for (unsigned count = 0; count < sightedZombies.size(); count++) {
+        const unsigned zombieIndex = sightedZombies[count];
+
+        if (!sightTable.inView(view, zombies.rows[zombieIndex] - playerRow, zombies.cols[zombieIndex] - playerCol)) {
+            continue;
+        }
+
+        const int goal = zombies.goals[zombieIndex];
+        if (goal >= 0 && zombies.sighted[zombieIndex] &&
+            std::abs(goal / cols - playerRow) + std::abs(goal % cols - playerCol) <= sightSlack) {
+            continue;
         }
+
+        zombies.goals[zombieIndex] = tileIndex(playerRow, playerCol);
+        zombies.sighted[zombieIndex] = 1;
     }
 }
 
-//Check surroundings around player for zombie. If zombie is present, player is attacked. Player pointer is passed as
-//parameter to check around up, down, left, right spaces from player.
-void Map::checkZombies(Player* inputPlayer) {
-    //Loop through zombies on map and check for Player in all lateral/vertical spaces (up/down/left/right)
+//Spread noises made since last move in one pass and give every zombie in a cell reached the cell of the loudest noise
+//heard there as goal. Cost is the area noises reach, as zombies are found by reading occupancy of cells reached.
+void Map::hearNoise() {
+    noiseField.spread(terrain.data(), rows, cols);
+
+    const std::vector <int>& reached = noiseField.getReached();
+    for (unsigned count = 0; count < reached.size(); count++) {
+        const int occupant = occupancy[reached[count]];
+
+        if (occupant >= ZOMBIE_ENTITY) {
+            const int origin = noiseField.originOf(reached[count]);
+            setZombieGoal(occupant - ZOMBIE_ENTITY, origin / cols, origin % cols);
+        }
+    }
+}
+
+//Work out next step of every zombie that has a goal, on calling thread as paths are cached. Goals reached, out of
+//reach, or next to the zombie but not floor (so never stepped on) are dropped and zombie wanders again.
+void Map::steerZombies() {
     for (unsigned count = 0; count < zombies.size(); count++) {
-        //If zombie is present and player has a knife, zombie is killed, otherwise player dies
-        //Check up from zombie
-        if (zombies[count]->getUp()->getName() == "player") {
-            //If player has knife, zombie is killed
-            if (inputPlayer->useItem("knife")) {
-                std::cout << "Zombie attack was stopped with a knife to its head!"
-                          << std::endl;
+        const int goal = zombies.goals[count];
+        if (goal < 0) {
+            zombies.steers[count] = 0;
+            continue;
+        }
 
-                //Remove zombie/restore space that zombie occupied
-                removeZombie(zombies[count]);
+        const int cell = tileIndex(zombies.rows[count], zombies.cols[count]);
+        int direction = pathfinder.nextDirection(terrain.data(), rows, cols, cell, goal);
+        const int next = cell + ((direction == 3) - (direction == 1)) * cols + (direction == 2) - (direction == 4);
 
-                //Free memory for Zombie
-                delete zombies[count];
+        if (direction == 0 || (next == goal && terrain[goal] != TERRAIN_FLOOR)) {
+            zombies.goals[count] = -1;
+            zombies.sighted[count] = 0;
+            direction = 0;
+        }
+        zombies.steers[count] = direction;
+    }
+}
+
+//Return number of zombies next to player (up, down, left, right) and write their indices of zombies, in zombie order,
+//into array passed. Found from occupancy layer, so cost does not depend on number of zombies.
+int Map::playerNeighbors(unsigned outputIndices[4]) {
+    if (mapPlayer == nullptr) {
+        return 0;
+    }
+
+    const int row = mapPlayer->getRows();
+    const int col = mapPlayer->getCols();
+    const int neighborRows[4] = {row - 1, row, row + 1, row};
+    const int neighborCols[4] = {col, col + 1, col, col - 1};
+    int found = 0;
 
-                //Remove zombie object from vector
-                zombies.erase(zombies.begin() + count);
+    for (int count = 0; count < 4; count++) {
+        if (neighborRows[count] >= 0 && neighborRows[count] < rows && neighborCols[count] >= 0 &&
+            neighborCols[count] < cols && isZombieAt(neighborRows[count], neighborCols[count])) {
+            outputIndices[found++] = occupancy[tileIndex(neighborRows[count], neighborCols[count])] - ZOMBIE_ENTITY;
+        }
+    }
+
+    std::sort(outputIndices, outputIndices + found);
+
+    return found;
+}
+
+//Return indices of zombies within a number of rows and columns of row/col location, in no particular order. Blocks of
+//cells holding no zombies are skipped, so cost depends on area covered by radius and zombies near location, not on
+//number of zombies in map. Takes row/col, radius and vector filled with indices of zombies.
+void Map::zombiesNear(int inputRow, int inputCol, int inputRadius, std::vector <unsigned>& outputIndices) {
+    const int firstRow = std::max(0, inputRow - inputRadius);
+    const int lastRow = std::min(rows - 1, inputRow + inputRadius);
+    const int firstCol = std::max(0, inputCol - inputRadius);
+    const int lastCol = std::min(cols - 1, inputCol + inputRadius);
+
+    outputIndices.clear();
+
+    for (int bucketRow = firstRow / bucketSize; bucketRow <= lastRow / bucketSize; bucketRow++) {
+        for (int bucketCol = firstCol / bucketSize; bucketCol <= lastCol / bucketSize; bucketCol++) {
+            if (zombieBuckets[bucketRow * bucketCols + bucketCol].load(std::memory_order_relaxed) == 0) {
+                continue;
             }
-            //Player dies
-            else {
-                inputPlayer->setAlive(false);
+
+            //Cells of block inside radius
+            const int endRow = std::min(lastRow, bucketRow * bucketSize + bucketSize - 1);
+            const int endCol = std::min(lastCol, bucketCol * bucketSize + bucketSize - 1);
+            for (int row = std::max(firstRow, bucketRow * bucketSize); row <= endRow; row++) {
+                for (int col = std::max(firstCol, bucketCol * bucketSize); col <= endCol; col++) {
+                    const int occupant = occupancy[tileIndex(row, col)];
+                    if (occupant >= ZOMBIE_ENTITY) {
+                        outputIndices.push_back(static_cast<unsigned>(occupant - ZOMBIE_ENTITY));
+                    }
+                }
             }
         }
+    }
+}
 
-        //Check down from zombie
-        else if (zombies[count]->getDown()->getName() == "player") {
-            //If player has knife, zombie is killed
-            if (inputPlayer->useItem("knife")) {
-                std::cout << "Zombie attack was stopped with a knife to its head!"
-                          << std::endl;
+//Return handle of zombie at index of zombies (as returned by zombiesNear). Handle keeps referring to zombie while its
+//index changes as other zombies are removed.
+ZombieHandle Map::getZombieHandle(unsigned zombieIndex) {
+    return zombies.handleOf(zombieIndex);
+}
 
-                //Remove zombie/restore space that zombie occupied
-                removeZombie(zombies[count]);
+//Return index of zombie handle passed refers to, or -1 if zombie has been killed since handle was taken
+int Map::findZombie(ZombieHandle inputHandle) {
+    return zombies.indexOf(inputHandle);
+}
 
-                //Free memory for Zombie
-                delete zombies[count];
+//Return hash of everything about map that can change during a game: terrain, state of doors and other objects, player
+//location and location, direction, random stream position and goal of every zombie in index order. Equal for maps in
+//the same state, so two runs of a game can be checked to have ended the same.
+uint64_t Map::stateHash() {
+    uint64_t hash = Random::mix(static_cast<uint64_t>(rows) << 32 | static_cast<uint32_t>(cols));
 
-                //Remove zombie object from vector
-                zombies.erase(zombies.begin() + count);
-            }
-            //Player dies
-            else {
-                inputPlayer->setAlive(false);
-            }
+    for (unsigned count = 0; count < terrain.size(); count++) {
+        hash = Random::mix(hash + terrain[count]);
+    }
+
+    //Objects are combined in any order, as tileObjects is not ordered
+    uint64_t objects = 0;
+    for (SpaceTable::iterator object = tileObjects.begin(); object != tileObjects.end(); object++) {
+        objects += Random::mix((static_cast<uint64_t>(object->first) << 16) ^
+                               (static_cast<uint64_t>(object->second->getKind()) << 8) ^
+                               (static_cast<uint64_t>(object->second->getDoorState()) << 1) ^
+                               object->second->getSolid());
+    }
+    hash = Random::mix(hash ^ objects);
+
+    if (mapPlayer != nullptr) {
+        hash = Random::mix(hash + tileIndex(mapPlayer->getRows(), mapPlayer->getCols()) + 1);
+    }
+
+    for (unsigned count = 0; count < zombies.size(); count++) {
+        hash = Random::mix(hash + tileIndex(zombies.rows[count], zombies.cols[count]));
+        hash = Random::mix(hash + (static_cast<uint64_t>(zombies.directions[count]) << 32) +
+                           static_cast<uint32_t>(zombies.goals[count]) + (zombies.sighted[count] << 8));
+        hash = Random::mix(hash + zombies.counters[count]);
+    }
+
+    return hash;
+}
+
+//Write everything about map that can change during a game to snapshot passed: terrain kind of every cell packed two
+//bits a cell, kind (and door state) of each stateful object in tileIndex order, every zombie in index order and turns
+//skipped. Things worked out from these (flow field, cached paths and views) and handles to zombies are not saved.
+//Player is saved by Game.
+void Map::saveState(Snapshot& outputSnapshot) {
+    outputSnapshot.writeVarint(rows);
+    outputSnapshot.writeVarint(cols);
+    outputSnapshot.writeVarint(skippedTurns);
+    outputSnapshot.writeVarint(zombieStreams);
+
+    //Every TerrainKind fits in two bits
+    outputSnapshot.writePacked(terrain.data(), terrain.size(), 2);
+
+    //Objects in tileIndex order, each as distance from the one before, so that a save is the same for the same state
+    std::vector <int> objectCells;
+    listObjectCells(objectCells);
+
+    outputSnapshot.writeVarint(objectCells.size());
+    int lastCell = 0;
+    for (unsigned count = 0; count < objectCells.size(); count++) {
+        Space* object = tileObjects.find(objectCells[count])->second;
+
+        outputSnapshot.writeVarint(objectCells[count] - lastCell);
+        outputSnapshot.writeByte(object->getKind());
+        if (object->getKind() == KIND_DOOR) {
+            outputSnapshot.writeByte(object->getDoorState());
         }
+        lastCell = objectCells[count];
+    }
 
-        //Check right of zombie
-        else if (zombies[count]->getRight()->getName() == "player") {
-            //If player has knife, zombie is killed
-            if (inputPlayer->useItem("knife")) {
-                std::cout << "Zombie attack was stopped with a knife to its head!"
-                          << std::endl;
+    //Zombies by cell, direction, moves left (below 0 for zombies that stepped on chasing), random stream counted from
+    //first stream of map, draws made from it, goal cell (0 for none) and whether goal is where it saw player
+    outputSnapshot.writeVarint(zombies.size());
+    for (unsigned count = 0; count < zombies.size(); count++) {
+        outputSnapshot.writeVarint(tileIndex(zombies.rows[count], zombies.cols[count]));
+        outputSnapshot.writeByte(static_cast<unsigned char>(zombies.directions[count]));
+        outputSnapshot.writeSigned(zombies.movesLeft[count]);
+        outputSnapshot.writeVarint(zombies.streams[count] - streamBase);
+        outputSnapshot.writeVarint(zombies.counters[count]);
+        outputSnapshot.writeVarint(zombies.goals[count] + 1);
+        outputSnapshot.writeByte(zombies.sighted[count]);
+    }
+}
 
-                //Remove zombie/restore space that zombie occupied
-                removeZombie(zombies[count]);
+//Set map to state read from snapshot passed, as written by saveState of a map of the same size and layout. Map is
+//changed in place: terrain is unpacked straight into terrain layer, objects still on map are kept and only given their
+//saved state, items picked up since are freed and items picked up in save are created again, and zombies are placed
+//from saved arrays. Player is taken off map, Game places it. Flow field, cached paths and views are dropped and worked
+//out again, so a zombie heading for a goal may take another shortest path of the same length. Returns false if
+//snapshot does not hold a state of this map, after which map must be reset before it is used.
+bool Map::loadState(Snapshot& inputSnapshot) {
+    if (inputSnapshot.readVarint() != static_cast<uint64_t>(rows) ||
+        inputSnapshot.readVarint() != static_cast<uint64_t>(cols)) {
+        return false;
+    }
+    skippedTurns = static_cast<unsigned>(inputSnapshot.readVarint());
+    zombieStreams = inputSnapshot.readVarint();
 
-                //Free memory for Zombie
-                delete zombies[count];
+    inputSnapshot.readPacked(terrain.data(), terrain.size(), 2);
+    if (!inputSnapshot.good()) {
+        return false;
+    }
 
-                //Remove zombie object from vector
-                zombies.erase(zombies.begin() + count);
-            }
-            //Player dies
-            else {
-                inputPlayer->setAlive(false);
-            }
+    //Objects are read in full first, so that a save that would free or replace a door is rejected before any object
+    //is touched
+    const uint64_t objectCount = inputSnapshot.readVarint();
+    if (!inputSnapshot.good() || objectCount > terrain.size()) {
+        return false;
+    }
+
+    std::vector <int> objectCells;
+    std::vector <unsigned char> objectKinds;
+    std::vector <unsigned char> objectStates;
+    uint64_t cell = 0;
+    for (uint64_t count = 0; count < objectCount; count++) {
+        const uint64_t distance = inputSnapshot.readVarint();
+        cell += distance;
+        const unsigned char kind = inputSnapshot.readByte();
+        const unsigned char state = (kind == KIND_DOOR) ? inputSnapshot.readByte() : 0;
+        if (!inputSnapshot.good() || (count > 0 && distance == 0) || cell >= terrain.size() ||
+            terrain[cell] != TERRAIN_OBJECT || state >= DOOR_STATE_COUNT) {
+            return false;
         }
 
-        //Check left of zombie for player
-        else if (zombies[count]->getLeft()->getName() == "player") {
-            //If player has knife, zombie is killed
-            if (inputPlayer->useItem("knife")) {
-                std::cout << "Zombie attack was stopped with a knife to its head!"
-                          << std::endl;
+        objectCells.push_back(static_cast<int>(cell));
+        objectKinds.push_back(kind);
+        objectStates.push_back(state);
+    }
 
-                //Remove zombie/restore space that zombie occupied
-                removeZombie(zombies[count]);
+    if (!keepsDoors(objectCells, objectKinds)) {
+        return false;
+    }
 
-                //Free memory for Zombie
-                delete zombies[count];
+    //Objects of cells that are no longer objects in save are freed, objects kept on map take their saved state and
+    //others are created again
+    freeStrayObjects();
+    for (unsigned count = 0; count < objectCells.size(); count++) {
+        if (!placeObject(objectCells[count], objectKinds[count], objectStates[count])) {
+            return false;
+        }
+    }
 
-                //Remove zombie object from vector
-                zombies.erase(zombies.begin() + count);
-            }
-            //Player dies
-            else {
-                inputPlayer->setAlive(false);
-            }
+    //Every object cell of terrain must have been given an object
+    if (tileObjects.size() != objectCount) {
+        return false;
+    }
+
+    //Zombies are placed again from scratch, along with their counts per block of cells
+    zombies.clear();
+    mapPlayer = nullptr;
+    std::fill(occupancy.begin(), occupancy.end(), static_cast<int>(NO_ENTITY));
+    for (unsigned count = 0; count < zombieBuckets.size(); count++) {
+        zombieBuckets[count].store(0, std::memory_order_relaxed);
+    }
+
+    const uint64_t zombieCount = inputSnapshot.readVarint();
+    for (uint64_t count = 0; count < zombieCount && inputSnapshot.good(); count++) {
+        const uint64_t zombieCell = inputSnapshot.readVarint();
+        const unsigned char direction = inputSnapshot.readByte();
+        const int64_t movesLeft = inputSnapshot.readSigned();
+        const uint64_t stream = inputSnapshot.readVarint();
+        const uint64_t counter = inputSnapshot.readVarint();
+        const uint64_t goal = inputSnapshot.readVarint();
+        const unsigned char sighted = inputSnapshot.readByte();
+        if (zombieCell >= occupancy.size() || terrain[zombieCell] != TERRAIN_FLOOR ||
+            occupancy[zombieCell] != NO_ENTITY || goal > terrain.size() || sighted > 1 ||
+            direction > 4 || movesLeft > 2 || movesLeft < -(static_cast<int64_t>(1) << 31)) {
+            return false;
+        }
+
+        const int row = static_cast<int>(zombieCell) / cols;
+        const int col = static_cast<int>(zombieCell) % cols;
+        zombies.add(row, col, streamBase + stream);
+
+        const unsigned zombieIndex = zombies.size() - 1;
+        zombies.directions[zombieIndex] = direction;
+        zombies.movesLeft[zombieIndex] = static_cast<int>(movesLeft);
+        zombies.counters[zombieIndex] = counter;
+        zombies.goals[zombieIndex] = static_cast<int>(goal) - 1;
+        zombies.sighted[zombieIndex] = sighted;
+
+        setZombieLocation(zombieIndex);
+        zombieBuckets[bucketOf(row, col)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //Whole map may have changed, so what was worked out from its tiles is worked out again on next move
+    invalidateCaches();
+
+    return inputSnapshot.good();
+}
+
+//Take image of map as it is now set up (before player is placed), for restoreImage. Game takes it once maps are set up
+//and doors linked.
+void Map::captureImage() {
+    terrainImage = terrain;
+    occupancyImage = occupancy;
+    zombiesImage.copyFrom(zombies);
+
+    bucketImage.resize(zombieBuckets.size());
+    for (unsigned count = 0; count < zombieBuckets.size(); count++) {
+        bucketImage[count] = zombieBuckets[count].load(std::memory_order_relaxed);
+    }
+
+    listObjectCells(objectImageCells);
+    objectImageKinds.resize(objectImageCells.size());
+    objectImageStates.resize(objectImageCells.size());
+    for (unsigned count = 0; count < objectImageCells.size(); count++) {
+        Space* object = tileObjects.find(objectImageCells[count])->second;
+        objectImageKinds[count] = static_cast<unsigned char>(object->getKind());
+        objectImageStates[count] = static_cast<unsigned char>(object->getDoorState());
+    }
+
+    streamsImage = zombieStreams;
+    imageSeed = (mapRandom != nullptr) ? mapRandom->getSeed() : 0;
+    imageArenaBytes = arena.getUsedBytes();
+    imageTaken = true;
+}
+
+//Set map back to image taken by captureImage in place of setting it up again: terrain and occupancy layers and zombie
+//arrays are copied whole, objects still on map are kept and only given their door state, and items picked up since
+//are created again. Cost does not depend on how map is set up by mapSetup. Edge links are kept and player is taken off
+//map. Returns false, after which map must be reset, if no image was taken, if mapSetup drew from Random service with
+//another seed than image was taken with, or once items created again have grown arena past twice its size when image
+//was taken (its memory is only given back by a reset).
+bool Map::restoreImage() {
+    if (!imageTaken || (setupDrawsRandom && (mapRandom == nullptr || mapRandom->getSeed() != imageSeed)) ||
+        arenaOutgrown()) {
+        return false;
+    }
+
+    //Layers and zombies are copied whole into memory they already hold
+    terrain = terrainImage;
+    occupancy = occupancyImage;
+    zombies.copyFrom(zombiesImage);
+    for (unsigned count = 0; count < bucketImage.size(); count++) {
+        zombieBuckets[count].store(bucketImage[count], std::memory_order_relaxed);
+    }
+    mapPlayer = nullptr;
+    zombieStreams = streamsImage;
+    skippedTurns = 0;
+
+    //Only objects that changed since image was taken are touched
+    if (!keepsDoors(objectImageCells, objectImageKinds)) {
+        return false;
+    }
+    freeStrayObjects();
+    for (unsigned count = 0; count < objectImageCells.size(); count++) {
+        if (!placeObject(objectImageCells[count], objectImageKinds[count], objectImageStates[count])) {
+            return false;
+        }
+    }
+
+    invalidateCaches();
+
+    return tileObjects.size() == objectImageCells.size();
+}
+
+//Return whether items created again by restoreImage or copyFrom have grown arena past twice its size when image was
+//taken (its memory is only given back by a reset), after which map must be reset
+bool Map::arenaOutgrown() {
+    return arena.getUsedBytes() > 2 * imageArenaBytes + imageArenaSlack;
+}
+
+//Set map to state of map passed, of the same size and layout, such as the same map of another Game: terrain and
+//occupancy layers and zombie arrays are copied whole, objects still on map are kept and only given their door state,
+//and objects missing are created again. Chase radius, sight radius, hearing and move mode are copied too. Map passed is
+//only read, so several maps may copy the same map at once. Player is not copied, but its cell in occupancy layer is, so
+//Game places its own player there. Flow field, cached paths and views are dropped as by loadState. Returns false if map
+//passed is of another size or a door of it is missing from this map, after which map must be reset before it is used.
+bool Map::copyFrom(Map& inputMap) {
+    if (inputMap.rows != rows || inputMap.cols != cols) {
+        return false;
+    }
+
+    //Layers and zombies are copied whole into memory they already hold
+    terrain = inputMap.terrain;
+    occupancy = inputMap.occupancy;
+    zombies.copyFrom(inputMap.zombies);
+    for (unsigned count = 0; count < zombieBuckets.size(); count++) {
+        zombieBuckets[count].store(inputMap.zombieBuckets[count].load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+    }
+    mapPlayer = nullptr;
+    zombieStreams = inputMap.zombieStreams;
+    skippedTurns = inputMap.skippedTurns;
+
+    //Only objects that differ between maps are touched
+    std::vector <int> objectCells;
+    inputMap.listObjectCells(objectCells);
+    std::vector <unsigned char> objectKinds(objectCells.size());
+    std::vector <unsigned char> objectStates(objectCells.size());
+    for (unsigned count = 0; count < objectCells.size(); count++) {
+        Space* object = inputMap.tileObjects.find(objectCells[count])->second;
+        objectKinds[count] = static_cast<unsigned char>(object->getKind());
+        objectStates[count] = static_cast<unsigned char>(object->getDoorState());
+    }
+
+    if (!keepsDoors(objectCells, objectKinds)) {
+        return false;
+    }
+    freeStrayObjects();
+    for (unsigned count = 0; count < objectCells.size(); count++) {
+        if (!placeObject(objectCells[count], objectKinds[count], objectStates[count])) {
+            return false;
+        }
+    }
+
+    moveMode = inputMap.moveMode;
+    setChaseRadius(inputMap.getChaseRadius());
+    setSightRadius(inputMap.getSightRadius());
+    setHearing(inputMap.hearing);
+    invalidateCaches();
+
+    return tileObjects.size() == inputMap.tileObjects.size();
+}
+
+//Fill list passed with tileIndex of every stateful object of map, in order
+void Map::listObjectCells(std::vector <int>& outputCells) {
+    outputCells.clear();
+    for (SpaceTable::iterator object = tileObjects.begin(); object != tileObjects.end(); object++) {
+        outputCells.push_back(object->first);
+    }
+
+    std::sort(outputCells.begin(), outputCells.end());
+}
+
+//Return whether every door of map is on an object cell of terrain layer and is a door in list of cells (in order) and
+//kinds passed. Doors are linked to other maps by Game, so they are never freed or replaced.
+bool Map::keepsDoors(const std::vector <int>& inputCells, const std::vector <unsigned char>& inputKinds) {
+    for (SpaceTable::iterator object = tileObjects.begin(); object != tileObjects.end(); object++) {
+        if (object->second->getKind() != KIND_DOOR) {
+            continue;
+        }
+
+        std::vector <int>::const_iterator found = std::lower_bound(inputCells.begin(), inputCells.end(), object->first);
+        if (terrain[object->first] != TERRAIN_OBJECT || found == inputCells.end() || *found != object->first ||
+            inputKinds[found - inputCells.begin()] != KIND_DOOR) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//Free stateful objects whose cell is no longer an object cell of terrain layer
+void Map::freeStrayObjects() {
+    std::vector <int> freedCells;
+    for (SpaceTable::iterator object = tileObjects.begin(); object != tileObjects.end(); object++) {
+        if (terrain[object->first] != TERRAIN_OBJECT) {
+            freedCells.push_back(object->first);
+        }
+    }
+
+    for (unsigned count = 0; count < freedCells.size(); count++) {
+        arena.destroy(tileObjects.find(freedCells[count])->second);
+        tileObjects.erase(freedCells[count]);
+    }
+}
+
+//Give object at tileIndex passed (an object cell of terrain layer) kind and door state passed. Object already there of
+//that kind is kept and only given door state, otherwise it is created again. Returns false if kind is not an object
+//kind, for a door missing from map or for a door given another kind, as doors are linked to other maps by Game and
+//never leave a map.
+bool Map::placeObject(int inputIndex, unsigned char inputKind, unsigned char inputState) {
+    const int row = inputIndex / cols;
+    const int col = inputIndex % cols;
+
+    SpaceTable::iterator found = tileObjects.find(inputIndex);
+    if (found != tileObjects.end() && found->second->getKind() != inputKind) {
+        if (found->second->getKind() == KIND_DOOR) {
+            return false;
+        }
+
+        arena.destroy(found->second);
+        tileObjects.erase(found);
+        found = tileObjects.end();
+    }
+
+    if (found != tileObjects.end()) {
+        if (inputKind == KIND_DOOR) {
+            static_cast<Door*>(found->second)->restoreState(static_cast<DoorState>(inputState));
+        }
+    }
+    else if (inputKind == KIND_KEY) {
+        tileObjects[inputIndex] = create<Key>(row, col);
+    }
+    else if (inputKind == KIND_KNIFE) {
+        tileObjects[inputIndex] = create<Knife>(row, col);
+    }
+    else if (inputKind == KIND_MEDICINE) {
+        tileObjects[inputIndex] = create<Medicine>(row, col);
+    }
+    else if (inputKind == KIND_EXIT_POINT) {
+        tileObjects[inputIndex] = create<ExitPoint>(row, col);
+    }
+    else {
+        return false;
+    }
+
+    return true;
+}
+
+//Drop flow field, cached paths and views and noises not yet heard, which are worked out again from map on next move,
+//after whole map may have changed
+void Map::invalidateCaches() {
+    flowField.invalidate();
+    pathfinder.clearCache();
+    sightTable.invalidate();
+    noiseField.clearNoise();
+}
+
+//Set ZombieMoveMode of map
+void Map::setMoveMode(ZombieMoveMode inputMode) {
+    moveMode = inputMode;
+}
+
+//Return ZombieMoveMode of map
+ZombieMoveMode Map::getMoveMode() {
+    return moveMode;
+}
+
+//Set number of steps from player within which zombies chase player, 0 (default) for zombies to wander at random
+void Map::setChaseRadius(int inputRadius) {
+    flowField.setRadius(inputRadius);
+}
+
+//Return number of steps from player within which zombies chase player, 0 when they wander at random
+int Map::getChaseRadius() {
+    return flowField.getRadius();
+}
+
+//Set number of cells from player within which zombies may spot player, 0 (default) for zombies to only find player next
+//to them or by chase
+void Map::setSightRadius(int inputRadius) {
+    sightTable.setRadius(inputRadius);
+}
+
+//Return number of cells from player within which zombies may spot player, 0 when they do not
+int Map::getSightRadius() {
+    return sightTable.getRadius();
+}
+
+//Return whether cell at row/col can be seen from viewer row/col within sight radius, walls, shelves and closed doors
+//blocking sight. Views are cached by viewer cell, so asking again from the same cell is a bit test.
+bool Map::canSee(int viewerRow, int viewerCol, int inputRow, int inputCol) {
+    if (sightTable.getRadius() <= 0) {
+        return false;
+    }
+
+    if (sightTable.isStale()) {
+        fillSight();
+    }
+
+    return sightTable.inView(sightTable.viewFrom(viewerRow, viewerCol), inputRow - viewerRow, inputCol - viewerCol);
+}
+
+//Set whether zombies of map are drawn by noises made on map, off by default. Noises made while off are not heard.
+void Map::setHearing(bool inputHearing) {
+    hearing = inputHearing;
+
+    if (!hearing) {
+        noiseField.clearNoise();
+    }
+}
+
+//Return whether zombies of map are drawn by noises made on map
+bool Map::getHearing() {
+    return hearing;
+}
+
+//Make noise of loudness passed (NoiseLoudness, steps over floor) at row/col, heard by zombies at start of next move.
+//Noises of one turn are spread together, so making many costs one pass. Does nothing unless map hears noise.
+void Map::makeNoise(int inputRow, int inputCol, int inputLoudness) {
+    if (hearing) {
+        noiseField.makeNoise(tileIndex(inputRow, inputCol), inputLoudness);
+    }
+}
+
+//Find shortest path zombies could walk (over floor cells) from one row/col location to another, which may be any cell.
+//Takes row/col of start and goal and vector filled with tileIndex of each cell from start to goal, left empty if there
+//is no such path.
+void Map::findPath(int startRow, int startCol, int goalRow, int goalCol, std::vector <int>& outputPath) {
+    pathfinder.findPath(terrain.data(), rows, cols, tileIndex(startRow, startCol), tileIndex(goalRow, goalCol),
+                        outputPath);
+}
+
+//Tell map that Space at row/col changed state (such as a door opening), so that flow field is built again and cached
+//views are dropped if the change can alter them. Changes made through map itself are picked up without this.
+void Map::tileChanged(int inputRow, int inputCol) {
+    const int index = tileIndex(inputRow, inputCol);
+
+    flowField.tileChanged(index, terrain[index] == TERRAIN_FLOOR);
+
+    if (!sightTable.isStale()) {
+        sightTable.setOpaque(index, blocksSight(index));
+    }
+}
+
+//Check surroundings around player for zombie. If zombie is present, player is attacked. Player pointer is passed as
+//parameter to check around up, down, left, right spaces from player.
+void Map::checkZombies(Player* inputPlayer) {
+    //Zombies next to player, from the four cells around player rather than from every zombie on map
+    unsigned neighbors[4];
+    const int neighborCount = playerNeighbors(neighbors);
+
+    //If zombie is present and player has a knife, zombie is killed, otherwise player dies. Zombies are attacked in
+    //zombie order and zombies killed are removed from arrays once all have attacked.
+    bool zombieKilled = false;
+    for (int count = 0; count < neighborCount; count++) {
+        //If player has knife, zombie is killed
+        if (inputPlayer->useItem(KIND_KNIFE)) {
+            std::cout << "Zombie attack was stopped with a knife to its head!"
+                      << std::endl;
+
+            //Remove zombie from map and mark it dead, which is heard around player
+            killZombie(neighbors[count]);
+            makeNoise(inputPlayer->getRows(), inputPlayer->getCols(), NOISE_KILL);
+            zombieKilled = true;
         }
+        //Player dies
+        else {
+            inputPlayer->setAlive(false);
+        }
+    }
+
+    if (zombieKilled) {
+        removeDeadZombies();
     }
-}
\ No newline at end of file
+}
@@ -4,61 +4,232 @@
  * Description: Map class is the abstract parent class of all Map types in game such as outdoors, field, etc... Class
  * sets up the basic framework of all maps and fine details (anything within walls) are initiated by child classes.
  * Doors leading between maps are created and initialized by Game class.
+ * Tiles are stored in two layers. The terrain layer holds one TerrainKind byte per cell in row-major order. Floors,
+ * walls and shelves are identical everywhere, so those cells all share one immutable prototype object per kind. Cells
+ * marked TERRAIN_OBJECT hold a stateful Space (door, item, exit point) found in the tileObjects layer. Player and
+ * zombies never replace terrain, they are tracked in a separate occupancy layer holding one EntityId per cell, so a move
+ * only rewrites two entries of occupancy and "is there a zombie here" is a single array read. Occupancy is the grid
+ * index of entity positions: zombies next to the player are found by reading the four cells around the player, never by
+ * looking at every zombie. For queries over a radius, the map also counts zombies in each square bucket of cells, kept
+ * up to date as zombies step between buckets, so that buckets with no zombies are skipped without reading their cells.
+ * Zombies killed during a turn are only marked dead and taken off the map, then removed from the zombie arrays together
+ * once the turn's loop is done by moving the last zombie into each dead zombie's index, so a death costs the same
+ * however many zombies there are and every other zombie is still looked at that turn. As indices change, zombies are
+ * referred to from outside the map by ZombieHandle (getZombieHandle/findZombie), which is found stale once a zombie is
+ * killed.
+ * Zombies move in one of two modes. In order (the default) each zombie sees moves of zombies before it. In two phases
+ * every zombie first proposes a move against the map as it was at start of turn, then conflicts are resolved by a fixed
+ * rule: a zombie may only step into a cell that was free at start of turn (never into player or another zombie, even
+ * one moving away) and when several zombies target one cell the zombie of lowest index takes it. Both phases run over
+ * ranges of zombies on a thread pool and give the same result for any number of threads.
+ * While the player is not in a map nothing but its own zombies changes it, and each zombie draws from its own random
+ * stream, so moving a map later gives the same result as moving it on time. A map may skip turns (skipTurn) and have
+ * them made up in bulk by catchUp before it is next looked at, which is how Game moves maps player is not in.
+ * Zombies wander at random unless the map is given a chase radius. Then every zombie within that many steps of the
+ * player follows a FlowField built from the player location, shared by all zombies of map. Field is only built again
+ * when the player moves or a tile change can change its distances, which the map hears about through setTile and doors
+ * through tileChanged.
+ * A zombie may also be given a goal cell to head for, such as a noise. Its steps are worked out by the map Pathfinder
+ * along a shortest path, cached so that zombies do not search again every turn. Cached paths are dropped whenever a
+ * cell changes between floor and blocked, which for items and doors happens in addSpaceObject and removeObject.
+ * Given a sight radius, zombies also spot the player from further away: every turn, zombies within sight radius whose
+ * cell the player can see (walls, shelves and closed doors block sight) are given the player's cell as goal, so they
+ * head for where they last saw the player. What can be seen from a cell is cached by a SightTable, so spotting costs a
+ * bit test per zombie near the player and views are only cast again when a door opens or closes.
+ * Once told to hear noises, zombies are also drawn by noise: opening a door, picking up an item and a knife kill each
+ * make a noise through makeNoise. Noises of a turn are spread together by a NoiseField at start of next move, and
+ * every zombie in a floor cell the noise reaches is given the cell of the loudest noise it hears as goal. Sight is
+ * worked out after noise, so a zombie that both hears a noise and sees the player heads for the player.
+ * Stateful Space objects are created from an Arena owned by the map through create, so resetMap releases all of them
+ * at once and rebuilds the map in the same memory. Zombies are not objects, their state is held in parallel arrays by
+ * a ZombieSwarm and every zombie cell returns one shared immutable Zombie.
+ * Spaces surrounding a location are computed from row/col through getUp/getDown/getLeft/getRight, so moving a piece
+ * only updates the tile it leaves and the tile it enters. Off the edge of the map, a cell may be linked to a Space in
+ * another map (doors between maps) through edgeLinks.
  * Variables: Integer variables for rows/cols of map size and startingRow/startingColumn of player when placed on map
+ * terrain - TerrainKind byte for each cell of map. tileObjects - stateful Space objects keyed by tileIndex.
+ * occupancy - EntityId for each cell of map. mapPlayer - Player pointer while player is in map, otherwise nullptr.
+ * terrainPrototypes - shared Floor/Wall/shelf objects returned for terrain cells.
+ * edgeLinks - Spaces in other maps reached by moving off the edge of the map from a cell, keyed by tileIndex.
+ * zombies - ZombieSwarm holding state of all zombies of map. zombiePrototype - shared Zombie returned for zombie cells.
+ * arena - Arena that all stateful Space objects of map, and nodes of tileObjects and edgeLinks, are created from.
+ * mapRandom - Random service of game that zombies of map draw from. streamBase - First random stream id of map, derived
+ * from map name. zombieStreams - Number of random streams given to zombies of map since setup.
+ * moveMode - ZombieMoveMode used by moveZombies. claims - Lowest index of zombie claiming each cell in a two phase
+ * move, or unclaimed. Only allocated once map is moved in two phases. flowField - FlowField zombies chase player along.
+ * pathfinder - Pathfinder that paths of zombies to their goals, and findPath, are found through.
+ * zombieBuckets - Number of zombies in each bucketSize by bucketSize block of cells, in row-major order of blocks.
+ * bucketCols - Number of blocks across map. sightTable - SightTable player's view is cast and cached by.
+ * sightedZombies - Zombies within sight radius of player, kept between turns. sightSlack - Steps from player within
+ * which a zombie that sees player keeps the cell it last saw player in as goal. noiseField - NoiseField noises made
+ * on map are spread by. hearing - Whether zombies of map are drawn by noise. skippedTurns - Number of turns zombies of
+ * map were not moved, to be moved later by catchUp.
+ * terrainImage/occupancyImage/zombiesImage/bucketImage/objectImageCells/objectImageKinds/objectImageStates/
+ * streamsImage - Image of map as it was set up, restored by restoreImage. imageTaken - Whether an image was taken.
+ * setupDrawsRandom - Whether mapSetup drew from Random service. imageSeed - Seed image was taken with.
+ * imageArenaBytes - Bytes arena held when image was taken.
  * Functions: Declare map size and name and player starting location for map declaration. Sets up initial details for
- * all maps. Takes string value for name of map and int values for row/col of map size and row/col of starting location
- * of player if player is initially started in that map at start of game. Sets pointers to nullptr and calls
- * initializeMap to create outline of map with walls and floor spaces.
- * Destructor frees all dynamically allocated memory of Map class that is currently within the mapTiles array at end of
- * game, as well ass the playerOccupiedSpace pointer. Zombies are deleted in child classes.
- * initializeMap - Initialize map according to size and layout provided as filled with floor spaces that are surrounded
- * by walls. Pointers for each space are assigned through setSpacePtrs.
- * setSpacePtrs - Set directional space pointers for each space. Takes Space** as the space to set pointers for and the
- * row/col location of that space as parameters. Sets all surrounding spaces to point to space passed to function.
+ * all maps. Takes string value for name of map, int values for row/col of map size and row/col of starting location of
+ * player if player is initially started in that map at start of game, and Random service of game. Sets pointers to
+ * nullptr and calls initializeMap to create outline of map with walls and floor spaces.
+ * Destructor frees all stateful Space objects of map through its arena. Player is owned by Game class.
+ * resetMap - Release all stateful Space objects and zombies at once and set map up again from scratch.
+ * create - Construct Space of type given in map arena from constructor arguments passed and return pointer to it.
+ * initializeMap - Initialize map according to size and layout provided as filled with floor terrain that is surrounded
+ * by wall terrain.
+ * setTile - Place Space at row/col. Terrain prototypes set the terrain byte, all other Spaces go in tileObjects.
+ * prototypeKind - Return TerrainKind of a shared terrain prototype, or TERRAIN_OBJECT for any other Space.
  * drawMap - Output visualization of map by character representations of all Space objects
- * removeZombie - Remove zombie passed as parameter to function from board. Does not delete zombie, but removes from map.
- * setZombieLocation - Set zombie passed as parameter on board for visualization.
- * removePlayer - Remove player from board and replace space that player was on with previous space.
- * setPlayerLocation - Set player on board and save location that player is moving to in a temporary holder. Takes
- * Player pointer address as parameter and two int values indicating row/col that player is about to move to.
- * addSpaceObject - Add Space type to location on map and link surrounding pointers. Takes Space object pointer and
- * int values for location of object in map space as parameters. Calls setSpacePtrs to set surrounding objects to point
- * to Space being added.
+ * removeZombie - Remove zombie at index of zombies from occupancy layer. Does not delete zombie.
+ * setZombieLocation - Set zombie at index of zombies in occupancy layer at zombie row/col.
+ * stepZombie - Commit proposal of zombie at index of zombies, moving it in occupancy layer and zombie buckets.
+ * bucketOf - Return zombie bucket row/col location is in.
+ * playerNeighbors - Return indices of zombies next to player, in zombie order.
+ * killZombie - Kill zombie at index of zombies, removing it from map. It is removed from zombies by removeDeadZombies.
+ * removeDeadZombies - Remove all zombies killed from zombies, each by moving last zombie into its index.
+ * addZombie - Add zombie at row/col with next random stream of map and place it on map. Used by child classes in
+ * mapSetup.
+ * addRandomZombies - Add number of zombies passed on free floor cells drawn at random, away from player start. Used by
+ * child classes in mapSetup for scenario worlds.
+ * getRandom - Return Random service of game that zombies of map draw from.
+ * removePlayer - Remove player from occupancy layer of board.
+ * setPlayerLocation - Set player in occupancy layer of board at row/col. Takes Player pointer address as parameter and
+ * two int values indicating row/col that player is about to move to.
+ * addSpaceObject - Add Space type to location on map. Takes Space object pointer (created through create) and int
+ * values for location of object in map space as parameters. Doors are told map they are in.
+ * linkEdge - Link cell at row/col to a Space in another map, reached by moving off the edge of the map from that cell.
+ * getEdgeLink - Return Space linked to cell at row/col off the edge of the map, or nullptr if there is none.
+ * getUp/getDown/getLeft/getRight - Return Space (see getSpace) above/below/left/right of row/col location or of Space
+ * passed.
+ * setTerrain - Set terrain kind of row/col location, freeing any stateful Space that was there.
+ * getTile - Return Space pointer for terrain tile at row/col location in map, ignoring any player/zombie on it.
+ * getSpace - Return Space at row/col as seen by pieces: player/zombie occupying cell, otherwise terrain tile.
+ * getEntity - Return player or zombie Space pointer for EntityId.
+ * isZombieAt/isPlayerAt - Return whether a zombie/the player occupies row/col.
+ * getRows - Return number of rows in map
+ * getCols - Return number of cols in map
+ * tileIndex - Return position of row/col location within the contiguous row-major tile store.
  * getStartRow - Return integer value for starting row for player object
  * getStartCol - Return integer value for starting col for player object
- * getCurrentSpace - Return Space pointer for current player occupied space
+ * getCurrentSpace - Return Space pointer for terrain tile player is standing on
  * mapSetup - Default map setup function for abstract virtual function (no action) - Child class map types set up map
  * using overridden function.
- * removeObject - Remove/replace item object in map after pick up with Floor space. Takes Space pointer for object
- * being removed.
- * moveZombies - Move zombies around map. Activate zombie movement function for each zombie on map while looping through
- * vector. Zombies are removed from map, new locations are determined through Zombie class, and zombies are moved. If
- * zombie attacks player but player has a knife, zombie dies and is removed from game.
+ * removeObject - Remove/replace item object in map after pick up with floor terrain, making a noise. Takes Space
+ * pointer for object being removed.
+ * moveZombies - Move zombies around map. Moves of all zombies are proposed at once by the ZombieSwarm move kernel, then
+ * committed according to move mode of map. If zombie attacks player but player has a knife, zombie dies and is removed
+ * from game. Takes ThreadPool that two phase moves are spread across, or nullptr to move on calling thread.
+ * skipTurn - Count a turn zombies of map were not moved, to be moved later by catchUp.
+ * getSkippedTurns - Return number of turns skipped since zombies of map were last caught up.
+ * catchUp - Move zombies of map once for every turn skipped.
+ * moveZombiesInOrder - Commit proposals in zombie order: each zombie steps into its target cell if no zombie moved
+ * there before it.
+ * moveZombiesTwoPhase - Propose and commit in two phases over ranges of zombies on thread pool, resolving conflicts by
+ * the two phase rule.
+ * runZombieRanges - Run function passed over ranges of zombies covering all zombies, on thread pool if given.
+ * setZombieGoal - Set cell zombie at index of zombies heads for.
+ * steerZombies - Work out next step of every zombie that has a goal, dropping goals reached or out of reach.
+ * findPath - Find shortest path zombies could walk from one row/col location to another.
+ * zombiesNear - Return indices of zombies within a number of rows and columns of row/col location.
+ * getZombieHandle - Return handle of zombie at index of zombies, which stays valid while zombie changes index.
+ * findZombie - Return index of zombie a handle refers to, or -1 if zombie has been killed since.
+ * stateHash - Return hash of everything about map that can change during a game, equal for maps in the same state.
+ * saveState - Write everything about map that can change during a game to a Snapshot: terrain packed two bits a cell,
+ * stateful objects, zombies and turns skipped.
+ * loadState - Set map to state read from a Snapshot written by saveState, in place.
+ * captureImage - Take image of map as it is now set up, for restoreImage.
+ * restoreImage - Set map back to image taken by captureImage with whole copies of its layers and zombies, in place of
+ * setting it up again. Returns false if image does not fit, and map must then be reset.
+ * arenaOutgrown - Return whether items created again have grown arena so that map must be reset.
+ * copyFrom - Set map to state and options of another map of the same size and layout, copying layers and zombies whole.
+ * listObjectCells - Fill list with tileIndex of every stateful object, in order.
+ * keepsDoors - Return whether every door of map is still a door in list of object cells and kinds passed.
+ * freeStrayObjects - Free objects whose cell is no longer an object cell of terrain layer.
+ * placeObject - Give object at cell passed kind and door state passed, creating it again if it is missing.
+ * invalidateCaches - Drop flow field, cached paths and views and noises, worked out again from map on next move.
+ * setMoveMode/getMoveMode - Set/return ZombieMoveMode of map.
+ * setChaseRadius/getChaseRadius - Set/return number of steps from player within which zombies chase, 0 to wander.
+ * setSightRadius/getSightRadius - Set/return number of cells from player within which zombies may spot player, 0 for
+ * none.
+ * canSee - Return whether one row/col location can be seen from another within sight radius.
+ * blocksSight - Return whether cell blocks sight: walls, shelves and closed doors.
+ * fillSight - Size SightTable to map and mark every cell that blocks sight.
+ * spotPlayer - Give every zombie that sees player the player's cell as goal, unless it saw player close by already.
+ * setHearing/getHearing - Set/return whether zombies of map are drawn by noise.
+ * makeNoise - Make noise of loudness passed at row/col, heard by zombies at start of next move.
+ * hearNoise - Spread noises made since last move and give every zombie reached the cell of the noise it hears as goal.
+ * tileChanged - Tell map that Space at row/col changed state, so flow field is built again if that can change it.
  * checkZombies - Check surroundings around player for zombie. If zombie is present, player is attacked. Player pointer
- * is passed as parameter to check around up, down, left, right spaces from player.
+ * is passed as parameter to check around up, down, left, right spaces from player, found through occupancy layer.
 */
 
 #ifndef MAP_HPP
 #define MAP_HPP
 
 #include <vector>
+#include <unordered_map>
+#include "Arena.hpp"
+#include "Random.hpp"
 #include "Space.hpp"
 #include "Wall.hpp"
 #include "Player.hpp"
 #include "Floor.hpp"
 #include "Zombie.hpp"
+#include "ZombieSwarm.hpp"
+#include "FlowField.hpp"
+#include "Pathfinder.hpp"
+#include "SightTable.hpp"
+#include "NoiseField.hpp"
 #include "Door.hpp"
+#include "ThreadPool.hpp"
+#include "Snapshot.hpp"
+#include <atomic>
+#include <functional>
+
+//Entity ids stored per cell in occupancy layer. Zombie at index n of zombies is stored as ZOMBIE_ENTITY + n.
+enum EntityId {
+    NO_ENTITY = 0,
+    PLAYER_ENTITY,
+    ZOMBIE_ENTITY
+};
+
+//Modes zombies of a map are moved in, see Map description
+enum ZombieMoveMode {
+    MOVE_IN_ORDER = 0,
+    MOVE_TWO_PHASE
+};
+
+//Table of Space pointers keyed by tileIndex, with nodes allocated from map arena
+typedef std::unordered_map <int, Space*, std::hash<int>, std::equal_to<int>,
+                            ArenaAllocator<std::pair<const int, Space*> > > SpaceTable;
 
 class Map {
 protected:
+    //Arena that all stateful Space objects of map are created from, along with nodes of tileObjects and edgeLinks.
+    //Declared first so that it is constructed before and destroyed after the tables using it.
+    Arena arena;
+
     //Name of map
     std::string mapName;
 
-    //Spaces/tiles in map
-    Space*** mapTiles;
+    //Terrain kind of each tile in map held in a single contiguous row-major store. Tile at row/col is found at
+    //tileIndex(row, col).
+    std::vector <unsigned char> terrain;
+
+    //Stateful Space objects (doors, items, exit points) keyed by tileIndex of cell they are in
+    SpaceTable tileObjects;
 
-    //Player occupied Space pointer
-    Space* playerOccupiedSpace;
+    //EntityId of player/zombie occupying each tile in map, held in same row-major order as terrain
+    std::vector <int> occupancy;
+
+    //Player while player is in this map, otherwise nullptr
+    Player* mapPlayer;
+
+    //Shared immutable prototype for each terrain kind, indexed by TerrainKind
+    static Space* const terrainPrototypes[TERRAIN_OBJECT];
+
+    //Spaces in other maps reached by moving off the edge of this map from a cell, keyed by tileIndex of the cell
+    SpaceTable edgeLinks;
 
     //Size of map
     int rows,
@@ -68,72 +239,476 @@ protected:
     int startRow,
         startCol;
 
-    //Zombies placed on map held in vector container
-    std::vector <Zombie*> zombies;
+    //State of all zombies placed on map, held in parallel arrays
+    ZombieSwarm zombies;
+
+    //Shared immutable Zombie returned for every zombie cell
+    static Space* const zombiePrototype;
+
+    //Random service of game that zombies of map draw from
+    Random* mapRandom;
+
+    //First random stream id of map, derived from map name, and number of streams given to zombies of map since setup.
+    //Zombie n created by mapSetup always draws from stream streamBase + n.
+    uint64_t streamBase;
+    uint64_t zombieStreams;
+
+    //Mode zombies of map are moved in
+    ZombieMoveMode moveMode;
+
+    //Lowest index of zombie claiming each cell during a two phase move, unclaimedCell otherwise. Sized to map on first
+    //two phase move.
+    std::vector <std::atomic<unsigned> > claims;
+    static const unsigned unclaimedCell = ~0u;
+
+    //Number of zombies in each range of a two phase move handed to thread pool
+    static const unsigned zombieRange = 16384;
+
+    //Distances from player that zombies chase along, built only while map has a chase radius and player is in map
+    FlowField flowField;
+
+    //Paths of zombies to their goals, cached between turns
+    Pathfinder pathfinder;
+
+    //Number of zombies in each bucketSize by bucketSize block of cells, in row-major order of blocks, and number of
+    //blocks across map. Counts are atomic as zombies of separate ranges of a two phase move may step between blocks at
+    //once.
+    static const int bucketShift = 4;
+    static const int bucketSize = 1 << bucketShift;
+    std::vector <std::atomic<unsigned> > zombieBuckets;
+    int bucketCols;
+
+    //Views of player cast within sight radius and cached by viewer cell, and zombies within sight radius of player
+    SightTable sightTable;
+    std::vector <unsigned> sightedZombies;
+
+    //Steps from player within which a zombie that sees player keeps the cell it last saw player in as goal, so that
+    //its path is not found again for every step player takes
+    static const int sightSlack = 2;
+
+    //Noises made on map since last move and whether zombies of map are drawn by them
+    NoiseField noiseField;
+    bool hearing;
+
+    //Number of turns zombies of map were not moved, to be moved later by catchUp
+    unsigned skippedTurns;
+
+    //Image of map as it was set up, restored by restoreImage in place of setting map up again: terrain and occupancy
+    //layers, zombies, zombie counts per block, cell, kind and door state of each stateful object in tileIndex order,
+    //and number of random streams given to zombies
+    std::vector <unsigned char> terrainImage;
+    std::vector <int> occupancyImage;
+    ZombieSwarm zombiesImage;
+    std::vector <unsigned> bucketImage;
+    std::vector <int> objectImageCells;
+    std::vector <unsigned char> objectImageKinds;
+    std::vector <unsigned char> objectImageStates;
+    uint64_t streamsImage;
+
+    //Whether an image was taken, whether mapSetup drew from Random service (so that image only fits seed it was taken
+    //with), seed image was taken with and bytes arena held when it was taken
+    bool imageTaken;
+    bool setupDrawsRandom;
+    uint64_t imageSeed;
+    std::size_t imageArenaBytes;
+
+    //Bytes arena may grow past twice its size when image was taken before restoreImage asks for map to be reset
+    static const std::size_t imageArenaSlack = 4096;
+
+    //Fill list passed with tileIndex of every stateful object of map, in order
+    void listObjectCells(std::vector <int>& outputCells);
 
-    //Initialize map according to size and layout provided as filled with floor spaces that are surrounded by walls.
-    //Pointers for each space are assigned through setSpacePtrs.
+    //Return whether every door of map is on an object cell of terrain layer and is a door in list of cells (in order)
+    //and kinds passed. Doors are linked to other maps by Game, so they are never freed or replaced.
+    bool keepsDoors(const std::vector <int>& inputCells, const std::vector <unsigned char>& inputKinds);
+
+    //Free stateful objects whose cell is no longer an object cell of terrain layer
+    void freeStrayObjects();
+
+    //Give object at tileIndex passed (an object cell of terrain layer) kind and door state passed. Object already there
+    //of that kind is kept and only given door state, otherwise it is created again. Returns false if kind is not an
+    //object kind, for a door missing from map or for a door given another kind, as doors are linked to other maps by
+    //Game and never leave a map.
+    bool placeObject(int inputIndex, unsigned char inputKind, unsigned char inputState);
+
+    //Drop flow field, cached paths and views and noises not yet heard, which are worked out again from map on next
+    //move, after whole map may have changed
+    void invalidateCaches();
+
+    //Initialize map according to size and layout provided as filled with floor terrain that is surrounded by wall
+    //terrain.
     void initializeMap();
 
-    //Set directional space pointers for each space. Takes Space** as the space to set pointers for and the row/col
-    //location of that space as parameters. Sets all surrounding spaces to point to space passed to function.
-    void setSpacePtrs(Space**, int, int);
+    //Place Space at row/col. Terrain prototypes set the terrain byte, all other Spaces go in tileObjects.
+    void setTile(Space*, int, int);
+
+    //Return TerrainKind of a shared terrain prototype, or TERRAIN_OBJECT for any other Space.
+    static int prototypeKind(Space*);
+
+    //Remove zombie at index of zombies from occupancy layer. Does not delete zombie, but removes from map.
+    void removeZombie(unsigned);
+
+    //Set zombie at index of zombies in occupancy layer at zombie row/col.
+    void setZombieLocation(unsigned);
+
+    //Commit proposal of zombie at index of zombies (see ZombieSwarm::commit), moving it in occupancy layer and, when it
+    //steps into another block of cells, in zombie buckets. Takes whether zombie is allowed to step into its target
+    //cell. Defined in header as it is called for every zombie every turn.
+    void stepZombie(unsigned zombieIndex, bool inputStepped) {
+        //Zombie staying in its cell only takes its new direction and moves left
+        if (!inputStepped) {
+            zombies.commit(zombieIndex, inputStepped);
+            return;
+        }
+
+        const int oldBucket = bucketOf(zombies.rows[zombieIndex], zombies.cols[zombieIndex]);
+
+        removeZombie(zombieIndex);
+        zombies.commit(zombieIndex, inputStepped);
+        setZombieLocation(zombieIndex);
+
+        const int newBucket = bucketOf(zombies.rows[zombieIndex], zombies.cols[zombieIndex]);
+        if (newBucket != oldBucket) {
+            zombieBuckets[oldBucket].fetch_sub(1, std::memory_order_relaxed);
+            zombieBuckets[newBucket].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    //Return zombie bucket row/col location (inside map) is in. Blocks are a power of two cells wide, so this is two
+    //shifts.
+    int bucketOf(int inputRow, int inputCol) const {
+        return (inputRow >> bucketShift) * bucketCols + (inputCol >> bucketShift);
+    }
+
+    //Return number of zombies next to player (up, down, left, right) and write their indices of zombies, in zombie
+    //order, into array passed. Found from occupancy layer, so cost does not depend on number of zombies.
+    int playerNeighbors(unsigned outputIndices[4]);
+
+    //Kill zombie at index of zombies, removing it from occupancy layer and zombie buckets. Zombie keeps its index, so
+    //zombies may be killed while zombies are walked, and is removed from zombies by removeDeadZombies.
+    void killZombie(unsigned);
+
+    //Remove all zombies killed from zombies, each by moving last zombie into its index, and renumber zombies moved in
+    //occupancy layer. Cost grows with zombies killed, not with number of zombies.
+    void removeDeadZombies();
+
+    //Add zombie at row/col with next random stream of map and place it on map. Used by child classes in mapSetup.
+    void addZombie(int, int);
+
+    //Add number of zombies passed on free floor cells drawn at random, leaving cells within two steps of player
+    //starting location free. Cells are drawn from the stream just below first zombie stream of map, so the same map
+    //and seed always get zombies in the same cells. Stops early if free cells are too hard to find. Used by child
+    //classes in mapSetup for scenario worlds larger than the standard game.
+    void addRandomZombies(int);
+
+    //Commit proposals in zombie order: each zombie steps into its target cell if no zombie moved there before it.
+    //Takes player location and FlowField as passed to propose.
+    void moveZombiesInOrder(int playerRow, int playerCol, const FlowField* inputField);
+
+    //Propose and commit in two phases over ranges of zombies on thread pool passed (or calling thread if nullptr),
+    //resolving conflicts by the two phase rule. Takes player location and FlowField as passed to propose.
+    void moveZombiesTwoPhase(ThreadPool* inputPool, int playerRow, int playerCol, const FlowField* inputField);
+
+    //Run function passed over ranges of zombies (begin and end index) covering all zombies, one task per range on
+    //thread pool passed, or as one range on calling thread if nullptr. Returns when all ranges are done.
+    void runZombieRanges(ThreadPool* inputPool, const std::function<void(unsigned, unsigned)>& inputRange);
+
+    //Set cell zombie at index of zombies heads for along a shortest path until it gets there, as a goal of any kind but
+    //sight. Takes index of zombie and row/col of goal.
+    void setZombieGoal(unsigned zombieIndex, int inputRow, int inputCol);
+
+    //Return whether cell at tileIndex passed blocks sight: walls, shelves and closed doors
+    bool blocksSight(int inputIndex);
+
+    //Size SightTable to map and mark every cell that blocks sight, done on first use and after map is set up again
+    void fillSight();
+
+    //Give every zombie within sight radius of player that player can see the player's cell as goal, so that it heads
+    //for where it last saw player. A zombie that saw player before keeps that goal while it is within sightSlack steps
+    //of player, and any other goal, such as a noise, gives way. Takes player row/col.
+    void spotPlayer(int playerRow, int playerCol);
+
+    //Spread noises made since last move in one pass and give every zombie in a cell reached the cell of the loudest
+    //noise heard there as goal
+    void hearNoise();
+
+    //Work out next step of every zombie that has a goal, on calling thread as paths are cached. Goals reached, out of
+    //reach, or next to the zombie but not floor (so never stepped on) are dropped and zombie wanders again.
+    void steerZombies();
+
+    //Return position of row/col location within the contiguous row-major tile store. Defined in header so that tile
+    //lookups in map scans are inlined.
+    int tileIndex(int inputRow, int inputCol) const {
+        return inputRow * cols + inputCol;
+    }
 
 public:
     //Declare map size and name and player starting location for map declaration. Sets up initial details for all maps.
-    //Takes string value for name of map and int values for row/col of map size and row/col of starting location of player
-    //if player is initially started in that map at start of game. Sets pointers to nullptr and calls initializeMap to
-    //create outline of map with walls and floor spaces.
-    Map(std::string, int, int, int, int);
+    //Takes string value for name of map, int values for row/col of map size and row/col of starting location of player
+    //if player is initially started in that map at start of game, and Random service of game. Sets pointers to nullptr
+    //and calls initializeMap to create outline of map with walls and floor spaces.
+    Map(std::string, int, int, int, int, Random*);
 
-    //Destructor frees all dynamically allocated memory of Map class that is currently within the mapTiles array at end
-    //of game, as well ass the playerOccupiedSpace pointer. Zombies are deleted in child classes.
+    //Destructor frees all stateful Space objects of map through its arena. Player is owned by Game class.
     virtual ~Map();
 
-    //Output visualization of map by character representations of all Space objects
-    void drawMap();
+    //Release all stateful Space objects and zombies at once and set map up again from scratch through initializeMap
+    //and mapSetup. Edge links to other maps and player are removed, Game links doors and places player again.
+    void resetMap();
 
-    //Remove zombie passed as parameter to function from board. Does not delete zombie, but removes from map.
-    void removeZombie(Zombie*);
+    //Construct Space of type given in map arena from constructor arguments passed and return pointer to it. Memory is
+    //given back when map is reset or destroyed. Defined in header as it is a template.
+    template <class T, class... Args>
+    T* create(Args&&... inputArgs) {
+        return arena.create<T>(std::forward<Args>(inputArgs)...);
+    }
 
-    //Set zombie passed as parameter on board for visualization.
-    void setZombieLocation(Zombie*&);
+    //Output visualization of map by character representations of all Space objects
+    void drawMap();
 
-    //Remove player from board and replace space that player was on with previous space.
+    //Remove player from occupancy layer of board.
     void removePlayer(Player*);
 
-    //Set player on board and save location that player is moving to in a temporary holder. Takes Player pointer address
-    //as parameter and two int values indicating row/col that player is about to move to.
+    //Set player in occupancy layer of board at row/col. Takes Player pointer address as parameter and two int values
+    //indicating row/col that player is about to move to.
     void setPlayerLocation(Player*&, int, int);
 
-    //Add Space type to location on map and link surrounding pointers. Takes Space object pointer and
-    //int values for location of object in map space as parameters. Calls setSpacePtrs to set surrounding
-    //objects to point to Space being added.
+    //Add Space type to location on map. Takes Space object pointer (created through create) and int values for location
+    //of object in map space as parameters. Doors are told map they are in, so that they report opening and closing.
     void addSpaceObject(Space* inputSpace, int inputRow, int inputCol);
 
+    //Link cell at row/col to a Space in another map, reached by moving off the edge of the map from that cell. Takes
+    //int values for row/col and the linked Space pointer as parameters.
+    void linkEdge(int inputRow, int inputCol, Space* inputLink);
+
+    //Return Space linked to cell at row/col off the edge of the map, or nullptr if there is none.
+    Space* getEdgeLink(int inputRow, int inputCol);
+
+    //Set terrain kind of row/col location, freeing any stateful Space that was there. Takes int values for row/col
+    //and TerrainKind as parameters.
+    void setTerrain(int inputRow, int inputCol, TerrainKind inputKind);
+
+    //Return Space pointer for terrain tile at row/col location of map, ignoring any player/zombie on it. Takes int
+    //values for row/col as parameters. Defined in header alongside tileIndex so that scans over the map inline the
+    //lookup.
+    Space* getTile(int inputRow, int inputCol) {
+        const int index = tileIndex(inputRow, inputCol);
+        const unsigned char kind = terrain[index];
+
+        if (kind != TERRAIN_OBJECT) {
+            return terrainPrototypes[kind];
+        }
+
+        return tileObjects.find(index)->second;
+    }
+
+    //Return player or zombie Space pointer for EntityId passed as parameter
+    Space* getEntity(int inputEntity) {
+        return (inputEntity == PLAYER_ENTITY) ? static_cast<Space*>(mapPlayer) : zombiePrototype;
+    }
+
+    //Return Space at row/col as seen by pieces on map: player/zombie occupying cell if any, otherwise terrain tile.
+    Space* getSpace(int inputRow, int inputCol) {
+        const int occupant = occupancy[tileIndex(inputRow, inputCol)];
+
+        return (occupant == NO_ENTITY) ? getTile(inputRow, inputCol) : getEntity(occupant);
+    }
+
+    //Return whether a zombie occupies row/col
+    bool isZombieAt(int inputRow, int inputCol) {
+        return occupancy[tileIndex(inputRow, inputCol)] >= ZOMBIE_ENTITY;
+    }
+
+    //Return whether the player occupies row/col
+    bool isPlayerAt(int inputRow, int inputCol) {
+        return occupancy[tileIndex(inputRow, inputCol)] == PLAYER_ENTITY;
+    }
+
+    //Return Space above row/col location. Off the top edge of the map, return Space linked to cell if any.
+    Space* getUp(int inputRow, int inputCol) {
+        return (inputRow > 0) ? getSpace(inputRow-1, inputCol) : getEdgeLink(inputRow, inputCol);
+    }
+
+    //Return Space below row/col location. Off the bottom edge of the map, return Space linked to cell if any.
+    Space* getDown(int inputRow, int inputCol) {
+        return (inputRow < rows-1) ? getSpace(inputRow+1, inputCol) : getEdgeLink(inputRow, inputCol);
+    }
+
+    //Return Space left of row/col location. Off the left edge of the map, return Space linked to cell if any.
+    Space* getLeft(int inputRow, int inputCol) {
+        return (inputCol > 0) ? getSpace(inputRow, inputCol-1) : getEdgeLink(inputRow, inputCol);
+    }
+
+    //Return Space right of row/col location. Off the right edge of the map, return Space linked to cell if any.
+    Space* getRight(int inputRow, int inputCol) {
+        return (inputCol < cols-1) ? getSpace(inputRow, inputCol+1) : getEdgeLink(inputRow, inputCol);
+    }
+
+    //Return Space above Space passed as parameter, from its row/col
+    Space* getUp(Space* inputSpace) {
+        return getUp(inputSpace->getRows(), inputSpace->getCols());
+    }
+
+    //Return Space below Space passed as parameter, from its row/col
+    Space* getDown(Space* inputSpace) {
+        return getDown(inputSpace->getRows(), inputSpace->getCols());
+    }
+
+    //Return Space left of Space passed as parameter, from its row/col
+    Space* getLeft(Space* inputSpace) {
+        return getLeft(inputSpace->getRows(), inputSpace->getCols());
+    }
+
+    //Return Space right of Space passed as parameter, from its row/col
+    Space* getRight(Space* inputSpace) {
+        return getRight(inputSpace->getRows(), inputSpace->getCols());
+    }
+
+    //Return Random service of game that zombies of map draw from
+    Random* getRandom() {
+        return mapRandom;
+    }
+
+    //Return integer value for number of rows in map
+    int getRows();
+
+    //Return integer value for number of columns in map
+    int getCols();
+
     //Return integer value for starting row for player object
     int getStartRow();
 
     //Return integer value for starting column for player object
     int getStartCol();
 
-    //Return Space pointer for current player occupied space
+    //Return Space pointer for terrain tile player is standing on
     Space* getCurrentSpace();
 
     //Default map setup function for abstract virtual function (no action) - Child class map types set up map using
     //overridden function.
     virtual void mapSetup() = 0;
 
-    //Remove/replace item object in map after pick up with floor space. Takes Space pointer for object being removed.
+    //Remove/replace item object in map after pick up with floor terrain. Picking an item up makes a noise. Takes Space
+    //pointer for object being removed.
     void removeObject(Space*);
 
-    //Move zombies around map. Activate zombie movement function for each zombie on map while looping through vector.
-    //Zombies are removed from map, new locations are determined through Zombie class, and zombies are moved. If zombie
-    //attacks player but player has a knife, zombie dies and is removed from game.
-    void moveZombies();
+    //Move zombies around map. Moves of all zombies are proposed at once by the ZombieSwarm move kernel, then committed
+    //according to move mode of map. If zombie attacks player but player has a knife, zombie dies and is removed from
+    //game. Takes ThreadPool that two phase moves are spread across, or nullptr to move on calling thread. Pool must not
+    //be running a task that calls this.
+    void moveZombies(ThreadPool* inputPool = nullptr);
+
+    //Count a turn zombies of map were not moved, to be moved later by catchUp. Only for maps player is not in, as
+    //zombies moved late must not see a player that was not there.
+    void skipTurn();
+
+    //Return number of turns skipped since zombies of map were last caught up
+    unsigned getSkippedTurns();
+
+    //Move zombies of map once for every turn skipped, leaving map as if it had been moved every turn. Takes ThreadPool
+    //as moveZombies.
+    void catchUp(ThreadPool* inputPool = nullptr);
+
+    //Set ZombieMoveMode of map
+    void setMoveMode(ZombieMoveMode inputMode);
+
+    //Return ZombieMoveMode of map
+    ZombieMoveMode getMoveMode();
+
+    //Set number of steps from player within which zombies chase player, 0 (default) for zombies to wander at random
+    void setChaseRadius(int inputRadius);
+
+    //Return number of steps from player within which zombies chase player, 0 when they wander at random
+    int getChaseRadius();
+
+    //Set number of cells from player within which zombies may spot player, 0 (default) for zombies to only find player
+    //next to them or by chase
+    void setSightRadius(int inputRadius);
+
+    //Return number of cells from player within which zombies may spot player, 0 when they do not
+    int getSightRadius();
+
+    //Return whether cell at row/col can be seen from viewer row/col within sight radius, walls, shelves and closed
+    //doors blocking sight. Views are cached by viewer cell, so asking again from the same cell is a bit test.
+    bool canSee(int viewerRow, int viewerCol, int inputRow, int inputCol);
+
+    //Set whether zombies of map are drawn by noises made on map, off by default. Noises made while off are not heard.
+    void setHearing(bool inputHearing);
+
+    //Return whether zombies of map are drawn by noises made on map
+    bool getHearing();
+
+    //Make noise of loudness passed (NoiseLoudness, steps over floor) at row/col, heard by zombies at start of next
+    //move. Noises of one turn are spread together, so making many costs one pass. Does nothing unless map hears noise.
+    void makeNoise(int inputRow, int inputCol, int inputLoudness);
+
+    //Tell map that Space at row/col changed state (such as a door opening), so that flow field is built again and
+    //cached views are dropped if the change can alter them. Changes made through map itself are picked up without this.
+    void tileChanged(int inputRow, int inputCol);
+
+    //Return indices of zombies within a number of rows and columns of row/col location, in no particular order. Blocks
+    //of cells holding no zombies are skipped, so cost depends on area covered by radius and zombies near location, not
+    //on number of zombies in map. Takes row/col, radius and vector filled with indices of zombies.
+    void zombiesNear(int inputRow, int inputCol, int inputRadius, std::vector <unsigned>& outputIndices);
+
+    //Return handle of zombie at index of zombies (as returned by zombiesNear). Handle keeps referring to zombie while
+    //its index changes as other zombies are removed.
+    ZombieHandle getZombieHandle(unsigned zombieIndex);
+
+    //Return index of zombie handle passed refers to, or -1 if zombie has been killed since handle was taken
+    int findZombie(ZombieHandle inputHandle);
+
+    //Return hash of everything about map that can change during a game: terrain, state of doors and other objects,
+    //player location and location, direction, random stream position and goal of every zombie in index order. Equal
+    //for maps in the same state, so two runs of a game can be checked to have ended the same.
+    uint64_t stateHash();
+
+    //Write everything about map that can change during a game to snapshot passed: terrain kind of every cell packed two
+    //bits a cell, kind (and door state) of each stateful object in tileIndex order, every zombie in index order and
+    //turns skipped. Things worked out from these (flow field, cached paths and views) and handles to zombies are not
+    //saved. Player is saved by Game.
+    void saveState(Snapshot& outputSnapshot);
+
+    //Set map to state read from snapshot passed, as written by saveState of a map of the same size and layout. Map is
+    //changed in place: terrain is unpacked straight into terrain layer, objects still on map are kept and only given
+    //their saved state, items picked up since are freed and items picked up in save are created again, and zombies are
+    //placed from saved arrays. Player is taken off map, Game places it. Flow field, cached paths and views are dropped
+    //and worked out again, so a zombie heading for a goal may take another shortest path of the same length. Returns
+    //false if snapshot does not hold a state of this map, after which map must be reset before it is used.
+    bool loadState(Snapshot& inputSnapshot);
+
+    //Take image of map as it is now set up (before player is placed), for restoreImage. Game takes it once maps are
+    //set up and doors linked.
+    void captureImage();
+
+    //Set map back to image taken by captureImage in place of setting it up again: terrain and occupancy layers and
+    //zombie arrays are copied whole, objects still on map are kept and only given their door state, and items picked up
+    //since are created again. Cost does not depend on how map is set up by mapSetup. Edge links are kept and player is
+    //taken off map. Returns false, after which map must be reset, if no image was taken, if mapSetup drew from Random
+    //service with another seed than image was taken with, or once items created again have grown arena past twice its
+    //size when image was taken (its memory is only given back by a reset).
+    bool restoreImage();
+
+    //Return whether items created again by restoreImage or copyFrom have grown arena past twice its size when image
+    //was taken (its memory is only given back by a reset), after which map must be reset
+    bool arenaOutgrown();
+
+    //Set map to state of map passed, of the same size and layout, such as the same map of another Game: terrain and
+    //occupancy layers and zombie arrays are copied whole, objects still on map are kept and only given their door
+    //state, and objects missing are created again. Chase radius, sight radius, hearing and move mode are copied too.
+    //Map passed is only read, so several maps may copy the same map at once. Player is not copied, but its cell in
+    //occupancy layer is, so Game places its own player there. Flow field, cached paths and views are dropped as by
+    //loadState. Returns false if map passed is of another size or a door of it is missing from this map, after which
+    //map must be reset before it is used.
+    bool copyFrom(Map& inputMap);
+
+    //Find shortest path zombies could walk (over floor cells) from one row/col location to another, which may be any
+    //cell. Takes row/col of start and goal and vector filled with tileIndex of each cell from start to goal, left empty
+    //if there is no such path.
+    void findPath(int startRow, int startCol, int goalRow, int goalCol, std::vector <int>& outputPath);
 
     //Check surroundings around player for zombie. If zombie is present, player is attacked. Player pointer is passed as
-    //parameter to check around up, down, left, right spaces from player.
+    //parameter to check around up, down, left, right spaces from player, found through occupancy layer.
     void checkZombies(Player* inputPlayer);
 };
 
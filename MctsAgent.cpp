@@ -0,0 +1,542 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: MctsAgent class is an Agent that plays the game it is given by Monte Carlo tree search. Each turn it
+ * plays a budget of rollouts on copies of the game (see Game::copyFrom): a rollout walks down a search tree of actions
+ * from the state of the game, picking the child with the best upper confidence bound at each node, adds the children
+ * of the node it stops at, then plays on for up to rolloutDepth actions and scores the state it reaches. Rollouts
+ * play towards the target of the stage reached, with one action in rolloutRandomness at random. Score is 1 for a won
+ * game and 0 for a lost one. Otherwise the game is split into the stages of its win path (find the key, unlock the
+ * locked door, take the medicine, reach the exit point with it), and score is the stage reached plus how close player
+ * is to the target of that stage, measured by a breadth first search over all maps of the world from the targets of
+ * each stage, done once per turn. A game plays out the same for the same actions, so a node is worth the best score a
+ * rollout through it reached rather than the mean, which zombies wandering into the far ends of rollouts would drag
+ * down. Actions are moves (W/S/A/D) player can take and interactions (E) with the Spaces around player, a key held
+ * always being used on a locked door, so that every action takes a turn or moves player into another map. Action
+ * played is the child of the root that most rollouts went through.
+ * Rollouts are spread over a ThreadPool, each thread playing on a Game of its own: every thread takes rollouts from a
+ * shared atomic count until the budget is used up, so a thread that finishes early keeps taking rollouts in place of
+ * sitting idle. Threads share one tree, whose counts are atomic. A node is expanded by the first thread to claim it,
+ * and a thread walking down the tree adds a virtual loss to each node it passes until its rollout is scored, so that
+ * threads walking down at the same time spread over different branches. Rollouts draw from a Random service seeded
+ * from seed of game, so with one thread a game is played the same every time it is played with that seed.
+ * Variables: game - Game agent plays, read as the root of each search. threadGames - Game each thread plays rollouts
+ * on. pool - ThreadPool rollouts are spread over. budget - Number of rollouts each turn. nodes - Nodes of search
+ * tree. nodeCount - Number of nodes in use. nextRollout - Number of rollouts started this turn. random - Random service
+ * seeded from seed of current game. turn - Number of turns searched this game. paths - Nodes walked by current rollout
+ * of each thread. stageFields - Steps to a target of each stage from every cell of every map. lockedDoors - Cells of
+ * locked doors. rollouts - Number of rollouts played over every game. searchSeconds - Seconds spent searching over
+ * every game.
+ * Functions: Constructor takes game to play, rollout budget per turn and number of threads.
+ * Destructor deletes game copies of threads.
+ * startGame - Get ready to play a new game of seed passed.
+ * chooseAction - Search rollout budget and return action most rollouts went through.
+ * getRollouts - Return number of rollouts played over every game.
+ * getSearchSeconds - Return seconds spent searching over every game.
+ * listActions - List actions player can take on map.
+ * playRollout - Play one rollout on game of thread passed.
+ * selectChild - Return child of node with best upper confidence bound.
+ * expandNode - Add children of node, one per action player can take.
+ * scoreGame - Return score of game passed.
+ * stageOf - Return stage of win path game passed has reached.
+ * stepsTo - Return steps to a target of a stage from cell next to player.
+ * rolloutAction - Return action of a rollout, most often towards target of stage reached.
+ * buildStageFields - Find steps to a target of each stage from every cell of every map of game.
+ * mapIndex - Return index of map passed among maps of game.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include "MctsAgent.hpp"
+
+//Stream random choices of rollouts are drawn from, apart from every stream of maps of the same seed
+static const uint64_t agentStream = Random::nameStream("MctsAgent");
+
+//Control selection of each direction of interaction, 1 up through 4 right
+static const char directionKeys[5] = {' ', 'W', 'S', 'A', 'D'};
+
+//Weight of exploration in upper confidence bound of a child. Scores of actions differ by a step closer to a target,
+//a small part of score, so exploration is kept low.
+const double MctsAgent::exploration = 0.03;
+
+//Score of a state reached is multiplied by this for each action taken to reach it
+const double MctsAgent::discount = 0.9995;
+
+//Steps from target of a stage at which player is scored halfway between that stage and the next
+const double MctsAgent::closeSteps = 64.0;
+
+//Constructor takes game to play, number of rollouts each turn and number of threads rollouts are spread over (calling
+//thread and workers of a pool of its own). Game is copied for each thread, and must be the game the agent is played
+//by.
+MctsAgent::MctsAgent(Game& inputGame, unsigned inputBudget, unsigned inputThreads) :
+        game(&inputGame), pool((inputThreads > 1) ? inputThreads - 1 : 0), budget(inputBudget),
+        nodes((inputBudget < static_cast<unsigned>(maxNodes / maxActions)) ? 1 + maxActions * inputBudget : maxNodes),
+        nodeCount(0), nextRollout(0), random(0), turn(0), paths(pool.getThreadCount()), rollouts(0),
+        searchSeconds(0.0) {
+    //Rollouts of each thread are played on a copy of game, moving its maps on that thread
+    for (unsigned thread = 0; thread < pool.getThreadCount(); thread++) {
+        threadGames.push_back(inputGame.clone());
+        threadGames.back()->setRender(false);
+    }
+}
+
+//Destructor deletes game copies of threads
+MctsAgent::~MctsAgent() {
+    for (unsigned thread = 0; thread < threadGames.size(); thread++) {
+        delete threadGames[thread];
+    }
+}
+
+//Get ready to play a new game of seed passed, called before each game
+void MctsAgent::startGame(uint64_t inputSeed) {
+    random.setSeed(inputSeed);
+    turn = 0;
+}
+
+//Search rollout budget from state of game and return action most rollouts went through. Map and player passed are
+//those of game.
+AgentAction MctsAgent::chooseAction(Map* inputMap, Player* inputPlayer) {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    buildStageFields();
+
+    //Tree is searched again from root each turn
+    Node& root = nodes[0];
+    root.firstChild = 0;
+    root.childCount = 0;
+    root.visits = 0;
+    root.virtualLoss = 0;
+    root.bestScore = 0.0;
+    root.state = NODE_LEAF;
+    nodeCount = 1;
+    nextRollout = 0;
+
+    //Every thread takes rollouts until budget is used up
+    pool.run(pool.getThreadCount(), [this](unsigned inputThread) {
+        for (unsigned rollout = nextRollout++; rollout < budget; rollout = nextRollout++) {
+            playRollout(inputThread, rollout);
+        }
+    });
+
+    turn++;
+    rollouts += budget;
+
+    //Action most rollouts went through, ties broken by score
+    AgentAction action;
+    int best = -1;
+    for (int child = root.firstChild; child < root.firstChild + root.childCount; child++) {
+        if (best < 0 || nodes[child].visits > nodes[best].visits ||
+            (nodes[child].visits == nodes[best].visits && nodes[child].bestScore > nodes[best].bestScore)) {
+            best = child;
+        }
+    }
+
+    if (best >= 0) {
+        action = nodes[best].action;
+    }
+    //No rollouts were played, take first action player can take
+    else {
+        AgentAction actions[maxActions];
+        listActions(inputMap, inputPlayer, actions);
+        action = actions[0];
+    }
+
+    searchSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return action;
+}
+
+//Return number of rollouts played over every game
+unsigned long long MctsAgent::getRollouts() {
+    return rollouts;
+}
+
+//Return seconds spent searching over every game
+double MctsAgent::getSearchSeconds() {
+    return searchSeconds;
+}
+
+//List actions player can take on map passed into array passed: a move in each direction player can move in (onto a
+//cell that is not solid, or off an open door into the map behind it) and an interaction with each Space next to player
+//that can be interacted with and is not an open door. Returns number of actions listed, with a move into a wall listed
+//should player be boxed in, as playAgent passes turn once an agent keeps bumping into walls.
+int MctsAgent::listActions(Map* inputMap, Player* inputPlayer, AgentAction outputActions[]) {
+    const bool onOpenDoor = inputMap->getCurrentSpace()->isOpenDoor();
+    int count = 0;
+
+    for (int direction = 1; direction <= 4; direction++) {
+        Space* space = spaceInDirection(inputMap, inputPlayer, direction);
+        if (space == nullptr) {
+            continue;
+        }
+
+        //Key is always used on a locked door
+        if (space->getInteract() && !space->isOpenDoor()) {
+            outputActions[count].selection = 'E';
+            outputActions[count].direction = direction;
+            outputActions[count].keyChoice = 1;
+            count++;
+        }
+        if (!space->getSolid() || (onOpenDoor && space->getMapId() != MAP_NONE)) {
+            outputActions[count].selection = directionKeys[direction];
+            outputActions[count].direction = direction;
+            outputActions[count].keyChoice = 1;
+            count++;
+        }
+    }
+
+    if (count == 0) {
+        outputActions[0].selection = directionKeys[1];
+        outputActions[0].direction = 1;
+        outputActions[0].keyChoice = 1;
+        count = 1;
+    }
+
+    return count;
+}
+
+//Play one rollout on game of thread passed: copy game, walk down tree, expand node reached, play on through
+//rolloutAction and add score of state reached to every node walked. Takes thread and number of rollout this turn, which
+//random choices are drawn from.
+void MctsAgent::playRollout(unsigned inputThread, unsigned inputRollout) {
+    Game& copy = *threadGames[inputThread];
+    copy.copyFrom(*game);
+
+    std::vector <int>& path = paths[inputThread];
+    path.clear();
+    path.push_back(0);
+
+    GameOutcome outcome = OUTCOME_QUIT;
+    bool playing = true;
+    int node = 0;
+    int actionCount = 0;
+
+    //Walk down expanded nodes, children of a node being read only once its expansion is seen to have finished
+    while (playing && nodes[node].state.load(std::memory_order_acquire) == NODE_EXPANDED &&
+           nodes[node].childCount > 0) {
+        node = selectChild(node);
+        nodes[node].virtualLoss++;
+        path.push_back(node);
+        playing = copy.playAction(nodes[node].action, outcome);
+        actionCount++;
+    }
+
+    //Add children of node reached and go on through one of them
+    if (playing && expandNode(node, copy)) {
+        node = selectChild(node);
+        nodes[node].virtualLoss++;
+        path.push_back(node);
+        playing = copy.playAction(nodes[node].action, outcome);
+        actionCount++;
+    }
+
+    //Play on from there, towards target of stage reached
+    const uint64_t counterBase = (turn * budget + inputRollout) * rolloutDepth;
+    AgentAction actions[maxActions];
+    for (int step = 0; playing && step < rolloutDepth; step++) {
+        const int count = listActions(copy.getCurrentMap(), copy.getPlayer(), actions);
+        playing = copy.playAction(rolloutAction(copy, actions, count, counterBase + step), outcome);
+        actionCount++;
+    }
+
+    //Game plays out the same for the same actions, so a node is worth the best state any rollout through it reached.
+    //Score is discounted by actions taken to reach state, else once a stage is within reach of every child there is
+    //nothing to choose between reaching it now and later.
+    const double score = scoreGame(copy, playing, outcome) * std::pow(discount, actionCount);
+    for (unsigned count = 0; count < path.size(); count++) {
+        Node& walked = nodes[path[count]];
+        walked.visits++;
+
+        double best = walked.bestScore;
+        while (score > best && !walked.bestScore.compare_exchange_weak(best, score)) {
+        }
+
+        if (count > 0) {
+            walked.virtualLoss--;
+        }
+    }
+}
+
+//Return child of node passed with best upper confidence bound on its best score, which virtual losses scale down as if
+//rollouts walking through child had scored 0. Children no rollout has reached are taken first.
+int MctsAgent::selectChild(int inputNode) {
+    const Node& parent = nodes[inputNode];
+    const double logVisits = std::log(1.0 + parent.visits + parent.virtualLoss);
+
+    int best = parent.firstChild;
+    double bestBound = -1.0;
+    for (int child = parent.firstChild; child < parent.firstChild + parent.childCount; child++) {
+        const double walks = nodes[child].visits + nodes[child].virtualLoss;
+        if (walks == 0) {
+            return child;
+        }
+
+        const double bound = nodes[child].bestScore * nodes[child].visits / walks +
+                exploration * std::sqrt(logVisits / walks);
+        if (bound > bestBound) {
+            best = child;
+            bestBound = bound;
+        }
+    }
+
+    return best;
+}
+
+//Add children of node passed, one per action player can take in game passed, unless another thread is already
+//expanding it or tree is full. Returns whether node has children.
+bool MctsAgent::expandNode(int inputNode, Game& inputGame) {
+    Node& parent = nodes[inputNode];
+
+    //Only the thread that claims node expands it, others play on from it as a leaf
+    int leaf = NODE_LEAF;
+    if (!parent.state.compare_exchange_strong(leaf, NODE_EXPANDING)) {
+        return false;
+    }
+
+    AgentAction actions[maxActions];
+    int count = listActions(inputGame.getCurrentMap(), inputGame.getPlayer(), actions);
+    const int first = nodeCount.fetch_add(count);
+
+    //Tree is full, node is left without children
+    if (first + count > static_cast<int>(nodes.size())) {
+        count = 0;
+    }
+
+    for (int index = 0; index < count; index++) {
+        Node& child = nodes[first + index];
+        child.action = actions[index];
+        child.firstChild = 0;
+        child.childCount = 0;
+        child.visits = 0;
+        child.virtualLoss = 0;
+        child.bestScore = 0.0;
+        child.state = NODE_LEAF;
+    }
+
+    parent.firstChild = first;
+    parent.childCount = count;
+    parent.state.store(NODE_EXPANDED, std::memory_order_release);
+
+    return count > 0;
+}
+
+//Return score of game passed, from 0 for a lost game to 1 for a won one: stage of win path reached and how close
+//player is to target of that stage, over number of stages
+double MctsAgent::scoreGame(Game& inputGame, bool inputPlaying, GameOutcome inputOutcome) {
+    if (!inputPlaying) {
+        return (inputOutcome == OUTCOME_WON) ? 1.0 : 0.0;
+    }
+
+    const int stage = stageOf(inputGame);
+    const int steps = stepsTo(inputGame, stage, 0);
+    const double closeness = (steps < 0) ? 0.0 : closeSteps / (closeSteps + steps);
+
+    return (stage + closeness) / STAGE_COUNT;
+}
+
+//Return stage of win path game passed has reached, locked doors being those that were locked at root of search
+int MctsAgent::stageOf(Game& inputGame) {
+    Player* player = inputGame.getPlayer();
+    const std::vector <Map*>& maps = inputGame.getMaps();
+
+    if (player->findItem(KIND_MEDICINE)) {
+        return STAGE_EXIT;
+    }
+
+    for (unsigned door = 0; door < lockedDoors.size(); door++) {
+        Map* map = maps[lockedDoors[door].first];
+        const int cell = lockedDoors[door].second;
+        if (map->getTile(cell / map->getCols(), cell % map->getCols())->getDoorState() == DOOR_LOCKED) {
+            return player->findItem(KIND_KEY) ? STAGE_UNLOCK : STAGE_KEY;
+        }
+    }
+
+    return STAGE_MEDICINE;
+}
+
+//Return steps to a target of stage passed from cell next to player of game passed in direction passed (1 up, 2 down,
+//3 left, 4 right), or from cell of player for 0. Off the edge of map it is the door linked there, if any. Returns -1
+//if no target can be reached from cell.
+int MctsAgent::stepsTo(Game& inputGame, int inputStage, int inputDirection) {
+    static const int rowSteps[5] = {0, -1, 1, 0, 0};
+    static const int colSteps[5] = {0, 0, 0, -1, 1};
+
+    Map* map = inputGame.getCurrentMap();
+    Player* player = inputGame.getPlayer();
+    const int row = player->getRows() + rowSteps[inputDirection];
+    const int col = player->getCols() + colSteps[inputDirection];
+
+    if (row >= 0 && row < map->getRows() && col >= 0 && col < map->getCols()) {
+        return stageFields[inputStage][mapIndex(inputGame, map)][row * map->getCols() + col];
+    }
+
+    //Doors are objects of their own map and know their cell, unlike shared floor tiles
+    Space* link = map->getEdgeLink(player->getRows(), player->getCols());
+    if (link == nullptr) {
+        return -1;
+    }
+
+    const std::vector <Map*>& maps = inputGame.getMaps();
+    for (unsigned index = 0; index < maps.size(); index++) {
+        Map* linkedMap = maps[index];
+        if (link->getRows() < linkedMap->getRows() && link->getCols() < linkedMap->getCols() &&
+            linkedMap->getTile(link->getRows(), link->getCols()) == link) {
+            return stageFields[inputStage][index][link->getRows() * linkedMap->getCols() + link->getCols()];
+        }
+    }
+
+    return -1;
+}
+
+//Return action of a rollout from actions passed, player being in game passed: one time in rolloutRandomness an action
+//at random, otherwise an action towards a target of stage reached. That is interacting with the target when next to
+//it, else the move onto the cell fewest steps from a target or opening a door on the way there, ties broken at
+//random. Takes counter random choices are drawn from.
+const AgentAction& MctsAgent::rolloutAction(Game& inputGame, const AgentAction inputActions[], int inputCount,
+                                             uint64_t inputCounter) {
+    const int draw = random.randomInt(agentStream, inputCounter, 0, 0x7fffffff);
+    if (draw % rolloutRandomness == 0) {
+        return inputActions[(draw / rolloutRandomness) % inputCount];
+    }
+
+    const int stage = stageOf(inputGame);
+
+    int ties[maxActions];
+    int tieCount = 0;
+    int bestSteps = 0;
+    for (int index = 0; index < inputCount; index++) {
+        int steps = stepsTo(inputGame, stage, inputActions[index].direction);
+        if (steps < 0) {
+            continue;
+        }
+
+        //Target is reached by interacting with it, and can not be stepped onto
+        if (steps == 0) {
+            if (inputActions[index].selection != 'E') {
+                continue;
+            }
+            steps = -1;
+        }
+
+        if (tieCount == 0 || steps < bestSteps) {
+            bestSteps = steps;
+            tieCount = 0;
+        }
+        if (steps == bestSteps) {
+            ties[tieCount++] = index;
+        }
+    }
+
+    if (tieCount == 0) {
+        return inputActions[(draw / rolloutRandomness) % inputCount];
+    }
+
+    return inputActions[ties[(draw / rolloutRandomness) % tieCount]];
+}
+
+//Find steps to a target of each stage from every cell of every map of game, through a breadth first search out from
+//targets of stage. Player walks over floor and doors, and between maps through linked doors. Locked doors are only
+//walked through once unlocked, in the stages after STAGE_UNLOCK.
+void MctsAgent::buildStageFields() {
+    const std::vector <Map*>& maps = game->getMaps();
+
+    stageFields.assign(STAGE_COUNT, std::vector<std::vector<int> >(maps.size()));
+    lockedDoors.clear();
+
+    for (unsigned index = 0; index < maps.size(); index++) {
+        Map* map = maps[index];
+        for (int cell = 0; cell < map->getRows() * map->getCols(); cell++) {
+            Space* tile = map->getTile(cell / map->getCols(), cell % map->getCols());
+            if (tile->getKind() == KIND_DOOR && tile->getDoorState() == DOOR_LOCKED) {
+                lockedDoors.push_back(std::make_pair(index, cell));
+            }
+        }
+    }
+
+    std::deque <std::pair<unsigned, int> > queue;
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        std::vector <std::vector<int> >& field = stageFields[stage];
+
+        //Targets of stage start search at 0 steps
+        for (unsigned index = 0; index < maps.size(); index++) {
+            Map* map = maps[index];
+            field[index].assign(map->getRows() * map->getCols(), -1);
+
+            for (int cell = 0; cell < map->getRows() * map->getCols(); cell++) {
+                Space* tile = map->getTile(cell / map->getCols(), cell % map->getCols());
+                const SpaceKind kind = tile->getKind();
+                if ((stage == STAGE_KEY && kind == KIND_KEY) ||
+                    (stage == STAGE_UNLOCK && kind == KIND_DOOR && tile->getDoorState() == DOOR_LOCKED) ||
+                    (stage == STAGE_MEDICINE && kind == KIND_MEDICINE) ||
+                    (stage == STAGE_EXIT && kind == KIND_EXIT_POINT)) {
+                    field[index][cell] = 0;
+                    queue.push_back(std::make_pair(index, cell));
+                }
+            }
+        }
+
+        while (!queue.empty()) {
+            const unsigned index = queue.front().first;
+            const int cell = queue.front().second;
+            queue.pop_front();
+
+            Map* map = maps[index];
+            const int row = cell / map->getCols();
+            const int col = cell % map->getCols();
+
+            //Cells next to this one in its map, and door linked to it off the edge of map
+            std::pair<unsigned, int> next[5];
+            int nextCount = 0;
+            const int rowSteps[4] = {-1, 1, 0, 0};
+            const int colSteps[4] = {0, 0, -1, 1};
+            for (int direction = 0; direction < 4; direction++) {
+                const int nextRow = row + rowSteps[direction];
+                const int nextCol = col + colSteps[direction];
+                if (nextRow >= 0 && nextRow < map->getRows() && nextCol >= 0 && nextCol < map->getCols()) {
+                    next[nextCount++] = std::make_pair(index, nextRow * map->getCols() + nextCol);
+                }
+            }
+            if (row == 0 || row == map->getRows() - 1 || col == 0 || col == map->getCols() - 1) {
+                Space* link = map->getEdgeLink(row, col);
+                if (link != nullptr) {
+                    for (unsigned linked = 0; linked < maps.size(); linked++) {
+                        Map* linkedMap = maps[linked];
+                        if (link->getRows() < linkedMap->getRows() && link->getCols() < linkedMap->getCols() &&
+                            linkedMap->getTile(link->getRows(), link->getCols()) == link) {
+                            next[nextCount++] = std::make_pair(linked, link->getRows() * linkedMap->getCols() +
+                                                                       link->getCols());
+                        }
+                    }
+                }
+            }
+
+            for (int count = 0; count < nextCount; count++) {
+                Map* nextMap = maps[next[count].first];
+                const int nextCell = next[count].second;
+                if (field[next[count].first][nextCell] >= 0) {
+                    continue;
+                }
+
+                Space* tile = nextMap->getTile(nextCell / nextMap->getCols(), nextCell % nextMap->getCols());
+                const bool walkable = tile->getKind() == KIND_FLOOR || (tile->getKind() == KIND_DOOR &&
+                        (tile->getDoorState() != DOOR_LOCKED || stage > STAGE_UNLOCK));
+                if (walkable) {
+                    field[next[count].first][nextCell] = field[index][cell] + 1;
+                    queue.push_back(next[count]);
+                }
+            }
+        }
+    }
+}
+
+//Return index of map passed among maps of game passed
+unsigned MctsAgent::mapIndex(Game& inputGame, Map* inputMap) {
+    const std::vector <Map*>& maps = inputGame.getMaps();
+
+    unsigned index = 0;
+    while (index + 1 < maps.size() && maps[index] != inputMap) {
+        index++;
+    }
+
+    return index;
+}
@@ -0,0 +1,216 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: MctsAgent class is an Agent that plays the game it is given by Monte Carlo tree search. Each turn it
+ * plays a budget of rollouts on copies of the game (see Game::copyFrom): a rollout walks down a search tree of actions
+ * from the state of the game, picking the child with the best upper confidence bound at each node, adds the children
+ * of the node it stops at, then plays on for up to rolloutDepth actions and scores the state it reaches. Rollouts
+ * play towards the target of the stage reached, with one action in rolloutRandomness at random. Score is 1 for a won
+ * game and 0 for a lost one. Otherwise the game is split into the stages of its win path (find the key, unlock the
+ * locked door, take the medicine, reach the exit point with it), and score is the stage reached plus how close player
+ * is to the target of that stage, measured by a breadth first search over all maps of the world from the targets of
+ * each stage, done once per turn. A game plays out the same for the same actions, so a node is worth the best score a
+ * rollout through it reached rather than the mean, which zombies wandering into the far ends of rollouts would drag
+ * down. Actions are moves (W/S/A/D) player can take and interactions (E) with the Spaces around player, a key held
+ * always being used on a locked door, so that every action takes a turn or moves player into another map. Action
+ * played is the child of the root that most rollouts went through.
+ * Rollouts are spread over a ThreadPool, each thread playing on a Game of its own: every thread takes rollouts from a
+ * shared atomic count until the budget is used up, so a thread that finishes early keeps taking rollouts in place of
+ * sitting idle. Threads share one tree, whose counts are atomic. A node is expanded by the first thread to claim it,
+ * and a thread walking down the tree adds a virtual loss to each node it passes until its rollout is scored, so that
+ * threads walking down at the same time spread over different branches. Rollouts draw from a Random service seeded
+ * from seed of game, so with one thread a game is played the same every time it is played with that seed.
+ * Variables: game - Game agent plays, read as the root of each search. threadGames - Game each thread plays rollouts
+ * on. pool - ThreadPool rollouts are spread over. budget - Number of rollouts each turn. nodes - Nodes of search
+ * tree. nodeCount - Number of nodes in use. nextRollout - Number of rollouts started this turn. random - Random service
+ * seeded from seed of current game. turn - Number of turns searched this game. paths - Nodes walked by current rollout
+ * of each thread. stageFields - Steps to a target of each stage from every cell of every map. lockedDoors - Cells of
+ * locked doors. rollouts - Number of rollouts played over every game. searchSeconds - Seconds spent searching over
+ * every game.
+ * Functions: Constructor takes game to play, rollout budget per turn and number of threads.
+ * Destructor deletes game copies of threads.
+ * startGame - Get ready to play a new game of seed passed.
+ * chooseAction - Search rollout budget and return action most rollouts went through.
+ * getRollouts - Return number of rollouts played over every game.
+ * getSearchSeconds - Return seconds spent searching over every game.
+ * listActions - List actions player can take on map.
+ * playRollout - Play one rollout on game of thread passed.
+ * selectChild - Return child of node with best upper confidence bound.
+ * expandNode - Add children of node, one per action player can take.
+ * scoreGame - Return score of game passed.
+ * stageOf - Return stage of win path game passed has reached.
+ * stepsTo - Return steps to a target of a stage from cell next to player.
+ * rolloutAction - Return action of a rollout, most often towards target of stage reached.
+ * buildStageFields - Find steps to a target of each stage from every cell of every map of game.
+ * mapIndex - Return index of map passed among maps of game.
+*/
+
+#ifndef MCTSAGENT_HPP
+#define MCTSAGENT_HPP
+
+#include <atomic>
+#include <vector>
+#include "Agent.hpp"
+#include "Game.hpp"
+#include "Random.hpp"
+#include "ThreadPool.hpp"
+
+class MctsAgent : public Agent {
+private:
+    //Node of search tree: action played from parent, children (firstChild through firstChild + childCount - 1), number
+    //of rollouts through node and best score of them, virtual losses of rollouts walking through it and not yet
+    //scored, and whether node is unexpanded, being expanded or expanded
+    struct Node {
+        AgentAction action;
+        int firstChild;
+        int childCount;
+        std::atomic<int> visits;
+        std::atomic<int> virtualLoss;
+        std::atomic<double> bestScore;
+        std::atomic<int> state;
+    };
+
+    //Expansion state of a node
+    enum NodeState {
+        NODE_LEAF = 0,
+        NODE_EXPANDING,
+        NODE_EXPANDED
+    };
+
+    //Stages of win path, in order: find key, unlock locked door, take medicine, reach exit point with it
+    enum Stage {
+        STAGE_KEY = 0,
+        STAGE_UNLOCK,
+        STAGE_MEDICINE,
+        STAGE_EXIT,
+        STAGE_COUNT
+    };
+
+    //Game agent plays, read as the root of each search, and game each thread plays rollouts on
+    Game* game;
+    std::vector <Game*> threadGames;
+
+    //Thread pool rollouts are spread over
+    ThreadPool pool;
+
+    //Number of rollouts each turn
+    unsigned budget;
+
+    //Nodes of search tree, node 0 the root, enough for every rollout to add the most children a node has
+    std::vector <Node> nodes;
+    std::atomic<int> nodeCount;
+
+    //Number of rollouts started this turn
+    std::atomic<unsigned> nextRollout;
+
+    //Random service seeded from seed of current game, and number of turns searched this game
+    Random random;
+    uint64_t turn;
+
+    //Nodes walked by current rollout of each thread
+    std::vector <std::vector<int> > paths;
+
+    //Steps to a target of each stage from every cell of every map (stage, then map, then row * cols + col), -1 where
+    //no target can be reached, and cells of locked doors (map, then row * cols + col)
+    std::vector <std::vector<std::vector<int> > > stageFields;
+    std::vector <std::pair<unsigned, int> > lockedDoors;
+
+    //Number of rollouts played and seconds spent searching, over every game
+    unsigned long long rollouts;
+    double searchSeconds;
+
+    //Most actions player can take: a move and an interaction in each direction
+    static const int maxActions = 8;
+
+    //Most nodes of search tree, however large rollout budget is
+    static const int maxNodes = 1 << 21;
+
+    //Most actions played at random after walking down tree, before state reached is scored
+    static const int rolloutDepth = 4;
+
+    //One in this many actions of a rollout is played at random rather than towards target of stage
+    static const int rolloutRandomness = 4;
+
+    //Weight of exploration in upper confidence bound of a child
+    static const double exploration;
+
+    //Score of a state reached is multiplied by this for each action taken to reach it, so that it is reached soon
+    static const double discount;
+
+    //Steps from target of a stage at which player is scored halfway between that stage and the next
+    static const double closeSteps;
+
+    //Agent owns the game copies of its threads and cannot be copied
+    MctsAgent(const MctsAgent&);
+    MctsAgent& operator=(const MctsAgent&);
+
+    //List actions player can take on map passed into array passed: a move in each direction player can move in (onto
+    //a cell that is not solid, or off an open door into the map behind it) and an interaction with each Space next to
+    //player that can be interacted with and is not an open door. Returns number of actions listed, with a move into a
+    //wall listed should player be boxed in, as playAgent passes turn once an agent keeps bumping into walls.
+    static int listActions(Map* inputMap, Player* inputPlayer, AgentAction outputActions[]);
+
+    //Play one rollout on game of thread passed: copy game, walk down tree, expand node reached, play on through
+    //rolloutAction and add score of state reached to every node walked. Takes thread and number of rollout this turn,
+    //which random choices are drawn from.
+    void playRollout(unsigned inputThread, unsigned inputRollout);
+
+    //Return child of node passed with best upper confidence bound on its best score, which virtual losses scale down
+    //as if rollouts walking through child had scored 0. Children no rollout has reached are taken first.
+    int selectChild(int inputNode);
+
+    //Add children of node passed, one per action player can take in game passed, unless another thread is already
+    //expanding it or tree is full. Returns whether node has children.
+    bool expandNode(int inputNode, Game& inputGame);
+
+    //Return score of game passed, from 0 for a lost game to 1 for a won one: stage of win path reached and how close
+    //player is to target of that stage, over number of stages
+    double scoreGame(Game& inputGame, bool inputPlaying, GameOutcome inputOutcome);
+
+    //Find steps to a target of each stage from every cell of every map of game, through a breadth first search out
+    //from targets of stage. Player walks over floor and doors, and between maps through linked doors. Locked doors are
+    //only walked through once unlocked, in the stages after STAGE_UNLOCK.
+    void buildStageFields();
+
+    //Return stage of win path game passed has reached, locked doors being those that were locked at root of search
+    int stageOf(Game& inputGame);
+
+    //Return steps to a target of stage passed from cell next to player of game passed in direction passed (1 up, 2
+    //down, 3 left, 4 right), or from cell of player for 0. Off the edge of map it is the door linked there, if any.
+    //Returns -1 if no target can be reached from cell.
+    int stepsTo(Game& inputGame, int inputStage, int inputDirection);
+
+    //Return action of a rollout from actions passed, player being in game passed: one time in rolloutRandomness an
+    //action at random, otherwise an action towards a target of stage reached. That is interacting with the target
+    //when next to it, else the move onto the cell fewest steps from a target or opening a door on the way there, ties
+    //broken at random. Takes counter random choices are drawn from.
+    const AgentAction& rolloutAction(Game& inputGame, const AgentAction inputActions[], int inputCount,
+                                     uint64_t inputCounter);
+
+    //Return index of map passed among maps of game passed
+    static unsigned mapIndex(Game& inputGame, Map* inputMap);
+
+public:
+    //Constructor takes game to play, number of rollouts each turn and number of threads rollouts are spread over
+    //(calling thread and workers of a pool of its own). Game is copied for each thread, and must be the game the
+    //agent is played by.
+    MctsAgent(Game& inputGame, unsigned inputBudget, unsigned inputThreads);
+
+    //Destructor deletes game copies of threads
+    ~MctsAgent();
+
+    //Get ready to play a new game of seed passed, called before each game
+    void startGame(uint64_t inputSeed);
+
+    //Search rollout budget from state of game and return action most rollouts went through. Map and player passed
+    //are those of game.
+    AgentAction chooseAction(Map* inputMap, Player* inputPlayer);
+
+    //Return number of rollouts played over every game
+    unsigned long long getRollouts();
+
+    //Return seconds spent searching over every game
+    double getSearchSeconds();
+};
+
+#endif //MCTSAGENT_HPP
@@ -6,7 +6,7 @@
  * defense.
  * Variables: medicineVisual - static const char for visualization of medicine on map.
  * Functions: Constructor for Medicine - Takes row/col integer values as parameters and passes values to GamePiece
- * class for position of item. String value "medicine" and char visualization from static const are also passed to
+ * class for position of item. KIND_MEDICINE and char visualization from static const are also passed to
  * Space constructor and isItem is set to true.
  * Default destructor for Medicine
  * interactObject - Message is output to user informing them of what is encountered and that the player is going
@@ -16,9 +16,9 @@
 #include "Medicine.hpp"
 
 //Constructor for Medicine - Takes row/col integer values as parameters and passes values to GamePiece class for
-//position of item. String value "medicine" and char visualization from static const are also passed to Space constructor
+//position of item. KIND_MEDICINE and char visualization from static const are also passed to Space constructor
 //and isItem is set to true.
-Medicine::Medicine(int inputRow, int inputCol) : GamePiece("medicine", medicineVisual, inputRow, inputCol) {
+Medicine::Medicine(int inputRow, int inputCol) : GamePiece(KIND_MEDICINE, medicineVisual, inputRow, inputCol) {
     isItem = true;
 }
 
@@ -0,0 +1,141 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: NoiseField class spreads noises made on a map (a door opening, an item picked up, a zombie killed) over
+ * its floor cells, so that zombies within earshot can be sent toward the noise. A noise carries a number of steps,
+ * its loudness, and reaches every floor cell within that many steps of where it was made, going around walls and
+ * shelves rather than through them. Noises are collected as they are made during a turn and spread together in one
+ * pass: a breadth first search from all of them at once, taking cells loudest first, so that each cell is reached
+ * once, by the loudest noise heard there, and the cost of a pass is the area reached however many noises overlap.
+ * Scratch arrays are the size of map and stamped with the pass they were written in instead of being cleared, and
+ * are only allocated once map is first spread over, so a pass allocates nothing.
+ * Variables: sources/loudnesses - Cells noises were made in since last pass and loudness of each. strengths - Steps
+ * of noise left at each cell reached, valid only where stamps holds current pass. origins - Cell noise heard at each
+ * cell reached was made in. stamps - Pass each cell was last reached in. pass - Number of current pass. buckets -
+ * Cells waiting to be searched, one list per strength left. reached - Cells reached by last pass, in order reached.
+ * rows/cols - Size of map of scratch arrays.
+ * Functions: Constructor sets up empty field with no noises.
+ * makeNoise - Add noise of loudness passed at cell passed, to be spread by next pass.
+ * hasNoise - Return whether noises were made since last pass.
+ * clearNoise - Drop noises made since last pass without spreading them.
+ * spread - Spread all noises made since last pass over floor cells of terrain layer in one pass.
+ * getReached - Return cells reached by last pass.
+ * originOf - Return cell noise heard at cell reached by last pass was made in.
+*/
+
+#include "NoiseField.hpp"
+#include "Space.hpp"
+
+//Constructor sets up empty field with no noises
+NoiseField::NoiseField() {
+    pass = 0;
+    rows = 0;
+    cols = 0;
+}
+
+//Add noise of loudness passed (steps over floor) at cell at tileIndex passed, to be spread by next pass. Noises of no
+//loudness are not heard and are dropped.
+void NoiseField::makeNoise(int inputIndex, int inputLoudness) {
+    if (inputLoudness <= 0) {
+        return;
+    }
+
+    sources.push_back(inputIndex);
+    loudnesses.push_back(inputLoudness);
+
+    if (inputLoudness > maxLoudness) {
+        loudnesses.back() = maxLoudness;
+    }
+}
+
+//Return whether noises were made since last pass
+bool NoiseField::hasNoise() const {
+    return !sources.empty();
+}
+
+//Drop noises made since last pass without spreading them, such as when map is set up again
+void NoiseField::clearNoise() {
+    sources.clear();
+    loudnesses.clear();
+}
+
+//Spread all noises made since last pass over floor cells of terrain layer (TerrainKind byte per cell in row-major
+//order of map size passed) in one pass, loudest first. Cell a noise is made in may be any terrain. Noises are dropped
+//once spread.
+void NoiseField::spread(const unsigned char* inputTerrain, int inputRows, int inputCols) {
+    //Stamps only need clearing when map size changed or pass number wraps around
+    if (inputRows != rows || inputCols != cols || pass == ~0u) {
+        rows = inputRows;
+        cols = inputCols;
+        strengths.assign(rows * cols, 0);
+        origins.assign(rows * cols, 0);
+        stamps.assign(rows * cols, 0);
+        pass = 0;
+    }
+    pass++;
+
+    if (buckets.empty()) {
+        buckets.resize(maxLoudness + 1);
+    }
+    reached.clear();
+
+    //Seed every noise in list of its loudness. Of several noises made in one cell, only the loudest is kept.
+    int loudest = 0;
+    for (unsigned count = 0; count < sources.size(); count++) {
+        const int source = sources[count];
+        const int loudness = loudnesses[count];
+        if (stamps[source] == pass && strengths[source] >= loudness) {
+            continue;
+        }
+
+        stamps[source] = pass;
+        strengths[source] = static_cast<unsigned char>(loudness);
+        origins[source] = source;
+        buckets[loudness].push_back(source);
+        loudest = (loudness > loudest) ? loudness : loudest;
+    }
+    clearNoise();
+
+    //Search outward from all noises at once, loudest cells first. A cell reached again by a louder noise before it is
+    //searched leaves a stale entry in a quieter list, which is skipped.
+    for (int strength = loudest; strength >= 0; strength--) {
+        std::vector <int>& bucket = buckets[strength];
+
+        for (unsigned head = 0; head < bucket.size(); head++) {
+            const int index = bucket[head];
+            if (strengths[index] != strength) {
+                continue;
+            }
+            reached.push_back(index);
+
+            if (strength == 0) {
+                continue;
+            }
+
+            const int row = index / cols;
+            const int col = index - row * cols;
+            const int neighbors[4] = {(row > 0) ? index - cols : -1, (col < cols-1) ? index + 1 : -1,
+                                      (row < rows-1) ? index + cols : -1, (col > 0) ? index - 1 : -1};
+
+            for (int count = 0; count < 4; count++) {
+                const int neighbor = neighbors[count];
+                if (neighbor < 0 || inputTerrain[neighbor] != TERRAIN_FLOOR ||
+                    (stamps[neighbor] == pass && strengths[neighbor] >= strength - 1)) {
+                    continue;
+                }
+
+                stamps[neighbor] = pass;
+                strengths[neighbor] = static_cast<unsigned char>(strength - 1);
+                origins[neighbor] = origins[index];
+                buckets[strength - 1].push_back(neighbor);
+            }
+        }
+
+        bucket.clear();
+    }
+}
+
+//Return cells reached by last pass, in order reached. Valid until next pass.
+const std::vector <int>& NoiseField::getReached() const {
+    return reached;
+}
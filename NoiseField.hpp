@@ -0,0 +1,92 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: NoiseField class spreads noises made on a map (a door opening, an item picked up, a zombie killed) over
+ * its floor cells, so that zombies within earshot can be sent toward the noise. A noise carries a number of steps,
+ * its loudness, and reaches every floor cell within that many steps of where it was made, going around walls and
+ * shelves rather than through them. Noises are collected as they are made during a turn and spread together in one
+ * pass: a breadth first search from all of them at once, taking cells loudest first, so that each cell is reached
+ * once, by the loudest noise heard there, and the cost of a pass is the area reached however many noises overlap.
+ * Scratch arrays are the size of map and stamped with the pass they were written in instead of being cleared, and
+ * are only allocated once map is first spread over, so a pass allocates nothing.
+ * Variables: sources/loudnesses - Cells noises were made in since last pass and loudness of each. strengths - Steps
+ * of noise left at each cell reached, valid only where stamps holds current pass. origins - Cell noise heard at each
+ * cell reached was made in. stamps - Pass each cell was last reached in. pass - Number of current pass. buckets -
+ * Cells waiting to be searched, one list per strength left. reached - Cells reached by last pass, in order reached.
+ * rows/cols - Size of map of scratch arrays.
+ * Functions: Constructor sets up empty field with no noises.
+ * makeNoise - Add noise of loudness passed at cell passed, to be spread by next pass.
+ * hasNoise - Return whether noises were made since last pass.
+ * clearNoise - Drop noises made since last pass without spreading them.
+ * spread - Spread all noises made since last pass over floor cells of terrain layer in one pass.
+ * getReached - Return cells reached by last pass.
+ * originOf - Return cell noise heard at cell reached by last pass was made in.
+*/
+
+#ifndef NOISEFIELD_HPP
+#define NOISEFIELD_HPP
+
+#include <cstdint>
+#include <vector>
+
+//Loudness of each noise made in game, in steps over floor from where it was made
+enum NoiseLoudness {
+    NOISE_PICK_UP = 4,
+    NOISE_KILL = 6,
+    NOISE_DOOR = 10
+};
+
+class NoiseField {
+private:
+    //Loudest noise spread, louder noises are heard as this loud
+    static const int maxLoudness = 255;
+
+    //Cells noises were made in since last pass and loudness of each
+    std::vector <int> sources;
+    std::vector <int> loudnesses;
+
+    //Steps of noise left and cell noise was made in for each cell, valid only where stamps holds current pass
+    std::vector <unsigned char> strengths;
+    std::vector <int> origins;
+    std::vector <uint32_t> stamps;
+    uint32_t pass;
+
+    //Cells waiting to be searched during a pass, one list per strength left, kept between passes
+    std::vector <std::vector<int> > buckets;
+
+    //Cells reached by last pass, in order reached
+    std::vector <int> reached;
+
+    //Size of map of scratch arrays
+    int rows,
+        cols;
+
+public:
+    //Constructor sets up empty field with no noises
+    NoiseField();
+
+    //Add noise of loudness passed (steps over floor) at cell at tileIndex passed, to be spread by next pass. Noises of
+    //no loudness are not heard and are dropped.
+    void makeNoise(int inputIndex, int inputLoudness);
+
+    //Return whether noises were made since last pass
+    bool hasNoise() const;
+
+    //Drop noises made since last pass without spreading them, such as when map is set up again
+    void clearNoise();
+
+    //Spread all noises made since last pass over floor cells of terrain layer (TerrainKind byte per cell in row-major
+    //order of map size passed) in one pass, loudest first. Cell a noise is made in may be any terrain. Noises are
+    //dropped once spread.
+    void spread(const unsigned char* inputTerrain, int inputRows, int inputCols);
+
+    //Return cells reached by last pass, in order reached. Valid until next pass.
+    const std::vector <int>& getReached() const;
+
+    //Return tileIndex of cell noise heard at cell passed was made in. Cell must have been reached by last pass.
+    int originOf(int inputIndex) const {
+        return origins[inputIndex];
+    }
+};
+
+#endif //NOISEFIELD_HPP
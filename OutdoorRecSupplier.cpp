@@ -5,46 +5,36 @@
  * which is used as an optional objective for the user. The player may pick up 1 or 2 knives in this shop which can
  * each be used to kill a zombie if encountered. Each knife is only worth one kill in a defensive capacity.
  * Variables: Integer variables for rows/cols of map size and startingRow/startingColumn of player when placed on map.
- * Functions: Constructor takes string for name of map and passes the four integer values to the Map class constructor
- * for map size and starting player location.
- * OutdoorRecSupplier destructor destroys all zombies associated with zombies vector to free memory.
+ * Functions: Constructor takes string for name of map and Random service of game, and passes the four integer values to
+ * the Map class constructor for map size and starting player location along with Random service.
  * mapSetup - Sets up the OutdoorRecSupplier map by adding zombies and objects/items needed in the map.
 */
 
 #include "OutdoorRecSupplier.hpp"
 
-//Primary constructor for rec supplier map area - takes string for name of map and passes the four integer
-//values to the Map class constructor for map size and starting player location.
-OutdoorRecSupplier::OutdoorRecSupplier(std::string inputName) : Map(inputName, rows, cols, startingRow, startingCol) {
+//Primary constructor for rec supplier map area - takes string for name of map and Random service of game and passes the
+//four integer values to the Map class constructor for map size and starting player location.
+OutdoorRecSupplier::OutdoorRecSupplier(std::string inputName, Random* inputRandom) :
+        Map(inputName, rows, cols, startingRow, startingCol, inputRandom) {
     mapSetup();
 }
 
-//Destructor for rec supplier map frees all memory allocated to zombies in map.
-OutdoorRecSupplier::~OutdoorRecSupplier() {
-    for (unsigned count = 0; count < zombies.size(); count++) {
-        delete zombies[count]->getCurrentSpace();
-    }
-}
-
 //Set up grocery store map - Add in all doors/items as necessary such as zombies and knives
 void OutdoorRecSupplier::mapSetup() {
     //Add wall-like features such as shelves and counters
     //Add display case along walls with item(s) and place door in front
-    addSpaceObject(new Wall(), 2, 1);
-    addSpaceObject(new Wall(), 2, 2);
-    addSpaceObject(new Wall(), 4, 1);
-    addSpaceObject(new Wall(), 4, 2);
-    addSpaceObject(new Door("outdoor rec supplier", 1, 2), 1, 2);
-    addSpaceObject(new Door("outdoor rec supplier", 3, 2), 3, 2);
-    addSpaceObject(new Door("outdoor rec supplier", 5, 2), 5, 2);
+    setTerrain(2, 1, TERRAIN_WALL);
+    setTerrain(2, 2, TERRAIN_WALL);
+    setTerrain(4, 1, TERRAIN_WALL);
+    setTerrain(4, 2, TERRAIN_WALL);
+    addSpaceObject(create<Door>(MAP_REC_SUPPLIER, 1, 2), 1, 2);
+    addSpaceObject(create<Door>(MAP_REC_SUPPLIER, 3, 2), 3, 2);
+    addSpaceObject(create<Door>(MAP_REC_SUPPLIER, 5, 2), 5, 2);
 
     //Add item(s) to map (weapons in outdoor rec supplier)
-    addSpaceObject(new Knife(1, 1), 1, 1);
-    addSpaceObject(new Knife(5, 1), 5, 1);
-
-    //Add zombies to vector container
-    zombies.push_back(new Zombie("zombie", 5, 5));
+    addSpaceObject(create<Knife>(1, 1), 1, 1);
+    addSpaceObject(create<Knife>(5, 1), 5, 1);
 
     //Add zombies to map
-    setZombieLocation(zombies[0]);
+    addZombie(5, 5);
 }
\ No newline at end of file
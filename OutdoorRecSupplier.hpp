@@ -5,9 +5,8 @@
  * which is used as an optional objective for the user. The player may pick up 1 or 2 knives in this shop which can
  * each be used to kill a zombie if encountered. Each knife is only worth one kill in a defensive capacity.
  * Variables: Integer variables for rows/cols of map size and startingRow/startingColumn of player when placed on map.
- * Functions: Constructor takes string for name of map and passes the four integer values to the Map class constructor
- * for map size and starting player location.
- * OutdoorRecSupplier destructor destroys all zombies associated with zombies vector to free memory.
+ * Functions: Constructor takes string for name of map and Random service of game, and passes the four integer values to
+ * the Map class constructor for map size and starting player location along with Random service.
  * mapSetup - Sets up the OutdoorRecSupplier map by adding zombies and objects/items needed in the map.
 */
 
@@ -25,12 +24,9 @@ private:
             startingRow = 4,
             startingCol = 11;
 public:
-    //Primary constructor for rec supplier map area - takes string for name of map and passes the four integer
-    //values to the Map class constructor for map size and starting player location.
-    OutdoorRecSupplier(std::string);
-
-    //Destructor for rec supplier map frees all memory allocated to zombies in map.
-    ~OutdoorRecSupplier();
+    //Primary constructor for rec supplier map area - takes string for name of map and Random service of game and passes
+    //the four integer values to the Map class constructor for map size and starting player location.
+    OutdoorRecSupplier(std::string, Random*);
 
     //Set up grocery store map - Add in all doors/items as necessary such as zombies and knives.
     void mapSetup();
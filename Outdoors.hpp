@@ -4,10 +4,16 @@
  * Description: Outdoors class is a child class of Map. This class represents the starting point of the map, indicating
  * that the user just got into town in search of medication. Class contains key item and doors to all other maps in game.
  * The key is used to open the pharmacy door in the grocery store map.
- * Variables: Integer variables for rows/cols of map size and startingRow/startingColumn of player when placed on map.
- * Functions: Constructor takes string for name of map and passes the four integer values to the Map class constructor
- * for map size and starting player location.
- * Outdoors destructor destroys all zombies associated with zombies vector to free memory.
+ * For scenario worlds the map may be made larger than standard size and given more zombies at runtime. The standard
+ * layout stays in its corner, the door to the field stays on the bottom wall and the player starts above it, and the
+ * extra zombies are scattered over the rest of the map.
+ * Variables: Integer variables for rows/cols of standard map size and startingRow/startingColumn of player when placed
+ * on standard map. extraZombies - Number of zombies added at random on top of the standard ones. maxSize - Largest
+ * number of rows or cols of a scenario map.
+ * Functions: Constructor takes string for name of map and Random service of game, and passes the four integer values to
+ * the Map class constructor for map size and starting player location along with Random service. Scenario constructor
+ * also takes map size and number of extra zombies.
+ * scenarioSize - Return rows or cols of scenario map for size asked for, raised to standard size and cut to maxSize.
  * mapSetup - Sets up the Outdoors map by adding zombies and objects/items needed in the map such as key.
 */
 
@@ -27,18 +33,30 @@ private:
                      startingRow = 18,
                      startingCol = 9;
 
+    //Number of zombies added at random on top of the standard ones
+    int extraZombies;
 
+    //Return rows or cols of scenario map for size passed, raised to standard size passed if smaller and cut to maxSize
+    //if larger
+    static int scenarioSize(int inputSize, int standardSize);
 
 public:
-    //Primary constructor for outdoor map area - takes string for name of map and passes the four integer values to the
-    //Map class constructor for map size and starting player location.
-    Outdoors(std::string);
+    //Largest number of rows or cols of a scenario map, so that cells of map (and of the flow field, paths, views and
+    //noises worked out over it) are counted well within int
+    static const int maxSize = 16384;
 
-    //Destructor to delete allocated memory involved with zombie placements on map
-    ~Outdoors();
+    //Primary constructor for outdoor map area - takes string for name of map and Random service of game and passes the
+    //four integer values to the Map class constructor for map size and starting player location.
+    Outdoors(std::string, Random*);
+
+    //Scenario constructor for outdoor map area - takes string for name of map, Random service of game, rows/cols of map
+    //(raised to standard size if smaller, cut to maxSize if larger) and number of zombies to add at random on top of
+    //the standard ones. Player starts above the door to the field, in the middle of the bottom wall of the standard
+    //layout.
+    Outdoors(std::string, Random*, int, int, int);
 
     //Set up outdoors map - Add in all items and additional environmental map details as necessary such as zombies
-    //and the key.
+    //and the key, then any extra zombies of scenario.
     void mapSetup();
 
 };
@@ -0,0 +1,477 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Pathfinder class finds shortest paths over the terrain layer of a map, for zombies that head for a
+ * given cell (such as a noise or the last place the player was seen) rather than wandering. A path may only pass
+ * through floor cells, the same cells zombies may step into, except that it may end on any cell. Zombies are not
+ * obstacles to a path, as they move every turn: a zombie blocked by another zombie waits as it always has.
+ * Paths are found by A* or by jump point search, which gives paths of the same length while only putting the turning
+ * points of straight runs on the open list. Jump point search here follows the four direction version of the method:
+ * paths turn from a vertical run onto a horizontal run freely, but only turn off a horizontal run where a wall next to
+ * it forces them to, so of all shortest paths only one is ever searched.
+ * Found paths are cached by region of the start cell (square blocks of the map) and goal cell, so zombies following a
+ * path, or starting near a cell a path runs through, take their next step from the cache instead of searching again.
+ * When a path is stored, every region it crosses gets an entry for the rest of the path, so a zombie following it
+ * never searches again. A zombie in a cached region that is not on a cached path finds its way onto one by a
+ * breadth first search kept inside that region. Cache is cleared whenever a cell changes between floor and blocked.
+ * Scratch arrays are the size of map and stamped with the search they were written by instead of being cleared, and
+ * are only allocated once map is first searched.
+ * Variables: paths - Cached paths, cells from start to goal. cache - Cached path runs keyed by start region and goal.
+ * rows/cols - Size of map of scratch arrays. search - Number of current search, stamped into scratch arrays.
+ * seen/closed - Search each cell was last reached/finished in. costs - Steps from start of each cell reached. parents -
+ * Cell each cell was reached from. firstSteps - Direction of first step from start of each cell reached by a region
+ * search. marks - Search each cell was marked as part of a cached path in. open - Open list of A* and jump point
+ * search, a binary heap. frontier - Cells waiting to be searched by a region search. route - Path found by last
+ * search of nextDirection. jumpSearch - Whether paths are found by jump point search (default) or plain A*. searchGoal/
+ * searchTerrain - Goal and terrain layer of current search. searches/cacheHits - Number of full searches made and of
+ * next steps taken from cache.
+ * Functions: Constructor sets up empty cache.
+ * setJumpSearch - Set whether paths are found by jump point search or plain A*.
+ * findPath - Find shortest path from start cell to goal cell, without using or filling cache.
+ * nextDirection - Return direction of next step from start cell toward goal cell, from cache when it can.
+ * clearCache - Drop all cached paths.
+ * getSearches/getCacheHits - Return number of full searches made and of next steps taken from cache.
+ * regionOf - Return region a cell is in.
+ * directionBetween - Return direction of step between two cells next to each other.
+ * prepare - Size scratch arrays to map and start a new search number.
+ * passable - Return whether a path may enter row/col in current search.
+ * searchAStar/searchJump - Run A* or jump point search from start to goal, filling parents.
+ * pushOpen - Add cell to open list of a search.
+ * jumpHorizontal/jumpVertical - Step from row/col in one direction until a jump point is found, returning it or -1.
+ * tracePath - Write path found by last search from start to goal.
+ * storePath - Add path to cache, with an entry for every region it crosses.
+ * stitchRegion - Breadth first search inside region of start cell for a cell marked as part of a cached path.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include "Pathfinder.hpp"
+
+//Constructor sets up empty cache
+Pathfinder::Pathfinder() {
+    rows = 0;
+    cols = 0;
+    search = 0;
+    jumpSearch = true;
+    searchGoal = -1;
+    searchTerrain = nullptr;
+    searches = 0;
+    cacheHits = 0;
+}
+
+//Set whether paths are found by jump point search (default) or plain A*
+void Pathfinder::setJumpSearch(bool inputJump) {
+    jumpSearch = inputJump;
+}
+
+//Return region a cell is in
+int Pathfinder::regionOf(int inputCell) const {
+    const int regionCols = (cols + regionSize - 1) / regionSize;
+
+    return (inputCell / cols / regionSize) * regionCols + (inputCell % cols) / regionSize;
+}
+
+//Return direction (1 up, 2 right, 3 down, 4 left) of step between two cells next to each other
+int Pathfinder::directionBetween(int inputFrom, int inputTo) const {
+    if (inputTo == inputFrom - cols) {
+        return 1;
+    }
+    else if (inputTo == inputFrom + 1) {
+        return 2;
+    }
+    else if (inputTo == inputFrom + cols) {
+        return 3;
+    }
+
+    return 4;
+}
+
+//Size scratch arrays to map and start a new search number. Arrays are only cleared when map size changed or search
+//number wraps around.
+void Pathfinder::prepare(const unsigned char* inputTerrain, int inputRows, int inputCols) {
+    if (inputRows != rows || inputCols != cols || search == ~0u) {
+        //Cached cells are numbered by old map size
+        if (inputRows != rows || inputCols != cols) {
+            clearCache();
+        }
+
+        rows = inputRows;
+        cols = inputCols;
+        seen.assign(rows * cols, 0);
+        closed.assign(rows * cols, 0);
+        costs.assign(rows * cols, 0);
+        parents.assign(rows * cols, -1);
+        firstSteps.assign(rows * cols, 0);
+        marks.assign(rows * cols, 0);
+        search = 0;
+    }
+
+    search++;
+    searchTerrain = inputTerrain;
+}
+
+//Add cell to open list of a search with cost from start and parent passed, unless it was reached more cheaply
+void Pathfinder::pushOpen(int inputCell, int inputCost, int inputParent) {
+    if (seen[inputCell] == search && costs[inputCell] <= inputCost) {
+        return;
+    }
+
+    seen[inputCell] = search;
+    costs[inputCell] = inputCost;
+    parents[inputCell] = inputParent;
+
+    //Estimate to goal is the number of steps with no walls in the way, which is never more than the real number
+    OpenNode node;
+    node.estimate = std::abs(inputCell / cols - searchGoal / cols) + std::abs(inputCell % cols - searchGoal % cols);
+    node.total = inputCost + node.estimate;
+    node.cell = inputCell;
+
+    open.push_back(node);
+    std::push_heap(open.begin(), open.end(), laterNode);
+}
+
+//Return whether open list entry passed should come off open list after the second. The heap keeps lowest total cost
+//on top, and of those the one closest to goal.
+bool Pathfinder::laterNode(const OpenNode& inputFirst, const OpenNode& inputSecond) {
+    return inputFirst.total > inputSecond.total ||
+           (inputFirst.total == inputSecond.total && inputFirst.estimate > inputSecond.estimate);
+}
+
+//Run A* search from start to goal, filling parents. Return whether goal was reached.
+bool Pathfinder::searchAStar(int inputStart) {
+    static const int rowSteps[4] = {-1, 0, 1, 0};
+    static const int colSteps[4] = {0, 1, 0, -1};
+
+    searches++;
+    open.clear();
+    pushOpen(inputStart, 0, -1);
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), laterNode);
+        const int cell = open.back().cell;
+        open.pop_back();
+
+        //Cells may be on open list more than once, only the cheapest is searched
+        if (closed[cell] == search) {
+            continue;
+        }
+        closed[cell] = search;
+
+        if (cell == searchGoal) {
+            return true;
+        }
+
+        const int row = cell / cols;
+        const int col = cell % cols;
+        for (int count = 0; count < 4; count++) {
+            if (passable(row + rowSteps[count], col + colSteps[count])) {
+                const int neighbor = cell + rowSteps[count] * cols + colSteps[count];
+                if (closed[neighbor] != search) {
+                    pushOpen(neighbor, costs[cell] + 1, cell);
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+//Run jump point search from start to goal, filling parents with jump point each jump point was reached from. Return
+//whether goal was reached.
+bool Pathfinder::searchJump(int inputStart) {
+    searches++;
+    open.clear();
+    pushOpen(inputStart, 0, -1);
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), laterNode);
+        const int cell = open.back().cell;
+        open.pop_back();
+
+        if (closed[cell] == search) {
+            continue;
+        }
+        closed[cell] = search;
+
+        if (cell == searchGoal) {
+            return true;
+        }
+
+        const int row = cell / cols;
+        const int col = cell % cols;
+        const int parent = parents[cell];
+        int jumps[4] = {-1, -1, -1, -1};
+
+        //Start searches every direction
+        if (parent < 0) {
+            jumps[0] = jumpVertical(row, col, -1);
+            jumps[1] = jumpHorizontal(row, col, 1);
+            jumps[2] = jumpVertical(row, col, 1);
+            jumps[3] = jumpHorizontal(row, col, -1);
+        }
+        //Horizontal run carries on, and turns only where a blocked cell behind a vertical neighbor forces it to
+        else if (parent / cols == row) {
+            const int colStep = (col > parent % cols) ? 1 : -1;
+
+            jumps[0] = jumpHorizontal(row, col, colStep);
+            if (passable(row - 1, col) && !passable(row - 1, col - colStep)) {
+                jumps[1] = jumpVertical(row, col, -1);
+            }
+            if (passable(row + 1, col) && !passable(row + 1, col - colStep)) {
+                jumps[2] = jumpVertical(row, col, 1);
+            }
+        }
+        //Vertical run carries on and may turn onto a horizontal run either way
+        else {
+            jumps[0] = jumpVertical(row, col, (row > parent / cols) ? 1 : -1);
+            jumps[1] = jumpHorizontal(row, col, 1);
+            jumps[2] = jumpHorizontal(row, col, -1);
+        }
+
+        for (int count = 0; count < 4; count++) {
+            const int jump = jumps[count];
+            if (jump >= 0 && closed[jump] != search) {
+                pushOpen(jump, costs[cell] + std::abs(jump / cols - row) + std::abs(jump % cols - col), cell);
+            }
+        }
+    }
+
+    return false;
+}
+
+//Step from row/col along row until a jump point is found: goal, or a cell with a vertical neighbor that can only be
+//reached through it, as the cell behind that neighbor is blocked. Returns jump point or -1 if a blocked cell is
+//reached first.
+int Pathfinder::jumpHorizontal(int inputRow, int inputCol, int inputStep) {
+    for (int col = inputCol + inputStep;; col += inputStep) {
+        if (!passable(inputRow, col)) {
+            return -1;
+        }
+
+        const int cell = inputRow * cols + col;
+        if (cell == searchGoal) {
+            return cell;
+        }
+
+        if ((passable(inputRow - 1, col) && !passable(inputRow - 1, col - inputStep)) ||
+            (passable(inputRow + 1, col) && !passable(inputRow + 1, col - inputStep))) {
+            return cell;
+        }
+    }
+}
+
+//Step from row/col along column until a jump point is found: goal, or a cell from which a horizontal run finds a jump
+//point. Returns jump point or -1 if a blocked cell is reached first.
+int Pathfinder::jumpVertical(int inputRow, int inputCol, int inputStep) {
+    for (int row = inputRow + inputStep;; row += inputStep) {
+        if (!passable(row, inputCol)) {
+            return -1;
+        }
+
+        const int cell = row * cols + inputCol;
+        if (cell == searchGoal) {
+            return cell;
+        }
+
+        if (jumpHorizontal(row, inputCol, 1) >= 0 || jumpHorizontal(row, inputCol, -1) >= 0) {
+            return cell;
+        }
+    }
+}
+
+//Write path found by last search from start to goal into path passed, filling in cells between jump points. A* paths
+//have no gaps, so filling in leaves them as they are.
+void Pathfinder::tracePath(int inputStart, std::vector <int>& outputPath) {
+    //Jump points from goal back to start
+    outputPath.clear();
+    for (int cell = searchGoal; cell != inputStart; cell = parents[cell]) {
+        outputPath.push_back(cell);
+    }
+    outputPath.push_back(inputStart);
+    std::reverse(outputPath.begin(), outputPath.end());
+
+    //Fill in straight runs between jump points, building filled path in frontier buffer and swapping it in
+    frontier.assign(1, inputStart);
+    for (unsigned count = 1; count < outputPath.size(); count++) {
+        const int from = outputPath[count - 1];
+        const int to = outputPath[count];
+        const int step = (from / cols == to / cols) ? ((to > from) ? 1 : -1) : ((to > from) ? cols : -cols);
+
+        for (int cell = from + step; cell != to; cell += step) {
+            frontier.push_back(cell);
+        }
+        frontier.push_back(to);
+    }
+    outputPath.swap(frontier);
+}
+
+//Add path to cache, with an entry for every region it crosses holding the run of path inside that region. A region
+//keeps at most a few runs toward each goal.
+void Pathfinder::storePath(const std::vector <int>& inputPath) {
+    static const unsigned maxRuns = 4;
+
+    if (paths.size() >= maxPaths) {
+        clearCache();
+    }
+
+    const unsigned pathIndex = static_cast<unsigned>(paths.size());
+    const unsigned last = static_cast<unsigned>(inputPath.size()) - 1;
+    const uint64_t goal = static_cast<uint32_t>(inputPath[last]);
+    paths.push_back(inputPath);
+
+    //Goal cell is not part of any run, as a zombie on goal has no step left to take
+    for (unsigned count = 0; count < last;) {
+        const int region = regionOf(inputPath[count]);
+
+        CacheEntry entry;
+        entry.path = pathIndex;
+        entry.begin = count;
+        while (count < last && regionOf(inputPath[count]) == region) {
+            count++;
+        }
+        entry.count = count - entry.begin;
+
+        std::vector <CacheEntry>& runs = cache[(static_cast<uint64_t>(region) << 32) | goal];
+        if (runs.size() < maxRuns) {
+            runs.push_back(entry);
+        }
+    }
+}
+
+//Breadth first search inside region of start cell for a cell marked as part of a cached path. Return direction of
+//first step toward it, or 0 if none can be reached inside region.
+int Pathfinder::stitchRegion(int inputStart) {
+    static const int rowSteps[4] = {-1, 0, 1, 0};
+    static const int colSteps[4] = {0, 1, 0, -1};
+
+    const int firstRow = inputStart / cols / regionSize * regionSize;
+    const int firstCol = inputStart % cols / regionSize * regionSize;
+
+    seen[inputStart] = search;
+    frontier.assign(1, inputStart);
+
+    for (unsigned head = 0; head < frontier.size(); head++) {
+        const int cell = frontier[head];
+        const int row = cell / cols;
+        const int col = cell % cols;
+
+        for (int count = 0; count < 4; count++) {
+            const int nextRow = row + rowSteps[count];
+            const int nextCol = col + colSteps[count];
+            if (nextRow < firstRow || nextRow >= firstRow + regionSize || nextRow >= rows ||
+                nextCol < firstCol || nextCol >= firstCol + regionSize || nextCol >= cols) {
+                continue;
+            }
+
+            const int neighbor = nextRow * cols + nextCol;
+            if (seen[neighbor] == search) {
+                continue;
+            }
+
+            //First step of route is kept for every cell reached, so it is known as soon as a path cell is found
+            const int firstStep = (cell == inputStart) ? count + 1 : firstSteps[cell];
+            if (marks[neighbor] == search) {
+                return firstStep;
+            }
+
+            if (searchTerrain[neighbor] == TERRAIN_FLOOR) {
+                seen[neighbor] = search;
+                firstSteps[neighbor] = static_cast<unsigned char>(firstStep);
+                frontier.push_back(neighbor);
+            }
+        }
+    }
+
+    return 0;
+}
+
+//Find shortest path from start cell to goal cell (tileIndex of each) over terrain layer of map size passed, without
+//using or filling cache. Path holds cells from start to goal, and is left empty if there is none.
+void Pathfinder::findPath(const unsigned char* inputTerrain, int inputRows, int inputCols, int inputStart,
+                          int inputGoal, std::vector <int>& outputPath) {
+    prepare(inputTerrain, inputRows, inputCols);
+    searchGoal = inputGoal;
+    outputPath.clear();
+
+    if (jumpSearch ? searchJump(inputStart) : searchAStar(inputStart)) {
+        tracePath(inputStart, outputPath);
+    }
+}
+
+//Return direction (1 up, 2 right, 3 down, 4 left) of next step from start cell toward goal cell on a shortest path,
+//taken from cache when it can, or 0 when start is goal or goal cannot be reached.
+int Pathfinder::nextDirection(const unsigned char* inputTerrain, int inputRows, int inputCols, int inputStart,
+                              int inputGoal) {
+    if (inputStart == inputGoal) {
+        return 0;
+    }
+
+    prepare(inputTerrain, inputRows, inputCols);
+    searchGoal = inputGoal;
+
+    std::unordered_map <uint64_t, std::vector<CacheEntry> >::iterator runs =
+            cache.find((static_cast<uint64_t>(regionOf(inputStart)) << 32) | static_cast<uint32_t>(inputGoal));
+
+    if (runs != cache.end()) {
+        //Start on a cached path takes next cell of that path
+        for (unsigned count = 0; count < runs->second.size(); count++) {
+            const CacheEntry& entry = runs->second[count];
+            const std::vector <int>& path = paths[entry.path];
+
+            for (unsigned cell = entry.begin; cell < entry.begin + entry.count; cell++) {
+                if (path[cell] == inputStart) {
+                    cacheHits++;
+                    return directionBetween(path[cell], path[cell + 1]);
+                }
+            }
+        }
+
+        //Otherwise head for nearest cell of a cached path in region
+        for (unsigned count = 0; count < runs->second.size(); count++) {
+            const CacheEntry& entry = runs->second[count];
+            const std::vector <int>& path = paths[entry.path];
+
+            for (unsigned cell = entry.begin; cell < entry.begin + entry.count; cell++) {
+                marks[path[cell]] = search;
+            }
+        }
+
+        const int direction = stitchRegion(inputStart);
+        if (direction != 0) {
+            cacheHits++;
+            return direction;
+        }
+
+        //Region search wrote this search number, full search needs a fresh one
+        prepare(inputTerrain, inputRows, inputCols);
+    }
+
+    //Search from start and cache path found
+    if (!(jumpSearch ? searchJump(inputStart) : searchAStar(inputStart))) {
+        return 0;
+    }
+
+    tracePath(inputStart, route);
+    storePath(route);
+
+    return directionBetween(route[0], route[1]);
+}
+
+//Drop all cached paths, keeping scratch arrays
+void Pathfinder::clearCache() {
+    //Clearing an empty table still walks its buckets, and maps clear cache on every terrain change while set up
+    if (!paths.empty()) {
+        paths.clear();
+        cache.clear();
+    }
+}
+
+//Return number of full searches made
+unsigned long long Pathfinder::getSearches() {
+    return searches;
+}
+
+//Return number of next steps taken from cache
+unsigned long long Pathfinder::getCacheHits() {
+    return cacheHits;
+}
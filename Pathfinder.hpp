@@ -0,0 +1,177 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Pathfinder class finds shortest paths over the terrain layer of a map, for zombies that head for a
+ * given cell (such as a noise or the last place the player was seen) rather than wandering. A path may only pass
+ * through floor cells, the same cells zombies may step into, except that it may end on any cell. Zombies are not
+ * obstacles to a path, as they move every turn: a zombie blocked by another zombie waits as it always has.
+ * Paths are found by A* or by jump point search, which gives paths of the same length while only putting the turning
+ * points of straight runs on the open list. Jump point search here follows the four direction version of the method:
+ * paths turn from a vertical run onto a horizontal run freely, but only turn off a horizontal run where a wall next to
+ * it forces them to, so of all shortest paths only one is ever searched.
+ * Found paths are cached by region of the start cell (square blocks of the map) and goal cell, so zombies following a
+ * path, or starting near a cell a path runs through, take their next step from the cache instead of searching again.
+ * When a path is stored, every region it crosses gets an entry for the rest of the path, so a zombie following it
+ * never searches again. A zombie in a cached region that is not on a cached path finds its way onto one by a
+ * breadth first search kept inside that region. Cache is cleared whenever a cell changes between floor and blocked.
+ * Scratch arrays are the size of map and stamped with the search they were written by instead of being cleared, and
+ * are only allocated once map is first searched.
+ * Variables: paths - Cached paths, cells from start to goal. cache - Cached path runs keyed by start region and goal.
+ * rows/cols - Size of map of scratch arrays. search - Number of current search, stamped into scratch arrays.
+ * seen/closed - Search each cell was last reached/finished in. costs - Steps from start of each cell reached. parents -
+ * Cell each cell was reached from. firstSteps - Direction of first step from start of each cell reached by a region
+ * search. marks - Search each cell was marked as part of a cached path in. open - Open list of A* and jump point
+ * search, a binary heap. frontier - Cells waiting to be searched by a region search. route - Path found by last
+ * search of nextDirection. jumpSearch - Whether paths are found by jump point search (default) or plain A*. searchGoal/
+ * searchTerrain - Goal and terrain layer of current search. searches/cacheHits - Number of full searches made and of
+ * next steps taken from cache.
+ * Functions: Constructor sets up empty cache.
+ * setJumpSearch - Set whether paths are found by jump point search or plain A*.
+ * findPath - Find shortest path from start cell to goal cell, without using or filling cache.
+ * nextDirection - Return direction of next step from start cell toward goal cell, from cache when it can.
+ * clearCache - Drop all cached paths.
+ * getSearches/getCacheHits - Return number of full searches made and of next steps taken from cache.
+ * regionOf - Return region a cell is in.
+ * directionBetween - Return direction of step between two cells next to each other.
+ * prepare - Size scratch arrays to map and start a new search number.
+ * passable - Return whether a path may enter row/col in current search.
+ * searchAStar/searchJump - Run A* or jump point search from start to goal, filling parents.
+ * pushOpen - Add cell to open list of a search.
+ * laterNode - Return whether open list entry passed should come off open list after the second.
+ * jumpHorizontal/jumpVertical - Step from row/col in one direction until a jump point is found, returning it or -1.
+ * tracePath - Write path found by last search from start to goal.
+ * storePath - Add path to cache, with an entry for every region it crosses.
+ * stitchRegion - Breadth first search inside region of start cell for a cell marked as part of a cached path.
+*/
+
+#ifndef PATHFINDER_HPP
+#define PATHFINDER_HPP
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Space.hpp"
+
+class Pathfinder {
+private:
+    //Run of a cached path inside one region: path number, position of first cell of run and number of cells in run
+    struct CacheEntry {
+        unsigned path;
+        unsigned begin;
+        unsigned count;
+    };
+
+    //Entry of open list of a search: cost from start plus estimate to goal, estimate to goal and cell
+    struct OpenNode {
+        int total;
+        int estimate;
+        int cell;
+    };
+
+    //Width and height of regions cached paths are keyed by, and number of paths cached before cache starts over
+    static const int regionSize = 16;
+    static const unsigned maxPaths = 4096;
+
+    //Cached paths and runs of them keyed by start region and goal
+    std::vector <std::vector<int> > paths;
+    std::unordered_map <uint64_t, std::vector<CacheEntry> > cache;
+
+    //Scratch arrays, one entry per cell of map, stamped with search number instead of cleared
+    int rows,
+        cols;
+    uint32_t search;
+    std::vector <uint32_t> seen;
+    std::vector <uint32_t> closed;
+    std::vector <int> costs;
+    std::vector <int> parents;
+    std::vector <unsigned char> firstSteps;
+    std::vector <uint32_t> marks;
+    std::vector <OpenNode> open;
+    std::vector <int> frontier;
+
+    //Path found by last search of nextDirection, before it is copied into cache
+    std::vector <int> route;
+
+    //Whether paths are found by jump point search or plain A*, and goal of current search
+    bool jumpSearch;
+    int searchGoal;
+
+    //Terrain of current search
+    const unsigned char* searchTerrain;
+
+    //Number of full searches made and of next steps taken from cache
+    unsigned long long searches;
+    unsigned long long cacheHits;
+
+    //Return region a cell is in
+    int regionOf(int inputCell) const;
+
+    //Return direction (1 up, 2 right, 3 down, 4 left) of step between two cells next to each other
+    int directionBetween(int inputFrom, int inputTo) const;
+
+    //Size scratch arrays to map and start a new search number
+    void prepare(const unsigned char* inputTerrain, int inputRows, int inputCols);
+
+    //Return whether a path may enter row/col in current search: floor inside map, or goal cell. Defined in header as
+    //it is called for every cell looked at by a search.
+    bool passable(int inputRow, int inputCol) const {
+        if (inputRow < 0 || inputRow >= rows || inputCol < 0 || inputCol >= cols) {
+            return false;
+        }
+
+        const int cell = inputRow * cols + inputCol;
+        return searchTerrain[cell] == TERRAIN_FLOOR || cell == searchGoal;
+    }
+
+    //Run A* or jump point search from start to goal, filling parents. Return whether goal was reached.
+    bool searchAStar(int inputStart);
+    bool searchJump(int inputStart);
+
+    //Add cell to open list of a search with cost from start and parent passed, unless it was reached more cheaply
+    void pushOpen(int inputCell, int inputCost, int inputParent);
+
+    //Return whether open list entry passed should come off open list after the second. The heap keeps lowest total
+    //cost on top, and of those the one closest to goal.
+    static bool laterNode(const OpenNode& inputFirst, const OpenNode& inputSecond);
+
+    //Step from row/col in one direction until a jump point is found, returning it or -1 if a blocked cell is reached
+    int jumpHorizontal(int inputRow, int inputCol, int inputStep);
+    int jumpVertical(int inputRow, int inputCol, int inputStep);
+
+    //Write path found by last search from start to goal into path passed, filling in cells between jump points
+    void tracePath(int inputStart, std::vector <int>& outputPath);
+
+    //Add path to cache, with an entry for every region it crosses
+    void storePath(const std::vector <int>& inputPath);
+
+    //Breadth first search inside region of start cell for a cell marked as part of a cached path. Return direction of
+    //first step toward it, or 0 if none can be reached inside region.
+    int stitchRegion(int inputStart);
+
+public:
+    //Constructor sets up empty cache
+    Pathfinder();
+
+    //Set whether paths are found by jump point search (default) or plain A*
+    void setJumpSearch(bool inputJump);
+
+    //Find shortest path from start cell to goal cell (tileIndex of each) over terrain layer of map size passed,
+    //without using or filling cache. Path holds cells from start to goal, and is left empty if there is none.
+    void findPath(const unsigned char* inputTerrain, int inputRows, int inputCols, int inputStart, int inputGoal,
+                  std::vector <int>& outputPath);
+
+    //Return direction (1 up, 2 right, 3 down, 4 left) of next step from start cell toward goal cell on a shortest
+    //path, taken from cache when it can, or 0 when start is goal or goal cannot be reached.
+    int nextDirection(const unsigned char* inputTerrain, int inputRows, int inputCols, int inputStart, int inputGoal);
+
+    //Drop all cached paths, keeping scratch arrays
+    void clearCache();
+
+    //Return number of full searches made
+    unsigned long long getSearches();
+
+    //Return number of next steps taken from cache
+    unsigned long long getCacheHits();
+};
+
+#endif //PATHFINDER_HPP
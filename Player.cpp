@@ -5,15 +5,17 @@
  * create a movable player object within the game world that can interact with objects, die, and possibly win the game.
  * Variables: static const char playerVisual for visualization of the player object on the map.
  * int value for maxInventory, which represents the maximum number of items Player class objects can hold.
- * Vector of strings representing inventory - A collection of items that player carries to complete objectives. There
+ * Vector of item kinds representing inventory - A collection of items that player carries to complete objectives. There
  * are 4 items possible in game and each item is removed when used.
  * bool value for gameWin - set to false initially as game has not been won yet.
- * Functions: Constructor for player class to set up starting player attributes through GamePiece. Takes string input
- * for player name and two int values for row/col that player is placed in. Passes all values to GamePiece class as
- * well as player visualization. Within player constructor, player is set to alive and gameWin is set to false.
+ * int value for keyChoice - Answer to whether key is used on a locked door given in advance (1 yes, 2 no), 0 to ask
+ * user, 3 to leave answer to useKey. bool value for keyAsked - Whether last interaction left answer to useKey.
+ * Functions: Constructor for player class to set up starting player attributes through GamePiece. Takes two int
+ * values for row/col that player is placed in. Passes both values to GamePiece class as well as player kind and
+ * player visualization. Within player constructor, player is set to alive and gameWin is set to false.
  * Default destructor - Removes all allocated memory as needed (nothing specific in player class)
  * addInventory - Add object to player inventory and return boolean value of true or false if object is picked up/added.
- * Takes string value of inventory item being added.
+ * Takes SpaceKind of inventory item being added.
  * interactObject - Player object interaction - If interaction is available for object, perform interaction. This is
  * abstract virtual function for all Space type objects. Player class interactions initiate opening/closing doors and
  * picking up items. Also used in allowing user to open locked doors if they have a key. Takes Space pointer as
@@ -23,6 +25,12 @@
  * setGameWin - Set game win value from boolean parameter passed to function.
  * getGameWin - Return game win boolean value.
  * viewInventory - Output inventory to screen for user viewing.
+ * setKeyChoice - Set answer to whether key is used on a locked door in advance, 0 to ask user.
+ * getKeyAsked - Return whether last interaction was with a locked door whose answer was left to useKey.
+ * useKey - Use key in bag on locked door passed, or keep it, as answered.
+ * getInventory - Return item kinds in player bag.
+ * getMaxInventory - Return number of items player bag holds.
+ * setInventory - Replace items in player bag without output, such as when a saved game is loaded.
  * findItem - Search items in players item bag and return boolean value if it exists or not. Does not remove item from
  * bag like useItem
 */
@@ -30,11 +38,10 @@
 #include "Player.hpp"
 #include "Door.hpp"
 
-//Constructor for player class to set up starting player attributes through GamePiece. Takes string input
-//for player name and two int values for row/col that player is placed in. Passes all values to GamePiece class as well
-//as player visualization. Within player constructor, player is set to alive and gameWin is set to false.
-Player::Player(std::string inputName, int inputRow, int inputCol) : GamePiece(playerVisual,
-        inputRow, inputCol, inputName) {
+//Constructor for player class to set up starting player attributes through GamePiece. Takes two int
+//values for row/col that player is placed in. Passes both values to GamePiece class as well as player kind and
+//player visualization. Within player constructor, player is set to alive and gameWin is set to false.
+Player::Player(int inputRow, int inputCol) : GamePiece(playerVisual, inputRow, inputCol, KIND_PLAYER) {
 
     //Set player to alive
     setAlive(true);
@@ -47,9 +54,9 @@ Player::Player(std::string inputName, int inputRow, int inputCol) : GamePiece(pl
 Player::~Player() {}
 
 
-//Add object to player inventory and return boolean value of true or false if object is picked up/added. Takes string
-//value of inventory item being added.
-bool Player::addInventory(std::string inputInventoryItem) {
+//Add object to player inventory and return boolean value of true or false if object is picked up/added. Takes
+//SpaceKind of inventory item being added.
+bool Player::addInventory(SpaceKind inputInventoryItem) {
     bool itemPickedUp = false;
     int sizeInventory = static_cast<int>(inventory.size());
 
@@ -59,7 +66,7 @@ bool Player::addInventory(std::string inputInventoryItem) {
 
         itemPickedUp = true;
 
-        std::cout << "A " << inputInventoryItem << " was added to your bag." << std::endl;
+        std::cout << "A " << Space::kindName(inputInventoryItem) << " was added to your bag." << std::endl;
     }
 
     //If inventory limit is maxed out, do not add item to bag and output message to user.
@@ -78,46 +85,45 @@ bool Player::addInventory(std::string inputInventoryItem) {
 void Player::interactObject(Space *inputSpace) {
     //Perform item function if there is any (such as open/close door)
     inputSpace->interactObject(inputSpace);
+    keyAsked = false;
 
     //If locked door is encountered, request if user would like to use their key to open it, if they have one.
-    if (inputSpace->getName() == "locked door" && findItem("key")) {
+    if (inputSpace->getKind() == KIND_DOOR && inputSpace->getDoorState() == DOOR_LOCKED && findItem(KIND_KEY)) {
         std::cout << "Would you like to try using the key in your inventory to open the door?" << std::endl;
-        std::cout << "1. Yes    2. No" << std::endl;
 
-        //Validate user input
-        int userSelection = validateInputRangeInt(1, 2);
-
-        //Unlock door with key
-        if (userSelection == 1) {
-            //Use and delete item from inventory
-            useItem("key");
-
-            //Unlock door and output message to user.
-            dynamic_cast<Door*>(inputSpace)->setLocked(false);
-            dynamic_cast<Door*>(inputSpace)->setName("closed door");
-            std::cout << "The door was unlocked and may be opened!" << std::endl;
+        //Answer left to useKey is given later, such as by next key pressed in real-time mode
+        if (keyChoice == 3) {
+            std::cout << "Y. Yes    N. No" << std::endl;
+            keyAsked = true;
         }
-        //Do not use key and return item to bag.
         else {
-            std::cout << "The key was returned to your bag." << std::endl;
+            std::cout << "1. Yes    2. No" << std::endl;
+
+            //Validate user input, unless answer was given in advance
+            int userSelection = keyChoice;
+            if (userSelection == 0) {
+                userSelection = validateInputRangeInt(1, 2);
+            }
+
+            useKey(inputSpace, userSelection);
         }
     }
 
     //If the exit point is reached, check to make sure player has items needed to end the game and set end game to true
     //if so.
-    else if (inputSpace->getName() == "exit point" && useItem("medicine")) {
+    else if (inputSpace->getKind() == KIND_EXIT_POINT && useItem(KIND_MEDICINE)) {
         this->setWin(true);
     }
 
     //Object is an item and can be picked up. If item is added to inventory, set item picked up bool to true
     else if (inputSpace->getIsItem()) {
-        dynamic_cast<GamePiece*>(inputSpace)->setPickedUp(this->addInventory(inputSpace->getName()));
+        dynamic_cast<GamePiece*>(inputSpace)->setPickedUp(this->addInventory(inputSpace->getKind()));
     }
 }
 
 //Search items in players item bag and return boolean value for whether or not item was in
 //item bag. If item is found, delete item and remove from bag.
-bool Player::useItem(std::string inputItemSearch) {
+bool Player::useItem(SpaceKind inputItemSearch) {
     bool itemFound = false;
 
     //Loop through inventory bag
@@ -128,12 +134,13 @@ bool Player::useItem(std::string inputItemSearch) {
 
             //If medicine is being used, must be at exit point, do not need to output message about medicine being
             //used out of backpack.
-            if (inputItemSearch == "medicine") {
+            if (inputItemSearch == KIND_MEDICINE) {
 
             }
             //Item was used out of inventory/backpack, inform user.
             else {
-                std::cout << "A " << inputItemSearch << " was used out of backpack and lost." << std::endl;
+                std::cout << "A " << Space::kindName(inputItemSearch) << " was used out of backpack and lost."
+                          << std::endl;
             }
 
             //Remove item from inventory
@@ -149,7 +156,7 @@ bool Player::useItem(std::string inputItemSearch) {
 
 //Search items in players item bag and return boolean value if it exists or not. Does not remove item from bag like
 //useItem.
-bool Player::findItem(std::string inputItemSearch) {
+bool Player::findItem(SpaceKind inputItemSearch) {
     bool itemFound = false;
 
     //Loop through inventory bag
@@ -187,7 +194,7 @@ void Player::viewInventory() {
     if (inventory.size() > 0) {
         //Loop through inventory bag and output contents to screen
         for (unsigned count = 0; count < inventory.size(); count++) {
-            std::cout << stringUpperCase(inventory[count]);
+            std::cout << stringUpperCase(Space::kindName(inventory[count]));
 
             //If this is not the last item to be printed, print comma
             if ((count+1) != inventory.size()) {
@@ -201,4 +208,58 @@ void Player::viewInventory() {
     }
 
     std::cout << std::endl << std::endl;
-}
\ No newline at end of file
+}
+
+//Set answer to whether key is used on a locked door in advance (1 yes, 2 no), such as by an agent playing game, 0
+//(default) to ask user when a locked door is interacted with, or 3 to leave answer to useKey
+void Player::setKeyChoice(int inputChoice) {
+    keyChoice = inputChoice;
+}
+
+//Return whether last interaction was with a locked door whose answer was left to useKey
+bool Player::getKeyAsked() {
+    return keyAsked;
+}
+
+//Use key in bag on locked door passed and unlock it (1), or return key to bag (2). Does nothing if door is no longer
+//locked or key is no longer in bag.
+void Player::useKey(Space* inputSpace, int inputChoice) {
+    if (inputSpace->getKind() != KIND_DOOR || inputSpace->getDoorState() != DOOR_LOCKED || !findItem(KIND_KEY)) {
+        return;
+    }
+
+    //Unlock door with key
+    if (inputChoice == 1) {
+        //Use and delete item from inventory
+        useItem(KIND_KEY);
+
+        //Unlock door and output message to user.
+        dynamic_cast<Door*>(inputSpace)->setLocked(false);
+        std::cout << "The door was unlocked and may be opened!" << std::endl;
+    }
+    //Do not use key and return item to bag.
+    else {
+        std::cout << "The key was returned to your bag." << std::endl;
+    }
+}
+
+//Return item kinds in player bag, in order picked up
+const std::vector <SpaceKind>& Player::getInventory() {
+    return inventory;
+}
+
+//Return maximum number of items player bag holds
+int Player::getMaxInventory() {
+    return maxInventory;
+}
+
+//Replace items in player bag with item kinds passed, without output, such as when a saved game is loaded. Returns false
+//and leaves bag as it was if there are more items than bag holds.
+bool Player::setInventory(const std::vector <SpaceKind>& inputInventory) {
+    if (inputInventory.size() > static_cast<unsigned>(maxInventory)) {
+        return false;
+    }
+
+    inventory = inputInventory;
+    return true;
+}
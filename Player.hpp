@@ -5,15 +5,17 @@
  * create a movable player object within the game world that can interact with objects, die, and possibly win the game.
  * Variables: static const char playerVisual for visualization of the player object on the map.
  * int value for maxInventory, which represents the maximum number of items Player class objects can hold.
- * Vector of strings representing inventory - A collection of items that player carries to complete objectives. There
+ * Vector of item kinds representing inventory - A collection of items that player carries to complete objectives. There
  * are 4 items possible in game and each item is removed when used.
  * bool value for gameWin - set to false initially as game has not been won yet.
- * Functions: Constructor for player class to set up starting player attributes through GamePiece. Takes string input
- * for player name and two int values for row/col that player is placed in. Passes all values to GamePiece class as
- * well as player visualization. Within player constructor, player is set to alive and gameWin is set to false.
+ * int value for keyChoice - Answer to whether key is used on a locked door given in advance (1 yes, 2 no), 0 to ask
+ * user, 3 to leave answer to useKey. bool value for keyAsked - Whether last interaction left answer to useKey.
+ * Functions: Constructor for player class to set up starting player attributes through GamePiece. Takes two int
+ * values for row/col that player is placed in. Passes both values to GamePiece class as well as player kind and
+ * player visualization. Within player constructor, player is set to alive and gameWin is set to false.
  * Default destructor - Removes all allocated memory as needed (nothing specific in player class)
  * addInventory - Add object to player inventory and return boolean value of true or false if object is picked up/added.
- * Takes string value of inventory item being added.
+ * Takes SpaceKind of inventory item being added.
  * interactObject - Player object interaction - If interaction is available for object, perform interaction. This is
  * abstract virtual function for all Space type objects. Player class interactions initiate opening/closing doors and
  * picking up items. Also used in allowing user to open locked doors if they have a key. Takes Space pointer as
@@ -23,6 +25,12 @@
  * setGameWin - Set game win value from boolean parameter passed to function.
  * getGameWin - Return game win boolean value.
  * viewInventory - Output inventory to screen for user viewing.
+ * setKeyChoice - Set answer to whether key is used on a locked door in advance, 0 to ask user.
+ * getKeyAsked - Return whether last interaction was with a locked door whose answer was left to useKey.
+ * useKey - Use key in bag on locked door passed, or keep it, as answered.
+ * getInventory - Return item kinds in player bag.
+ * getMaxInventory - Return number of items player bag holds.
+ * setInventory - Replace items in player bag without output, such as when a saved game is loaded.
  * findItem - Search items in players item bag and return boolean value if it exists or not. Does not remove item from
  * bag like useItem
 */
@@ -42,7 +50,7 @@ private:
     static const char playerVisual = '@';
 
     //Vector container for items in player bag
-    std::vector <std::string> inventory;
+    std::vector <SpaceKind> inventory;
 
     //Maximum inventory limit for player bag
     const int maxInventory = 3;
@@ -50,19 +58,25 @@ private:
     //Boolean value for game objectives all achieved. Game win if set to true.
     bool gameWin = false;
 
+    //Answer to whether key is used on a locked door given in advance (1 yes, 2 no), 0 to ask user, or 3 to leave
+    //answer to useKey, such as in real-time mode where it is given by next key pressed
+    int keyChoice = 0;
+
+    //Whether last interaction was with a locked door whose answer was left to useKey
+    bool keyAsked = false;
 
 public:
-    //Constructor for player class to set up starting player attributes through GamePiece. Takes string input
-    //for player name and two int values for row/col that player is placed in. Passes all values to GamePiece class as well
-    //as player visualization. Within player constructor, player is set to alive and gameWin is set to false.
-    Player(std::string, int, int);
+    //Constructor for player class to set up starting player attributes through GamePiece. Takes two int
+    //values for row/col that player is placed in. Passes both values to GamePiece class as well as player kind and
+    //player visualization. Within player constructor, player is set to alive and gameWin is set to false.
+    Player(int, int);
 
     //Default destructor - Removes all allocated memory as needed
     ~Player();
 
-    //Add object to player inventory and return boolean value of true or false if object is picked up/added. Takes string
-    //value of inventory item being added.
-    bool addInventory(std::string);
+    //Add object to player inventory and return boolean value of true or false if object is picked up/added. Takes
+    //SpaceKind of inventory item being added.
+    bool addInventory(SpaceKind);
 
     //Player object interaction - If interaction is available for object, perform interaction. This is abstract virtual
     //function for all Space type objects. Player class interactions initiate opening/closing doors and picking up items.
@@ -72,11 +86,11 @@ public:
 
     //Search items in players item bag and return boolean value for whether or not item was in
     //item bag. If item is found, delete item and remove from bag.
-    bool useItem(std::string);
+    bool useItem(SpaceKind);
 
     //Search items in players item bag and return boolean value if it exists or not. Does not remove item from bag like
     //useItem
-    bool findItem(std::string inputItemSearch);
+    bool findItem(SpaceKind inputItemSearch);
 
     //Set game win value from boolean parameter passed to function.
     void setWin(bool inputWin);
@@ -86,6 +100,27 @@ public:
 
     //Output inventory to screen for user viewing
     void viewInventory();
+
+    //Set answer to whether key is used on a locked door in advance (1 yes, 2 no), such as by an agent playing game, 0
+    //(default) to ask user when a locked door is interacted with, or 3 to leave answer to useKey
+    void setKeyChoice(int inputChoice);
+
+    //Return whether last interaction was with a locked door whose answer was left to useKey
+    bool getKeyAsked();
+
+    //Use key in bag on locked door passed and unlock it (1), or return key to bag (2). Does nothing if door is no
+    //longer locked or key is no longer in bag.
+    void useKey(Space* inputSpace, int inputChoice);
+
+    //Return item kinds in player bag, in order picked up
+    const std::vector <SpaceKind>& getInventory();
+
+    //Return maximum number of items player bag holds
+    int getMaxInventory();
+
+    //Replace items in player bag with item kinds passed, without output, such as when a saved game is loaded. Returns
+    //false and leaves bag as it was if there are more items than bag holds.
+    bool setInventory(const std::vector <SpaceKind>& inputInventory);
 };
 
 
@@ -0,0 +1,52 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Random class is the seeded random number service shared by all maps in game. It keeps no engine state,
+ * every number is a hash of the game seed, a stream id and a counter. Each zombie owns a stream and counts its own
+ * draws, so the numbers a zombie receives only depend on the seed and how many numbers that zombie has drawn, never on
+ * the order zombies or maps are updated in or on how many threads update them. The same seed replays the same game.
+ * Variables: seed - Seed all numbers are derived from.
+ * Functions: Constructor takes seed for random numbers.
+ * mix - Return 64 bit value passed scrambled through the SplitMix64 finalizer.
+ * nameStream - Return stream id derived from name passed, used to give each map its own range of streams.
+ * draw - Return random 64 bit value for stream and counter passed.
+ * randomInt - Return random integer from min through max values for stream and counter passed.
+ * getSeed - Return seed.
+ * setSeed - Set seed to value passed.
+*/
+
+#include "Random.hpp"
+
+//Constructor takes seed for random numbers
+Random::Random(uint64_t inputSeed) {
+    seed = inputSeed;
+}
+
+//Return stream id derived from name passed, used to give each map its own range of streams
+uint64_t Random::nameStream(const std::string& inputName) {
+    //FNV-1a hash of name, scrambled so that similar names give unrelated streams
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned count = 0; count < inputName.size(); count++) {
+        hash = (hash ^ static_cast<unsigned char>(inputName[count])) * 0x100000001b3ULL;
+    }
+
+    return mix(hash);
+}
+
+//Return random integer from min through max values for stream and counter passed
+int Random::randomInt(uint64_t inputStream, uint64_t inputCounter, int minVal, int maxVal) const {
+    const uint64_t range = static_cast<uint64_t>(maxVal - minVal) + 1;
+
+    //Scale top 32 bits of draw into range by multiplying rather than taking a remainder
+    return minVal + static_cast<int>(((draw(inputStream, inputCounter) >> 32) * range) >> 32);
+}
+
+//Return seed
+uint64_t Random::getSeed() {
+    return seed;
+}
+
+//Set seed to value passed
+void Random::setSeed(uint64_t inputSeed) {
+    seed = inputSeed;
+}
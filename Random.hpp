@@ -0,0 +1,59 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Random class is the seeded random number service shared by all maps in game. It keeps no engine state,
+ * every number is a hash of the game seed, a stream id and a counter. Each zombie owns a stream and counts its own
+ * draws, so the numbers a zombie receives only depend on the seed and how many numbers that zombie has drawn, never on
+ * the order zombies or maps are updated in or on how many threads update them. The same seed replays the same game.
+ * Variables: seed - Seed all numbers are derived from.
+ * Functions: Constructor takes seed for random numbers.
+ * mix - Return 64 bit value passed scrambled through the SplitMix64 finalizer.
+ * nameStream - Return stream id derived from name passed, used to give each map its own range of streams.
+ * draw - Return random 64 bit value for stream and counter passed.
+ * randomInt - Return random integer from min through max values for stream and counter passed.
+ * getSeed - Return seed.
+ * setSeed - Set seed to value passed.
+*/
+
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+#include <string>
+
+class Random {
+private:
+    uint64_t seed;
+
+public:
+    //Constructor takes seed for random numbers
+    explicit Random(uint64_t inputSeed);
+
+    //Return 64 bit value passed scrambled through the SplitMix64 finalizer. Defined in header as it is called for
+    //every number drawn.
+    static uint64_t mix(uint64_t inputValue) {
+        inputValue = (inputValue ^ (inputValue >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        inputValue = (inputValue ^ (inputValue >> 27)) * 0x94d049bb133111ebULL;
+        return inputValue ^ (inputValue >> 31);
+    }
+
+    //Return stream id derived from name passed, used to give each map its own range of streams
+    static uint64_t nameStream(const std::string& inputName);
+
+    //Return random 64 bit value for stream and counter passed. Defined in header as it is called for every number
+    //drawn.
+    uint64_t draw(uint64_t inputStream, uint64_t inputCounter) const {
+        return mix(mix(seed + inputStream * 0x9e3779b97f4a7c15ULL) + inputCounter * 0xd1b54a32d192ed03ULL);
+    }
+
+    //Return random integer from min through max values for stream and counter passed
+    int randomInt(uint64_t inputStream, uint64_t inputCounter, int minVal, int maxVal) const;
+
+    //Return seed
+    uint64_t getSeed();
+
+    //Set seed to value passed
+    void setSeed(uint64_t inputSeed);
+};
+
+#endif //RANDOM_HPP
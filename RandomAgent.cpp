@@ -0,0 +1,76 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: RandomAgent class is an Agent that plays by chance. When the player stands next to something it can
+ * interact with (a door that is not open, an item or the exit point), it interacts with it half of the time. Otherwise
+ * it moves in a random direction the player can move in: onto a cell that is not solid, or off an open door into the
+ * map behind it. A key held is always used on a locked door. Choices are drawn from a Random service seeded with the
+ * seed of each game, so a game played by a RandomAgent is the same every time it is played with that seed.
+ * Variables: random - Random service seeded from seed of current game. counter - Number of choices drawn this game.
+ * Functions: Constructor sets up agent, ready for startGame.
+ * startGame - Seed choices from seed of new game.
+ * chooseAction - Return random action of player for this turn.
+*/
+
+#include "RandomAgent.hpp"
+
+//Stream choices are drawn from, apart from every stream of maps of the same seed
+static const uint64_t agentStream = Random::nameStream("RandomAgent");
+
+//Control selection of each direction of interaction, 1 up through 4 right
+static const char directionKeys[5] = {' ', 'W', 'S', 'A', 'D'};
+
+//Constructor sets up agent, ready for startGame
+RandomAgent::RandomAgent() : random(0), counter(0) {
+}
+
+//Seed choices from seed of new game passed
+void RandomAgent::startGame(uint64_t inputSeed) {
+    random.setSeed(inputSeed);
+    counter = 0;
+}
+
+//Return random action of player passed for this turn: interact with something next to player half of the time there
+//is something, otherwise move in a random direction player can move in
+AgentAction RandomAgent::chooseAction(Map* inputMap, Player* inputPlayer) {
+    const bool onOpenDoor = inputMap->getCurrentSpace()->isOpenDoor();
+
+    int interactions[4];
+    int moves[4];
+    int interactionCount = 0;
+    int moveCount = 0;
+
+    for (int direction = 1; direction <= 4; direction++) {
+        Space* space = spaceInDirection(inputMap, inputPlayer, direction);
+        if (space == nullptr) {
+            continue;
+        }
+
+        if (space->getInteract() && !space->isOpenDoor()) {
+            interactions[interactionCount++] = direction;
+        }
+        if (!space->getSolid() || (onOpenDoor && space->getMapId() != MAP_NONE)) {
+            moves[moveCount++] = direction;
+        }
+    }
+
+    //Key is always used on a locked door
+    AgentAction action;
+    action.direction = 0;
+    action.keyChoice = 1;
+
+    if (interactionCount > 0 && random.randomInt(agentStream, counter++, 0, 1) == 0) {
+        action.selection = 'E';
+        action.direction = interactions[random.randomInt(agentStream, counter++, 0, interactionCount - 1)];
+    }
+    else if (moveCount > 0) {
+        action.selection = directionKeys[moves[random.randomInt(agentStream, counter++, 0, moveCount - 1)]];
+    }
+
+    //Player is boxed in, a move into a wall lets turn pass
+    else {
+        action.selection = directionKeys[random.randomInt(agentStream, counter++, 1, 4)];
+    }
+
+    return action;
+}
@@ -0,0 +1,39 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: RandomAgent class is an Agent that plays by chance. When the player stands next to something it can
+ * interact with (a door that is not open, an item or the exit point), it interacts with it half of the time. Otherwise
+ * it moves in a random direction the player can move in: onto a cell that is not solid, or off an open door into the
+ * map behind it. A key held is always used on a locked door. Choices are drawn from a Random service seeded with the
+ * seed of each game, so a game played by a RandomAgent is the same every time it is played with that seed.
+ * Variables: random - Random service seeded from seed of current game. counter - Number of choices drawn this game.
+ * Functions: Constructor sets up agent, ready for startGame.
+ * startGame - Seed choices from seed of new game.
+ * chooseAction - Return random action of player for this turn.
+*/
+
+#ifndef RANDOMAGENT_HPP
+#define RANDOMAGENT_HPP
+
+#include "Agent.hpp"
+#include "Random.hpp"
+
+class RandomAgent : public Agent {
+private:
+    //Random service seeded from seed of current game, and number of choices drawn from it this game
+    Random random;
+    uint64_t counter;
+
+public:
+    //Constructor sets up agent, ready for startGame
+    RandomAgent();
+
+    //Seed choices from seed of new game passed
+    void startGame(uint64_t inputSeed);
+
+    //Return random action of player passed for this turn: interact with something next to player half of the time
+    //there is something, otherwise move in a random direction player can move in
+    AgentAction chooseAction(Map* inputMap, Player* inputPlayer);
+};
+
+#endif //RANDOMAGENT_HPP
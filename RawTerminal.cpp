@@ -0,0 +1,76 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: RawTerminal class reads single key presses from standard input without waiting for Enter, for the
+ * real-time mode of the game. While a RawTerminal exists, a terminal on standard input is switched out of line mode
+ * and stops echoing keys, and it is switched back when the RawTerminal is destroyed. Keys are waited for with poll, so
+ * a caller can wait for a key only until its next tick is due. Input that is not a terminal (such as a file or pipe)
+ * is read the same way, one character at a time, without changing any terminal settings. Keys are read straight from
+ * the input file descriptor, so standard input must not be buffered ahead by stdio (main turns its buffering off in
+ * real-time mode).
+ * Variables: savedSettings - Terminal settings of standard input before it was switched, restored on destruction.
+ * raw - Whether standard input is a terminal that was switched out of line mode.
+ * Functions: Constructor switches a terminal on standard input out of line mode, echo and signal keys.
+ * Destructor restores terminal settings saved by constructor.
+ * isRaw - Return whether standard input is a terminal switched out of line mode.
+ * readKey - Wait up to a number of milliseconds for a key and return it, KEY_NONE if none came or KEY_CLOSED once
+ * input has ended.
+*/
+
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include "RawTerminal.hpp"
+
+//Switch a terminal on standard input out of line mode, echo and signal keys, so keys are read as they are
+//pressed. Ctrl-C is read as a key rather than stopping program, so terminal settings are always restored. Input that
+//is not a terminal is left as it is.
+RawTerminal::RawTerminal() {
+    raw = false;
+
+    if (isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &savedSettings) == 0) {
+        struct termios settings = savedSettings;
+        settings.c_lflag &= ~(ICANON | ECHO | ISIG);
+        settings.c_cc[VMIN] = 1;
+        settings.c_cc[VTIME] = 0;
+
+        raw = tcsetattr(STDIN_FILENO, TCSANOW, &settings) == 0;
+    }
+}
+
+//Restore terminal settings saved by constructor
+RawTerminal::~RawTerminal() {
+    if (raw) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &savedSettings);
+    }
+}
+
+//Return whether standard input is a terminal switched out of line mode
+bool RawTerminal::isRaw() const {
+    return raw;
+}
+
+//Wait up to number of milliseconds passed (0 to not wait, negative to wait until one comes) for a key on standard
+//input and return it, KEY_NONE if no key came in time or KEY_CLOSED once input has ended
+int RawTerminal::readKey(int inputTimeout) {
+    struct pollfd input;
+    input.fd = STDIN_FILENO;
+    input.events = POLLIN;
+    input.revents = 0;
+
+    const int ready = poll(&input, 1, inputTimeout);
+    if (ready < 0) {
+        return (errno == EINTR) ? KEY_NONE : KEY_CLOSED;
+    }
+    if (ready == 0) {
+        return KEY_NONE;
+    }
+
+    unsigned char key = 0;
+    const ssize_t count = read(STDIN_FILENO, &key, 1);
+    if (count < 0 && errno == EINTR) {
+        return KEY_NONE;
+    }
+
+    return (count == 1) ? key : KEY_CLOSED;
+}
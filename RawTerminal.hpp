@@ -0,0 +1,60 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: RawTerminal class reads single key presses from standard input without waiting for Enter, for the
+ * real-time mode of the game. While a RawTerminal exists, a terminal on standard input is switched out of line mode
+ * and stops echoing keys, and it is switched back when the RawTerminal is destroyed. Keys are waited for with poll, so
+ * a caller can wait for a key only until its next tick is due. Input that is not a terminal (such as a file or pipe)
+ * is read the same way, one character at a time, without changing any terminal settings. Keys are read straight from
+ * the input file descriptor, so standard input must not be buffered ahead by stdio (main turns its buffering off in
+ * real-time mode).
+ * Variables: savedSettings - Terminal settings of standard input before it was switched, restored on destruction.
+ * raw - Whether standard input is a terminal that was switched out of line mode.
+ * Functions: Constructor switches a terminal on standard input out of line mode, echo and signal keys.
+ * Destructor restores terminal settings saved by constructor.
+ * isRaw - Return whether standard input is a terminal switched out of line mode.
+ * readKey - Wait up to a number of milliseconds for a key and return it, KEY_NONE if none came or KEY_CLOSED once
+ * input has ended.
+*/
+
+#ifndef RAWTERMINAL_HPP
+#define RAWTERMINAL_HPP
+
+#include <termios.h>
+
+//Values returned by readKey other than a key
+enum RawKey {
+    KEY_NONE = -1,
+    KEY_CLOSED = -2
+};
+
+class RawTerminal {
+private:
+    //Terminal settings of standard input before it was switched
+    struct termios savedSettings;
+
+    //Whether standard input is a terminal that was switched out of line mode
+    bool raw;
+
+    //Terminal settings are restored once, so a RawTerminal is not copied
+    RawTerminal(const RawTerminal&);
+    RawTerminal& operator=(const RawTerminal&);
+
+public:
+    //Switch a terminal on standard input out of line mode, echo and signal keys, so keys are read as they are
+    //pressed. Ctrl-C is read as a key rather than stopping program, so terminal settings are always restored. Input
+    //that is not a terminal is left as it is.
+    RawTerminal();
+
+    //Restore terminal settings saved by constructor
+    ~RawTerminal();
+
+    //Return whether standard input is a terminal switched out of line mode
+    bool isRaw() const;
+
+    //Wait up to number of milliseconds passed (0 to not wait, negative to wait until one comes) for a key on standard
+    //input and return it, KEY_NONE if no key came in time or KEY_CLOSED once input has ended
+    int readKey(int inputTimeout);
+};
+
+#endif //RAWTERMINAL_HPP
@@ -0,0 +1,290 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Replay class records every input of a game session to a compact binary replay file, or plays one back.
+ * A game draws all of its randomness from the seed of its Random service, so the seed, the options the world was set
+ * up with and the inputs given are enough to play the session out again exactly. Inputs are recorded where they are
+ * read: each selection returned by validateMove, each integer returned by validateInputRangeInt and, in real-time
+ * mode, the key carried out on each tick. When playing back, those same calls take their input from the replay file
+ * instead of standard input, so a session runs with no prompts as fast as the game can move.
+ * File format: 4 byte magic "ZRPL" and a version byte, then each field of ReplayHeader as an unsigned LEB128 varint
+ * (7 bits per byte, high bit set on all but last byte). Inputs follow, one byte each: a move selection is its position
+ * in "WSADIEQ", an integer choice is 0x10 plus its value (0x1F followed by a varint for values of 15 and up), a
+ * real-time tick is 0x20 when no key was carried out or 0x40 plus position of key in "WSADIEQ". Each byte says what
+ * kind of input it is, so a replay that does not match the game playing it is noticed at the first input that differs.
+ * Inputs are written to the file as they are made, so a session that ends badly is still recorded up to that point.
+ * Variables: header - Seed and world options of recorded session. data - Inputs of a replay being played. position -
+ * Next input byte of data to play. output - Replay file being recorded. recording/playing - Mode of replay.
+ * inputCount - Number of inputs recorded or played. diverged - Set when an input played did not match kind asked for.
+ * Functions: Constructor sets up replay neither recording nor playing.
+ * startRecording - Create replay file with header passed and record inputs into it from now on.
+ * load - Read replay file to play back.
+ * getHeader - Return seed and world options of replay.
+ * isRecording/isPlaying - Return mode of replay.
+ * recordMove/recordChoice/recordTick - Record one input of each kind.
+ * nextMove/nextChoice/nextTick - Return next input of each kind of replay being played.
+ * atEnd - Return whether all inputs of replay being played were used.
+ * hasDiverged - Return whether an input played did not match kind asked for.
+ * getInputCount - Return number of inputs recorded or played.
+ * writeVarint/readVarint - Write/read an unsigned LEB128 varint.
+ * writeInput - Write bytes of an input to replay file being recorded.
+ * nextByte - Return next input byte of replay being played, or mark replay diverged if it is of another kind.
+*/
+
+#include <iterator>
+#include "Replay.hpp"
+
+//Move selections and real-time keys in order of their codes in replay file
+static const std::string replayKeys = "WSADIEQ";
+
+//Version of replay file format written
+static const unsigned char formatVersion = 1;
+
+//First byte of each kind of input in replay file
+static const unsigned char moveByte = 0x00;
+static const unsigned char choiceByte = 0x10;
+static const unsigned char largeChoiceByte = 0x1F;
+static const unsigned char idleTickByte = 0x20;
+static const unsigned char keyTickByte = 0x40;
+
+//Constructor sets up replay neither recording nor playing
+Replay::Replay() {
+    header = ReplayHeader();
+    position = 0;
+    recording = false;
+    playing = false;
+    inputCount = 0;
+    diverged = false;
+}
+
+//Write unsigned LEB128 varint to buffer passed
+void Replay::writeVarint(std::vector <unsigned char>& outputBuffer, uint64_t inputValue) {
+    while (inputValue >= 0x80) {
+        outputBuffer.push_back(static_cast<unsigned char>(inputValue | 0x80));
+        inputValue >>= 7;
+    }
+    outputBuffer.push_back(static_cast<unsigned char>(inputValue));
+}
+
+//Read unsigned LEB128 varint from buffer passed at position passed, moving position past it. Returns false if buffer
+//ends before varint does.
+bool Replay::readVarint(const std::vector <unsigned char>& inputBuffer, std::size_t& inputPosition,
+                        uint64_t& outputValue) {
+    outputValue = 0;
+    for (int shift = 0; shift < 64 && inputPosition < inputBuffer.size(); shift += 7) {
+        const unsigned char byte = inputBuffer[inputPosition++];
+        outputValue |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//Write bytes passed to replay file being recorded, flushed so that they are kept if game ends badly
+void Replay::writeInput(const std::vector <unsigned char>& inputBytes) {
+    output.write(reinterpret_cast<const char*>(inputBytes.data()), inputBytes.size());
+    output.flush();
+    inputCount++;
+}
+
+//Return next input byte of replay being played if it is between low and high byte passed. Otherwise, or at end of
+//replay, replay is marked diverged (except at end) and -1 is returned.
+int Replay::nextByte(unsigned char inputLow, unsigned char inputHigh) {
+    if (diverged || position >= data.size()) {
+        return -1;
+    }
+
+    const unsigned char byte = data[position];
+    if (byte < inputLow || byte > inputHigh) {
+        diverged = true;
+        return -1;
+    }
+
+    position++;
+    inputCount++;
+    return byte;
+}
+
+//Create replay file at path passed with header passed and record inputs into it from now on. Returns false if file
+//could not be created.
+bool Replay::startRecording(const std::string& inputPath, const ReplayHeader& inputHeader) {
+    output.open(inputPath.c_str(), std::ios::binary | std::ios::trunc);
+    if (!output) {
+        return false;
+    }
+
+    header = inputHeader;
+    recording = true;
+    playing = false;
+    inputCount = 0;
+
+    std::vector <unsigned char> bytes;
+    bytes.push_back('Z');
+    bytes.push_back('R');
+    bytes.push_back('P');
+    bytes.push_back('L');
+    bytes.push_back(formatVersion);
+
+    const uint64_t fields[9] = {header.seed, header.chaseRadius, header.sightRadius, header.hearing,
+                                header.lodInterval, header.tickRate, header.outdoorRows, header.outdoorCols,
+                                header.outdoorZombies};
+    for (int count = 0; count < 9; count++) {
+        writeVarint(bytes, fields[count]);
+    }
+
+    output.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    output.flush();
+    return static_cast<bool>(output);
+}
+
+//Read replay file at path passed to play back. Returns false if file could not be read or is not a replay file of a
+//version this game plays.
+bool Replay::load(const std::string& inputPath) {
+    std::ifstream input(inputPath.c_str(), std::ios::binary);
+    if (!input) {
+        return false;
+    }
+
+    data.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    if (data.size() < 5 || data[0] != 'Z' || data[1] != 'R' || data[2] != 'P' || data[3] != 'L' ||
+        data[4] != formatVersion) {
+        return false;
+    }
+
+    position = 5;
+    uint64_t* fields[9] = {&header.seed, &header.chaseRadius, &header.sightRadius, &header.hearing,
+                           &header.lodInterval, &header.tickRate, &header.outdoorRows, &header.outdoorCols,
+                           &header.outdoorZombies};
+    for (int count = 0; count < 9; count++) {
+        if (!readVarint(data, position, *fields[count])) {
+            return false;
+        }
+    }
+
+    playing = true;
+    recording = false;
+    inputCount = 0;
+    diverged = false;
+    return true;
+}
+
+//Return seed and world options of replay
+const ReplayHeader& Replay::getHeader() const {
+    return header;
+}
+
+//Return whether inputs are being recorded
+bool Replay::isRecording() const {
+    return recording;
+}
+
+//Return whether inputs are being played back
+bool Replay::isPlaying() const {
+    return playing;
+}
+
+//Record move selection returned by validateMove (one of W, S, A, D, I, E, Q)
+void Replay::recordMove(const std::string& inputMove) {
+    const std::string::size_type code = replayKeys.find(inputMove);
+    if (!recording || inputMove.size() != 1 || code == std::string::npos) {
+        return;
+    }
+
+    writeInput(std::vector<unsigned char>(1, static_cast<unsigned char>(moveByte + code)));
+}
+
+//Record integer returned by validateInputRangeInt
+void Replay::recordChoice(int inputChoice) {
+    if (!recording) {
+        return;
+    }
+
+    std::vector <unsigned char> bytes;
+    if (inputChoice >= 0 && inputChoice < largeChoiceByte - choiceByte) {
+        bytes.push_back(static_cast<unsigned char>(choiceByte + inputChoice));
+    }
+    else {
+        bytes.push_back(largeChoiceByte);
+        writeVarint(bytes, static_cast<uint32_t>(inputChoice));
+    }
+
+    writeInput(bytes);
+}
+
+//Record key carried out on a real-time tick (W, S, A, D, I, E or Q), or no key with 0
+void Replay::recordTick(int inputKey) {
+    if (!recording) {
+        return;
+    }
+
+    const std::string::size_type code = (inputKey == 0) ? std::string::npos :
+                                        replayKeys.find(static_cast<char>(inputKey));
+    writeInput(std::vector<unsigned char>(1, (code == std::string::npos) ? idleTickByte :
+                                             static_cast<unsigned char>(keyTickByte + code)));
+}
+
+//Return next move selection of replay being played. Returns Q to exit game once replay has ended or diverged.
+std::string Replay::nextMove() {
+    const int byte = nextByte(moveByte, static_cast<unsigned char>(moveByte + replayKeys.size() - 1));
+
+    return (byte < 0) ? "Q" : replayKeys.substr(byte - moveByte, 1);
+}
+
+//Return next integer choice of replay being played, within min through max passed. Returns max once replay has ended
+//or diverged, which exits from start and reset menus.
+int Replay::nextChoice(int inputMin, int inputMax) {
+    const int byte = nextByte(choiceByte, largeChoiceByte);
+    if (byte < 0) {
+        return inputMax;
+    }
+
+    uint64_t choice = byte - choiceByte;
+    if (byte == largeChoiceByte && !readVarint(data, position, choice)) {
+        diverged = true;
+        return inputMax;
+    }
+
+    const int value = static_cast<int>(static_cast<uint32_t>(choice));
+    if (value < inputMin || value > inputMax) {
+        diverged = true;
+        return inputMax;
+    }
+
+    return value;
+}
+
+//Return key carried out on next real-time tick of replay being played, or 0 for no key. Returns Q once replay has
+//ended or diverged.
+int Replay::nextTick() {
+    const int byte = nextByte(idleTickByte, static_cast<unsigned char>(keyTickByte + replayKeys.size() - 1));
+    if (byte < 0) {
+        return 'Q';
+    }
+    if (byte == idleTickByte) {
+        return 0;
+    }
+    if (byte < keyTickByte) {
+        diverged = true;
+        return 'Q';
+    }
+
+    return replayKeys[byte - keyTickByte];
+}
+
+//Return whether all inputs of replay being played were used
+bool Replay::atEnd() const {
+    return position >= data.size();
+}
+
+//Return whether an input played did not match kind of input game asked for
+bool Replay::hasDiverged() const {
+    return diverged;
+}
+
+//Return number of inputs recorded or played
+unsigned long long Replay::getInputCount() const {
+    return inputCount;
+}
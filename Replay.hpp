@@ -0,0 +1,141 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Replay class records every input of a game session to a compact binary replay file, or plays one back.
+ * A game draws all of its randomness from the seed of its Random service, so the seed, the options the world was set
+ * up with and the inputs given are enough to play the session out again exactly. Inputs are recorded where they are
+ * read: each selection returned by validateMove, each integer returned by validateInputRangeInt and, in real-time
+ * mode, the key carried out on each tick. When playing back, those same calls take their input from the replay file
+ * instead of standard input, so a session runs with no prompts as fast as the game can move.
+ * File format: 4 byte magic "ZRPL" and a version byte, then each field of ReplayHeader as an unsigned LEB128 varint
+ * (7 bits per byte, high bit set on all but last byte). Inputs follow, one byte each: a move selection is its position
+ * in "WSADIEQ", an integer choice is 0x10 plus its value (0x1F followed by a varint for values of 15 and up), a
+ * real-time tick is 0x20 when no key was carried out or 0x40 plus position of key in "WSADIEQ". Each byte says what
+ * kind of input it is, so a replay that does not match the game playing it is noticed at the first input that differs.
+ * Inputs are written to the file as they are made, so a session that ends badly is still recorded up to that point.
+ * Variables: header - Seed and world options of recorded session. data - Inputs of a replay being played. position -
+ * Next input byte of data to play. output - Replay file being recorded. recording/playing - Mode of replay.
+ * inputCount - Number of inputs recorded or played. diverged - Set when an input played did not match kind asked for.
+ * Functions: Constructor sets up replay neither recording nor playing.
+ * startRecording - Create replay file with header passed and record inputs into it from now on.
+ * load - Read replay file to play back.
+ * getHeader - Return seed and world options of replay.
+ * isRecording/isPlaying - Return mode of replay.
+ * recordMove/recordChoice/recordTick - Record one input of each kind.
+ * nextMove/nextChoice/nextTick - Return next input of each kind of replay being played.
+ * atEnd - Return whether all inputs of replay being played were used.
+ * hasDiverged - Return whether an input played did not match kind asked for.
+ * getInputCount - Return number of inputs recorded or played.
+ * writeVarint/readVarint - Write/read an unsigned LEB128 varint.
+ * writeInput - Write bytes of an input to replay file being recorded.
+ * nextByte - Return next input byte of replay being played, or mark replay diverged if it is of another kind.
+*/
+
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+//Seed and options a recorded session's world was set up and played with
+struct ReplayHeader {
+    uint64_t seed;
+    uint64_t chaseRadius;
+    uint64_t sightRadius;
+    uint64_t hearing;
+    uint64_t lodInterval;
+    uint64_t tickRate;
+    uint64_t outdoorRows;
+    uint64_t outdoorCols;
+    uint64_t outdoorZombies;
+};
+
+class Replay {
+private:
+    //Seed and world options of recorded session
+    ReplayHeader header;
+
+    //Inputs of a replay being played and next input byte to play
+    std::vector <unsigned char> data;
+    std::size_t position;
+
+    //Replay file being recorded
+    std::ofstream output;
+
+    //Mode of replay
+    bool recording;
+    bool playing;
+
+    //Number of inputs recorded or played, and whether an input played did not match kind asked for
+    unsigned long long inputCount;
+    bool diverged;
+
+    //Write unsigned LEB128 varint to buffer passed
+    static void writeVarint(std::vector <unsigned char>& outputBuffer, uint64_t inputValue);
+
+    //Read unsigned LEB128 varint from buffer passed at position passed, moving position past it. Returns false if
+    //buffer ends before varint does.
+    static bool readVarint(const std::vector <unsigned char>& inputBuffer, std::size_t& inputPosition,
+                           uint64_t& outputValue);
+
+    //Write bytes passed to replay file being recorded, flushed so that they are kept if game ends badly
+    void writeInput(const std::vector <unsigned char>& inputBytes);
+
+    //Return next input byte of replay being played if it is between low and high byte passed. Otherwise, or at end of
+    //replay, replay is marked diverged (except at end) and -1 is returned.
+    int nextByte(unsigned char inputLow, unsigned char inputHigh);
+
+public:
+    //Constructor sets up replay neither recording nor playing
+    Replay();
+
+    //Create replay file at path passed with header passed and record inputs into it from now on. Returns false if
+    //file could not be created.
+    bool startRecording(const std::string& inputPath, const ReplayHeader& inputHeader);
+
+    //Read replay file at path passed to play back. Returns false if file could not be read or is not a replay file
+    //of a version this game plays.
+    bool load(const std::string& inputPath);
+
+    //Return seed and world options of replay
+    const ReplayHeader& getHeader() const;
+
+    //Return whether inputs are being recorded
+    bool isRecording() const;
+
+    //Return whether inputs are being played back
+    bool isPlaying() const;
+
+    //Record move selection returned by validateMove (one of W, S, A, D, I, E, Q)
+    void recordMove(const std::string& inputMove);
+
+    //Record integer returned by validateInputRangeInt
+    void recordChoice(int inputChoice);
+
+    //Record key carried out on a real-time tick (W, S, A, D, I, E or Q), or no key with 0
+    void recordTick(int inputKey);
+
+    //Return next move selection of replay being played. Returns Q to exit game once replay has ended or diverged.
+    std::string nextMove();
+
+    //Return next integer choice of replay being played, within min through max passed. Returns max once replay has
+    //ended or diverged, which exits from start and reset menus.
+    int nextChoice(int inputMin, int inputMax);
+
+    //Return key carried out on next real-time tick of replay being played, or 0 for no key. Returns Q once replay has
+    //ended or diverged.
+    int nextTick();
+
+    //Return whether all inputs of replay being played were used
+    bool atEnd() const;
+
+    //Return whether an input played did not match kind of input game asked for
+    bool hasDiverged() const;
+
+    //Return number of inputs recorded or played
+    unsigned long long getInputCount() const;
+};
+
+#endif //REPLAY_HPP
@@ -0,0 +1,116 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: ScriptedAgent class is an Agent that plays a fixed script, read from a file, in the same order every
+ * game. A script is written as a person types into the game, one input per line, and is read the way the game reads
+ * input: a control selection (W, S, A, D, I, E or Q in either case), after E a direction of interaction (1 up, 2 down,
+ * 3 left, 4 right) and, when that direction holds a locked door and the player holds a key, whether to use the key
+ * (1 yes, 2 no). Lines the game would not take at that point, such as menu choices, are skipped as the game asks
+ * again, so input given to a session of the game can be played back by an agent as it is. Once the script has run
+ * out the agent exits game (Q).
+ * Variables: script - Lines of script in order, in upper case. position - Next line of script to read this game.
+ * Functions: Constructor sets up agent with an empty script.
+ * load - Read script from file.
+ * getLength - Return number of lines in script.
+ * startGame - Start script again from its first line.
+ * chooseAction - Return next action of script.
+ * nextChoice - Read lines of script up to next number within range passed and return it.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include "ScriptedAgent.hpp"
+
+//Constructor sets up agent with an empty script, which exits every game straight away
+ScriptedAgent::ScriptedAgent() {
+    position = 0;
+}
+
+//Read script from file at path passed, replacing any script read before. Returns false if file could not be read.
+bool ScriptedAgent::load(const std::string& inputPath) {
+    std::ifstream input(inputPath.c_str());
+    if (!input) {
+        return false;
+    }
+
+    script.clear();
+    position = 0;
+
+    std::string line;
+    while (std::getline(input, line)) {
+        std::transform(line.begin(), line.end(), line.begin(), ::toupper);
+        script.push_back(line);
+    }
+
+    return true;
+}
+
+//Return number of lines in script
+unsigned ScriptedAgent::getLength() const {
+    return static_cast<unsigned>(script.size());
+}
+
+//Start script again from its first line. Seed is not used, a script plays the same in every game.
+void ScriptedAgent::startGame(uint64_t) {
+    position = 0;
+}
+
+//Return next action of script, reading lines of script as game would read them for player passed on map passed.
+//Returns exit game (Q) once script has run out.
+AgentAction ScriptedAgent::chooseAction(Map* inputMap, Player* inputPlayer) {
+    AgentAction action;
+    action.selection = 'Q';
+    action.direction = 0;
+    action.keyChoice = 0;
+
+    //Lines that are not a control selection are skipped, as validateMove asks again
+    char selection = 0;
+    while (position < script.size() && selection == 0) {
+        const std::string& line = script[position++];
+        if (line.size() == 1 && std::string("WSADIEQ").find(line[0]) != std::string::npos) {
+            selection = line[0];
+        }
+    }
+
+    if (selection == 'E') {
+        action.direction = nextChoice(1, 4);
+        if (action.direction == 0) {
+            return action;
+        }
+
+        //Game only asks about key when a locked door is interacted with holding a key
+        Space* space = spaceInDirection(inputMap, inputPlayer, action.direction);
+        if (space->getKind() == KIND_DOOR && space->getDoorState() == DOOR_LOCKED && inputPlayer->findItem(KIND_KEY)) {
+            action.keyChoice = nextChoice(1, 2);
+            if (action.keyChoice == 0) {
+                return action;
+            }
+        }
+    }
+
+    if (selection != 0) {
+        action.selection = selection;
+    }
+
+    return action;
+}
+
+//Read lines of script up to next one holding a number from min through max passed and return that number, as
+//validateInputRangeInt asks again until one is given. Returns 0 once script has run out.
+int ScriptedAgent::nextChoice(int inputMin, int inputMax) {
+    while (position < script.size()) {
+        const std::string& line = script[position++];
+        if (line.empty() || !std::all_of(line.begin(), line.end(), ::isdigit) || line.size() > 9) {
+            continue;
+        }
+
+        const int choice = std::atoi(line.c_str());
+        if (choice >= inputMin && choice <= inputMax) {
+            return choice;
+        }
+    }
+
+    return 0;
+}
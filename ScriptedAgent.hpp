@@ -0,0 +1,55 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: ScriptedAgent class is an Agent that plays a fixed script, read from a file, in the same order every
+ * game. A script is written as a person types into the game, one input per line, and is read the way the game reads
+ * input: a control selection (W, S, A, D, I, E or Q in either case), after E a direction of interaction (1 up, 2 down,
+ * 3 left, 4 right) and, when that direction holds a locked door and the player holds a key, whether to use the key
+ * (1 yes, 2 no). Lines the game would not take at that point, such as menu choices, are skipped as the game asks
+ * again, so input given to a session of the game can be played back by an agent as it is. Once the script has run
+ * out the agent exits game (Q).
+ * Variables: script - Lines of script in order, in upper case. position - Next line of script to read this game.
+ * Functions: Constructor sets up agent with an empty script.
+ * load - Read script from file.
+ * getLength - Return number of lines in script.
+ * startGame - Start script again from its first line.
+ * chooseAction - Return next action of script.
+ * nextChoice - Read lines of script up to next number within range passed and return it.
+*/
+
+#ifndef SCRIPTEDAGENT_HPP
+#define SCRIPTEDAGENT_HPP
+
+#include <string>
+#include <vector>
+#include "Agent.hpp"
+
+class ScriptedAgent : public Agent {
+private:
+    //Lines of script in order, in upper case, and next line of script to read this game
+    std::vector <std::string> script;
+    unsigned position;
+
+    //Read lines of script up to next one holding a number from min through max passed and return that number, as
+    //validateInputRangeInt asks again until one is given. Returns 0 once script has run out.
+    int nextChoice(int inputMin, int inputMax);
+
+public:
+    //Constructor sets up agent with an empty script, which exits every game straight away
+    ScriptedAgent();
+
+    //Read script from file at path passed, replacing any script read before. Returns false if file could not be read.
+    bool load(const std::string& inputPath);
+
+    //Return number of lines in script
+    unsigned getLength() const;
+
+    //Start script again from its first line. Seed is not used, a script plays the same in every game.
+    void startGame(uint64_t inputSeed);
+
+    //Return next action of script, reading lines of script as game would read them for player passed on map passed.
+    //Returns exit game (Q) once script has run out.
+    AgentAction chooseAction(Map* inputMap, Player* inputPlayer);
+};
+
+#endif //SCRIPTEDAGENT_HPP
@@ -0,0 +1,189 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: SightTable class answers whether one cell of a map can be seen from another within a sight radius, with
+ * walls, shelves and closed doors blocking sight. What can be seen from a cell is found once by recursive shadowcasting
+ * over the eight octants around it and kept as a view: one bit per cell of the square window of sight radius around
+ * the viewer. Views are cached by viewer cell, so asking whether a cell can be seen costs a bit test instead of
+ * walking a ray, and a viewer standing still or coming back to a cell never casts again. Terrain rarely changes, so
+ * cached views are only dropped when a cell changes between blocking and clear sight, which in the game is a door
+ * opening or closing. Sight is worked out from the viewer, so the map casts from the player and a zombie sees the
+ * player when its cell is in the player's view.
+ * Variables: views - Cached views keyed by tileIndex of viewer cell. opaque - 1 for each cell that blocks sight, in
+ * row-major order of map. rows/cols - Size of map. radius - Sight radius, 0 when nothing is seen. side - Width of view
+ * window, 2 * radius + 1. stale - Set when opaque no longer matches map and must be filled again before next cast.
+ * Functions: Constructor sets up empty table with no sight radius.
+ * setRadius - Set sight radius, dropping cached views.
+ * getRadius - Return sight radius.
+ * invalidate - Mark opaque cells stale, such as after whole map was set up again.
+ * isStale - Return whether opaque cells must be filled again before next cast.
+ * setSize - Size table to map and clear all opaque cells, dropping cached views.
+ * setOpaque - Set whether cell blocks sight, dropping cached views if it changed.
+ * viewFrom - Return view from viewer cell, cast and cached on first use.
+ * inView - Return whether offset from viewer passed is set in a view. Defined in header as a bit test.
+ * clearViews - Drop all cached views.
+ * castOctant - Recursive shadowcasting of one octant of a view.
+*/
+
+#include "SightTable.hpp"
+
+//Constructor sets up empty table with no sight radius
+SightTable::SightTable() {
+    rows = 0;
+    cols = 0;
+    radius = 0;
+    side = 1;
+    stale = true;
+}
+
+//Set sight radius, dropping cached views. 0 (default) means nothing is seen.
+void SightTable::setRadius(int inputRadius) {
+    radius = (inputRadius < 0) ? 0 : inputRadius;
+    side = 2 * radius + 1;
+    clearViews();
+}
+
+//Return sight radius, 0 when nothing is seen
+int SightTable::getRadius() const {
+    return radius;
+}
+
+//Mark opaque cells stale so that they are filled again before next cast, such as after whole map was set up again
+void SightTable::invalidate() {
+    stale = true;
+}
+
+//Return whether opaque cells must be filled again (setSize and setOpaque) before next cast
+bool SightTable::isStale() const {
+    return stale;
+}
+
+//Size table to map and clear all opaque cells, dropping cached views. Opaque cells are no longer stale once this is
+//done, as map fills them straight after through setOpaque.
+void SightTable::setSize(int inputRows, int inputCols) {
+    rows = inputRows;
+    cols = inputCols;
+    opaque.assign(rows * cols, 0);
+    stale = false;
+    clearViews();
+}
+
+//Set whether cell at tileIndex passed blocks sight, dropping cached views if it changed
+void SightTable::setOpaque(int inputIndex, bool inputOpaque) {
+    if (stale || opaque[inputIndex] == inputOpaque) {
+        return;
+    }
+
+    opaque[inputIndex] = inputOpaque;
+    clearViews();
+}
+
+//Return view from viewer cell at row/col, cast and cached on first use. Valid until next call that changes table.
+const std::vector <uint64_t>& SightTable::viewFrom(int viewerRow, int viewerCol) {
+    const int key = viewerRow * cols + viewerCol;
+
+    std::unordered_map <int, std::vector<uint64_t> >::iterator found = views.find(key);
+    if (found != views.end()) {
+        return found->second;
+    }
+
+    //Cache starts over once full, as a viewer rarely comes back to a cell it left long ago
+    if (views.size() >= maxViews) {
+        views.clear();
+    }
+
+    std::vector <uint64_t>& view = views[key];
+    view.assign((side * side + 63) / 64, 0);
+
+    //Viewer always sees its own cell
+    const int center = radius * side + radius;
+    view[center >> 6] |= uint64_t(1) << (center & 63);
+
+    //Multipliers turning octant step and depth into map column and row, one octant per entry
+    static const int colFromStep[8] = {1, 0, 0, -1, -1, 0, 0, 1};
+    static const int colFromDepth[8] = {0, 1, -1, 0, 0, -1, 1, 0};
+    static const int rowFromStep[8] = {0, 1, 1, 0, 0, -1, -1, 0};
+    static const int rowFromDepth[8] = {1, 0, 0, 1, -1, 0, 0, -1};
+
+    for (int octant = 0; octant < 8; octant++) {
+        castOctant(view, viewerRow, viewerCol, 1, 1.0, 0.0, rowFromDepth[octant], rowFromStep[octant],
+                   colFromDepth[octant], colFromStep[octant]);
+    }
+
+    return view;
+}
+
+//Drop all cached views
+void SightTable::clearViews() {
+    if (!views.empty()) {
+        views.clear();
+    }
+}
+
+//Recursive shadowcasting of one octant of view from viewer row/col, starting at row of octant passed and between start
+//and end slopes. Octant is given by the four multipliers turning octant row/column into map row/column. Each row of
+//octant is walked from its far edge toward its diagonal, and a run of blocking cells starts a new cast of the rows
+//beyond it between the slopes that still see past the run.
+void SightTable::castOctant(std::vector <uint64_t>& outputView, int viewerRow, int viewerCol, int inputRow,
+                            double inputStart, double inputEnd, int rowFromDepth, int rowFromStep, int colFromDepth,
+                            int colFromStep) {
+    if (inputStart < inputEnd) {
+        return;
+    }
+
+    const int radiusSquared = radius * radius;
+    double start = inputStart;
+    double nextStart = inputStart;
+
+    for (int depth = inputRow; depth <= radius; depth++) {
+        const int rowStep = -depth;
+        bool blocked = false;
+
+        for (int step = -depth; step <= 0; step++) {
+            const int rowOffset = step * rowFromStep + rowStep * rowFromDepth;
+            const int colOffset = step * colFromStep + rowStep * colFromDepth;
+            const double leftSlope = (step - 0.5) / (rowStep + 0.5);
+            const double rightSlope = (step + 0.5) / (rowStep - 0.5);
+
+            if (start < rightSlope) {
+                continue;
+            }
+            if (inputEnd > leftSlope) {
+                break;
+            }
+
+            //Cells off the map block sight and are never seen
+            const int row = viewerRow + rowOffset;
+            const int col = viewerCol + colOffset;
+            const bool inMap = row >= 0 && row < rows && col >= 0 && col < cols;
+            const bool blocks = !inMap || opaque[row * cols + col];
+
+            if (inMap && step * step + rowStep * rowStep <= radiusSquared) {
+                const int bit = (rowOffset + radius) * side + colOffset + radius;
+                outputView[bit >> 6] |= uint64_t(1) << (bit & 63);
+            }
+
+            //Inside a run of blocking cells, sight resumes past its far edge
+            if (blocked) {
+                if (blocks) {
+                    nextStart = rightSlope;
+                    continue;
+                }
+
+                blocked = false;
+                start = nextStart;
+            }
+            //First blocking cell of a run, rows beyond it are cast between start and its near edge
+            else if (blocks && depth < radius) {
+                blocked = true;
+                castOctant(outputView, viewerRow, viewerCol, depth + 1, start, leftSlope, rowFromDepth, rowFromStep,
+                           colFromDepth, colFromStep);
+                nextStart = rightSlope;
+            }
+        }
+
+        if (blocked) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: SightTable class answers whether one cell of a map can be seen from another within a sight radius, with
+ * walls, shelves and closed doors blocking sight. What can be seen from a cell is found once by recursive shadowcasting
+ * over the eight octants around it and kept as a view: one bit per cell of the square window of sight radius around
+ * the viewer. Views are cached by viewer cell, so asking whether a cell can be seen costs a bit test instead of
+ * walking a ray, and a viewer standing still or coming back to a cell never casts again. Terrain rarely changes, so
+ * cached views are only dropped when a cell changes between blocking and clear sight, which in the game is a door
+ * opening or closing. Sight is worked out from the viewer, so the map casts from the player and a zombie sees the
+ * player when its cell is in the player's view.
+ * Variables: views - Cached views keyed by tileIndex of viewer cell. opaque - 1 for each cell that blocks sight, in
+ * row-major order of map. rows/cols - Size of map. radius - Sight radius, 0 when nothing is seen. side - Width of view
+ * window, 2 * radius + 1. stale - Set when opaque no longer matches map and must be filled again before next cast.
+ * Functions: Constructor sets up empty table with no sight radius.
+ * setRadius - Set sight radius, dropping cached views.
+ * getRadius - Return sight radius.
+ * invalidate - Mark opaque cells stale, such as after whole map was set up again.
+ * isStale - Return whether opaque cells must be filled again before next cast.
+ * setSize - Size table to map and clear all opaque cells, dropping cached views.
+ * setOpaque - Set whether cell blocks sight, dropping cached views if it changed.
+ * viewFrom - Return view from viewer cell, cast and cached on first use.
+ * inView - Return whether offset from viewer passed is set in a view. Defined in header as a bit test.
+ * clearViews - Drop all cached views.
+ * castOctant - Recursive shadowcasting of one octant of a view.
+*/
+
+#ifndef SIGHTTABLE_HPP
+#define SIGHTTABLE_HPP
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class SightTable {
+private:
+    //Number of views cached before cache starts over
+    static const unsigned maxViews = 1024;
+
+    //Cached views keyed by tileIndex of viewer cell, one bit per cell of view window in row-major order
+    std::unordered_map <int, std::vector<uint64_t> > views;
+
+    //1 for each cell that blocks sight, in row-major order of map
+    std::vector <unsigned char> opaque;
+
+    //Size of map, sight radius and width of view window
+    int rows,
+        cols,
+        radius,
+        side;
+
+    //Whether opaque no longer matches map
+    bool stale;
+
+    //Recursive shadowcasting of one octant of view from viewer row/col, starting at row of octant passed and between
+    //start and end slopes. Octant is given by the four multipliers turning octant row/column into map row/column.
+    void castOctant(std::vector <uint64_t>& outputView, int viewerRow, int viewerCol, int inputRow, double inputStart,
+                    double inputEnd, int rowFromDepth, int rowFromStep, int colFromDepth, int colFromStep);
+
+public:
+    //Constructor sets up empty table with no sight radius
+    SightTable();
+
+    //Set sight radius, dropping cached views. 0 (default) means nothing is seen.
+    void setRadius(int inputRadius);
+
+    //Return sight radius, 0 when nothing is seen
+    int getRadius() const;
+
+    //Mark opaque cells stale so that they are filled again before next cast, such as after whole map was set up again
+    void invalidate();
+
+    //Return whether opaque cells must be filled again (setSize and setOpaque) before next cast
+    bool isStale() const;
+
+    //Size table to map and clear all opaque cells, dropping cached views. Opaque cells are no longer stale once this
+    //is done, as map fills them straight after through setOpaque.
+    void setSize(int inputRows, int inputCols);
+
+    //Set whether cell at tileIndex passed blocks sight, dropping cached views if it changed
+    void setOpaque(int inputIndex, bool inputOpaque);
+
+    //Return view from viewer cell at row/col, cast and cached on first use. Valid until next call that changes table.
+    const std::vector <uint64_t>& viewFrom(int viewerRow, int viewerCol);
+
+    //Return whether cell at row/col offset passed from viewer is set in view passed. Offsets further than sight radius
+    //in either direction are never in view. Defined in header as it is a bit test made for every zombie in sight
+    //radius.
+    bool inView(const std::vector <uint64_t>& inputView, int rowOffset, int colOffset) const {
+        if (rowOffset < -radius || rowOffset > radius || colOffset < -radius || colOffset > radius) {
+            return false;
+        }
+
+        const int bit = (rowOffset + radius) * side + colOffset + radius;
+        return (inputView[bit >> 6] >> (bit & 63)) & 1;
+    }
+
+    //Drop all cached views
+    void clearViews();
+};
+
+#endif //SIGHTTABLE_HPP
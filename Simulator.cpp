@@ -0,0 +1,195 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Simulator program for load testing the game engine. Plays a number of complete games with no terminal
+ * input or output, the player driven by an Agent in place of a person, and games sharded over a ThreadPool so that
+ * every core plays games at once. Each shard owns one Game (moving its maps on its own thread) and resets it for every
+ * game it takes, and game number N is always played with the same seed derived from base seed and N, so outcomes do
+ * not depend on number of threads or which shard plays which game. Outputs games per second, turns per second, rate
+ * of games won, lost (player killed) and timed out (timeToDeath ran out) and percentiles of time each turn took. An
+ * MctsAgent searches on every core itself, so its games are played one after another with rollouts of each turn
+ * spread over the threads instead, and rollouts per second and turns per game are output as well. Run through "make
+ * simulate" (or "make strength" for win rate of an MctsAgent against its rollout budget) or directly as Simulator.bin
+ * with optional arguments.
+ * Arguments: Simulator.bin [games] [agent] [threads] [seed] [chase] [sight] [noise] - Play games games (default
+ * 1000) with agent "random" (default, a RandomAgent), "script=FILE" (a ScriptedAgent playing script in FILE, such as
+ * input typed into a session of the game) or "mcts=BUDGET" (an MctsAgent playing BUDGET rollouts each turn) on
+ * threads threads (default one per core), seeds derived from seed (default 1). Chase and sight are chase and sight
+ * radius of zombies (default 0), noise is 1 for zombies to hear noises (default 0).
+ * Classes: NullBuffer - Stream buffer that drops everything written to it, put in place of standard output while
+ * games are played.
+ * Functions: elapsedSeconds - Return seconds passed since starting time point passed as parameter.
+ * percentile - Return value at fraction passed of sorted list passed.
+ * makeAgent - Return new agent named by argument passed for game passed, or nullptr if it is not one.
+ * main - Read arguments, play games on all threads and output results.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "Game.hpp"
+#include "MctsAgent.hpp"
+#include "RandomAgent.hpp"
+#include "ScriptedAgent.hpp"
+#include "ThreadPool.hpp"
+
+//Stream buffer that drops everything written to it. Standard output of every shard goes here while games are played,
+//it keeps no state so shards may write to it at once.
+class NullBuffer : public std::streambuf {
+protected:
+    //Drop single character written
+    int overflow(int inputChar) {
+        return traits_type::not_eof(inputChar);
+    }
+
+    //Drop characters written
+    std::streamsize xsputn(const char*, std::streamsize inputCount) {
+        return inputCount;
+    }
+};
+
+//Return seconds passed since starting time point passed as parameter
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//Return value at fraction passed (0 through 1) of sorted list passed, which must not be empty
+static double percentile(const std::vector <double>& inputSorted, double inputFraction) {
+    return inputSorted[static_cast<std::size_t>(inputFraction * (inputSorted.size() - 1))];
+}
+
+//Return new agent named by argument passed ("random", "script=FILE" or "mcts=BUDGET") to play game passed, searching
+//on threads passed if it searches, or nullptr if it is not one or script file could not be read
+static Agent* makeAgent(const char* inputName, Game& inputGame, unsigned inputThreads) {
+    if (std::strcmp(inputName, "random") == 0) {
+        return new RandomAgent();
+    }
+
+    if (std::strncmp(inputName, "script=", 7) == 0) {
+        ScriptedAgent* agent = new ScriptedAgent();
+        if (agent->load(inputName + 7)) {
+            return agent;
+        }
+        delete agent;
+    }
+
+    if (std::strncmp(inputName, "mcts=", 5) == 0 && std::atoi(inputName + 5) > 0) {
+        return new MctsAgent(inputGame, std::atoi(inputName + 5), inputThreads);
+    }
+
+    return nullptr;
+}
+
+//Read arguments, play games on all threads and output results
+int main(int argc, char* argv[]) {
+    const int games = (argc > 1) ? std::atoi(argv[1]) : 1000;
+    const char* agentName = (argc > 2) ? argv[2] : "random";
+    const unsigned threads = (argc > 3) ? std::atoi(argv[3]) : ThreadPool::defaultWorkers() + 1;
+    const uint64_t seed = (argc > 4) ? std::strtoull(argv[4], nullptr, 10) : 1;
+    const int chaseRadius = (argc > 5) ? std::atoi(argv[5]) : 0;
+    const int sightRadius = (argc > 6) ? std::atoi(argv[6]) : 0;
+    const bool hearing = (argc > 7) && std::atoi(argv[7]) != 0;
+
+    //Each shard plays with an agent of its own, this one only checks name
+    Game checkGame(seed, 0, 0, 0, 0);
+    Agent* checkAgent = (threads > 0) ? makeAgent(agentName, checkGame, 1) : nullptr;
+    if (games <= 0 || checkAgent == nullptr) {
+        std::cout << "Usage: Simulator.bin [games] [random|script=FILE|mcts=BUDGET] [threads] [seed] [chase] [sight] "
+                  << "[noise]" << std::endl;
+        delete checkAgent;
+        return 1;
+    }
+
+    //An agent that searches spreads its search over every thread, and plays games one after another
+    const bool searching = dynamic_cast<MctsAgent*>(checkAgent) != nullptr;
+    const unsigned searchThreads = searching ? threads : 1;
+    delete checkAgent;
+
+    ThreadPool pool(searching ? 0 : threads - 1);
+    const unsigned shards = pool.getThreadCount();
+
+    //Outcomes and turn times of each shard, summed once all games are played
+    std::vector <std::vector<unsigned> > outcomes(shards, std::vector<unsigned>(OUTCOME_QUIT + 1, 0));
+    std::vector <std::vector<double> > turnTimes(shards);
+    std::vector <unsigned long long> rollouts(shards, 0);
+    std::vector <double> searchSeconds(shards, 0.0);
+    std::atomic<int> nextGame(0);
+
+    //Game output is dropped, each game of a shard is still played with all of it written
+    NullBuffer nullBuffer;
+    std::streambuf* screen = std::cout.rdbuf(&nullBuffer);
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pool.run(shards, [&](unsigned shard) {
+        //Maps of each game are moved on the thread of its shard, as every core already plays a game or searches
+        Game game(seed, 0, 0, 0, 0);
+        game.setChaseRadius(chaseRadius);
+        game.setSightRadius(sightRadius);
+        game.setHearing(hearing);
+        game.setRender(false);
+
+        Agent* agent = makeAgent(agentName, game, searchThreads);
+
+        for (int gameNumber = nextGame++; gameNumber < games; gameNumber = nextGame++) {
+            game.resetWorld(Random::mix(seed + static_cast<uint64_t>(gameNumber)));
+            outcomes[shard][game.playAgent(*agent, &turnTimes[shard])]++;
+        }
+
+        MctsAgent* searcher = dynamic_cast<MctsAgent*>(agent);
+        if (searcher != nullptr) {
+            rollouts[shard] = searcher->getRollouts();
+            searchSeconds[shard] = searcher->getSearchSeconds();
+        }
+
+        delete agent;
+    });
+    const double seconds = elapsedSeconds(start);
+
+    std::cout.rdbuf(screen);
+
+    //Sum results of all shards
+    std::vector <unsigned> totals(OUTCOME_QUIT + 1, 0);
+    std::vector <double> allTurnTimes;
+    unsigned long long allRollouts = 0;
+    double allSearchSeconds = 0.0;
+    for (unsigned shard = 0; shard < shards; shard++) {
+        allRollouts += rollouts[shard];
+        allSearchSeconds += searchSeconds[shard];
+        for (unsigned outcome = 0; outcome < totals.size(); outcome++) {
+            totals[outcome] += outcomes[shard][outcome];
+        }
+        allTurnTimes.insert(allTurnTimes.end(), turnTimes[shard].begin(), turnTimes[shard].end());
+    }
+    std::sort(allTurnTimes.begin(), allTurnTimes.end());
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << games << " games, " << agentName << " agent, " << shards * searchThreads << " threads, seed " << seed
+              << ", chase radius " << chaseRadius << ", sight radius " << sightRadius
+              << (hearing ? ", zombies hear noise" : "") << std::endl;
+    std::cout << "  games          " << games / seconds << " games/s, " << allTurnTimes.size() / seconds
+              << " turns/s, " << seconds << " s" << std::endl;
+    std::cout << "  outcomes       won " << 100.0 * totals[OUTCOME_WON] / games << "%, lost "
+              << 100.0 * totals[OUTCOME_LOST] / games << "%, timed out " << 100.0 * totals[OUTCOME_TIMEOUT] / games
+              << "%, quit " << 100.0 * totals[OUTCOME_QUIT] / games << "%" << std::endl;
+
+    if (searching) {
+        std::cout << "  search         " << allRollouts / allSearchSeconds << " rollouts/s, "
+                  << static_cast<double>(allTurnTimes.size()) / games << " turns per game" << std::endl;
+    }
+
+    if (!allTurnTimes.empty()) {
+        std::cout << "  turn latency   median " << percentile(allTurnTimes, 0.5) * 1e3 << " us, p90 "
+                  << percentile(allTurnTimes, 0.9) * 1e3 << " us, p99 " << percentile(allTurnTimes, 0.99) * 1e3
+                  << " us, p99.9 " << percentile(allTurnTimes, 0.999) * 1e3 << " us, max "
+                  << allTurnTimes.back() * 1e3 << " us (" << allTurnTimes.size() << " turns)" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Snapshot class is a byte buffer that the state of a game is saved into and loaded from, and read from
+ * or written to a save file whole. Values are written compactly: unsigned integers as LEB128 varints (7 bits per byte,
+ * high bit set on all but last byte), signed integers zigzag encoded first so small negative values stay short, and
+ * runs of small values (such as the TerrainKind of every cell of a map) packed several to a byte. Reads past the end
+ * of the buffer or of a value that does not fit return 0 and mark snapshot failed rather than throwing, so a loader
+ * can read a whole section and check once whether it was good.
+ * Variables: data - Bytes of snapshot. position - Next byte of data to read. failed - Set once a read went wrong.
+ * Functions: Constructor sets up empty snapshot.
+ * clear - Drop all bytes and start reading from start again.
+ * rewind - Start reading from start again, keeping bytes.
+ * writeByte/writeVarint/writeSigned/writeBytes - Write one byte, unsigned varint, zigzag signed varint or raw bytes.
+ * writePacked - Write list of small values packed several to a byte.
+ * readByte/readVarint/readSigned - Read one byte, unsigned varint or zigzag signed varint.
+ * readPacked - Read list of values written by writePacked.
+ * good - Return whether every read so far was good.
+ * atEnd - Return whether every byte has been read.
+ * fail - Mark snapshot failed, such as when a value read is out of range.
+ * getData - Return bytes of snapshot.
+ * saveFile - Write bytes of snapshot to a file.
+ * loadFile - Replace bytes of snapshot with contents of a file.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include "Snapshot.hpp"
+
+//Constructor sets up empty snapshot
+Snapshot::Snapshot() {
+    position = 0;
+    failed = false;
+}
+
+//Drop all bytes, clear failure and start reading from start again. Memory is kept for next save.
+void Snapshot::clear() {
+    data.clear();
+    position = 0;
+    failed = false;
+}
+
+//Start reading from start again and clear failure, keeping bytes, such as to load a snapshot just saved
+void Snapshot::rewind() {
+    position = 0;
+    failed = false;
+}
+
+//Write one byte
+void Snapshot::writeByte(unsigned char inputByte) {
+    data.push_back(inputByte);
+}
+
+//Write unsigned integer as LEB128 varint
+void Snapshot::writeVarint(uint64_t inputValue) {
+    while (inputValue >= 0x80) {
+        data.push_back(static_cast<unsigned char>(inputValue | 0x80));
+        inputValue >>= 7;
+    }
+    data.push_back(static_cast<unsigned char>(inputValue));
+}
+
+//Write signed integer as zigzag encoded varint, so that values near 0 of either sign take one byte
+void Snapshot::writeSigned(int64_t inputValue) {
+    writeVarint((static_cast<uint64_t>(inputValue) << 1) ^ static_cast<uint64_t>(inputValue >> 63));
+}
+
+//Write bytes passed as they are
+void Snapshot::writeBytes(const unsigned char* inputBytes, std::size_t inputCount) {
+    data.insert(data.end(), inputBytes, inputBytes + inputCount);
+}
+
+//Write list of values, each less than 2 to the power of bits passed (1, 2 or 4), packed 8 / bits to a byte with first
+//value in lowest bits
+void Snapshot::writePacked(const unsigned char* inputValues, std::size_t inputCount, unsigned inputBits) {
+    const unsigned perByte = 8 / inputBits;
+    const std::size_t start = data.size();
+    data.resize(start + (inputCount + perByte - 1) / perByte, 0);
+
+    //Each byte is put together whole, rather than or-ing every value into its byte, so a large map saves in one pass
+    unsigned char* output = &data[start];
+    const std::size_t wholeBytes = inputCount / perByte;
+    for (std::size_t byte = 0; byte < wholeBytes; byte++) {
+        const unsigned char* values = inputValues + byte * perByte;
+        unsigned packed = 0;
+        for (unsigned count = 0; count < perByte; count++) {
+            packed |= static_cast<unsigned>(values[count]) << (count * inputBits);
+        }
+        output[byte] = static_cast<unsigned char>(packed);
+    }
+    for (std::size_t count = wholeBytes * perByte; count < inputCount; count++) {
+        output[wholeBytes] |= static_cast<unsigned char>(inputValues[count] << (count % perByte * inputBits));
+    }
+}
+
+//Read one byte
+unsigned char Snapshot::readByte() {
+    if (position >= data.size()) {
+        failed = true;
+        return 0;
+    }
+
+    return data[position++];
+}
+
+//Read unsigned LEB128 varint
+uint64_t Snapshot::readVarint() {
+    uint64_t value = 0;
+
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (position >= data.size()) {
+            failed = true;
+            return 0;
+        }
+
+        const unsigned char byte = data[position++];
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+
+    //Varint longer than 64 bits
+    failed = true;
+    return 0;
+}
+
+//Read zigzag encoded signed varint
+int64_t Snapshot::readSigned() {
+    const uint64_t value = readVarint();
+
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+//Read list of count values written by writePacked with bits passed into array passed. Whole bytes are spread through
+//a table of the values each byte holds, so that a large map loads at close to the speed of copying it.
+void Snapshot::readPacked(unsigned char* outputValues, std::size_t inputCount, unsigned inputBits) {
+    const unsigned perByte = 8 / inputBits;
+    const std::size_t bytes = (inputCount + perByte - 1) / perByte;
+    if (data.size() - position < bytes) {
+        failed = true;
+        std::memset(outputValues, 0, inputCount);
+        return;
+    }
+
+    unsigned char table[256][8];
+    const unsigned char mask = static_cast<unsigned char>((1u << inputBits) - 1);
+    for (unsigned byte = 0; byte < 256; byte++) {
+        for (unsigned count = 0; count < perByte; count++) {
+            table[byte][count] = static_cast<unsigned char>((byte >> (count * inputBits)) & mask);
+        }
+    }
+
+    const unsigned char* input = &data[position];
+    const std::size_t wholeBytes = inputCount / perByte;
+    for (std::size_t count = 0; count < wholeBytes; count++) {
+        std::memcpy(outputValues + count * perByte, table[input[count]], perByte);
+    }
+    if (wholeBytes < bytes) {
+        std::memcpy(outputValues + wholeBytes * perByte, table[input[wholeBytes]], inputCount - wholeBytes * perByte);
+    }
+
+    position += bytes;
+}
+
+//Return whether every read so far was good
+bool Snapshot::good() const {
+    return !failed;
+}
+
+//Return whether every byte has been read
+bool Snapshot::atEnd() const {
+    return position >= data.size();
+}
+
+//Mark snapshot failed, such as when a value read is out of range for what it is read into
+void Snapshot::fail() {
+    failed = true;
+}
+
+//Return bytes of snapshot
+const std::vector <unsigned char>& Snapshot::getData() const {
+    return data;
+}
+
+//Write bytes of snapshot to file at path passed. Returns false if file could not be written.
+bool Snapshot::saveFile(const std::string& inputPath) const {
+    std::ofstream output(inputPath.c_str(), std::ios::binary | std::ios::trunc);
+    if (!output) {
+        return false;
+    }
+
+    output.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    return static_cast<bool>(output);
+}
+
+//Replace bytes of snapshot with contents of file at path passed, to be read from start. Returns false if file could
+//not be read.
+bool Snapshot::loadFile(const std::string& inputPath) {
+    std::ifstream input(inputPath.c_str(), std::ios::binary);
+    if (!input) {
+        return false;
+    }
+
+    clear();
+    data.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+
+    return !input.bad();
+}
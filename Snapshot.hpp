@@ -0,0 +1,101 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Snapshot class is a byte buffer that the state of a game is saved into and loaded from, and read from
+ * or written to a save file whole. Values are written compactly: unsigned integers as LEB128 varints (7 bits per byte,
+ * high bit set on all but last byte), signed integers zigzag encoded first so small negative values stay short, and
+ * runs of small values (such as the TerrainKind of every cell of a map) packed several to a byte. Reads past the end
+ * of the buffer or of a value that does not fit return 0 and mark snapshot failed rather than throwing, so a loader
+ * can read a whole section and check once whether it was good.
+ * Variables: data - Bytes of snapshot. position - Next byte of data to read. failed - Set once a read went wrong.
+ * Functions: Constructor sets up empty snapshot.
+ * clear - Drop all bytes and start reading from start again.
+ * rewind - Start reading from start again, keeping bytes.
+ * writeByte/writeVarint/writeSigned/writeBytes - Write one byte, unsigned varint, zigzag signed varint or raw bytes.
+ * writePacked - Write list of small values packed several to a byte.
+ * readByte/readVarint/readSigned - Read one byte, unsigned varint or zigzag signed varint.
+ * readPacked - Read list of values written by writePacked.
+ * good - Return whether every read so far was good.
+ * atEnd - Return whether every byte has been read.
+ * fail - Mark snapshot failed, such as when a value read is out of range.
+ * getData - Return bytes of snapshot.
+ * saveFile - Write bytes of snapshot to a file.
+ * loadFile - Replace bytes of snapshot with contents of a file.
+*/
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Snapshot {
+private:
+    //Bytes of snapshot and next byte to read
+    std::vector <unsigned char> data;
+    std::size_t position;
+
+    //Set once a read went past end of data or a value read was out of range
+    bool failed;
+
+public:
+    //Constructor sets up empty snapshot
+    Snapshot();
+
+    //Drop all bytes, clear failure and start reading from start again. Memory is kept for next save.
+    void clear();
+
+    //Start reading from start again and clear failure, keeping bytes, such as to load a snapshot just saved
+    void rewind();
+
+    //Write one byte
+    void writeByte(unsigned char inputByte);
+
+    //Write unsigned integer as LEB128 varint
+    void writeVarint(uint64_t inputValue);
+
+    //Write signed integer as zigzag encoded varint, so that values near 0 of either sign take one byte
+    void writeSigned(int64_t inputValue);
+
+    //Write bytes passed as they are
+    void writeBytes(const unsigned char* inputBytes, std::size_t inputCount);
+
+    //Write list of values, each less than 2 to the power of bits passed (1, 2 or 4), packed 8 / bits to a byte with
+    //first value in lowest bits
+    void writePacked(const unsigned char* inputValues, std::size_t inputCount, unsigned inputBits);
+
+    //Read one byte
+    unsigned char readByte();
+
+    //Read unsigned LEB128 varint
+    uint64_t readVarint();
+
+    //Read zigzag encoded signed varint
+    int64_t readSigned();
+
+    //Read list of count values written by writePacked with bits passed into array passed
+    void readPacked(unsigned char* outputValues, std::size_t inputCount, unsigned inputBits);
+
+    //Return whether every read so far was good
+    bool good() const;
+
+    //Return whether every byte has been read
+    bool atEnd() const;
+
+    //Mark snapshot failed, such as when a value read is out of range for what it is read into
+    void fail();
+
+    //Return bytes of snapshot
+    const std::vector <unsigned char>& getData() const;
+
+    //Write bytes of snapshot to file at path passed. Returns false if file could not be written.
+    bool saveFile(const std::string& inputPath) const;
+
+    //Replace bytes of snapshot with contents of file at path passed, to be read from start. Returns false if file
+    //could not be read.
+    bool loadFile(const std::string& inputPath);
+};
+
+#endif //SNAPSHOT_HPP
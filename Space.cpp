@@ -4,41 +4,40 @@
  * Description: Space class is the parent class to all aspects of the game that exist within the maps. Map class
  * objects are made up of Space objects to create the interactive and moving world we see. Space objects can be Floors,
  * Walls, Zombies, and more.
- * Variables: String values for name of Space and name of Map that space is located in.
+ * Behavior is decided through compact tags rather than names. Every Space carries a SpaceKind, doors also carry a
+ * DoorState, and doors carry the MapId of map they are in. The display name of a Space is only a lookup from these tags,
+ * used for text shown to the user.
+ * Variables: spaceKind - SpaceKind of Space. doorState - DoorState of doors (DOOR_CLOSED for all other kinds). mapId -
+ * MapId of map that door is located in (MAP_NONE for all other kinds).
  * Boolean values for whether or not space is solid, can be interacted with (picked up), is an item, and whether or not
  * it is alive (zombies/players).
- * Each Space object has four pointers to up, down, left, and right which is used to point to other Space objects
- * surrounding it. Space objects such as outer walls point to nullptr if there is the edge of the map.
- * int values for row/col, used to indicate where some objects are on map.
+ * int values for row/col, used to indicate where some objects are on map. Spaces surrounding a Space are not stored
+ * in the Space, they are looked up through Map from row/col.
  * char spaceVisualization to indicate what the Space looks like when the map is drawn.
- * Functions: Constructor #1 for space to create player/zombie related space object. Takes string for name of Space, int
+ * Functions: Constructor #1 for space to create player/zombie related space object. Takes SpaceKind of Space, int
  * values for location in row/col of map, and char visualization as parameters. Uses these values to set respective
- * attributes and sets all up/down/left/right pointers to null and the object to alive.
- * Constructor #2 creates non-moveable space objects such as doors, floors, walls, and items. Takes string for name of
+ * attributes and sets the object to alive.
+ * Constructor #2 creates non-moveable space objects such as doors, floors, walls, and items. Takes SpaceKind of
  * Space, char for visualization, and bool values for whether Space is solid and can be interacted with/picked up.
- * Constructor sets respective values received by parameter and sets all pointers to null.
+ * Constructor sets respective values received by parameter.
  * Default Destructor - Abstract Space class virtual default destructor
- * getName - Return string name of space
- * getUp - Return up space pointer
- * getDown - Return down space pointer
- * getLeft - Return left space pointer
- * getRight - Return right space pointer
+ * getName - Return display name of space looked up from its kind and door state. Only used for text shown to user.
+ * kindName - Return display name of SpaceKind passed, used for items in player inventory.
+ * getKind - Return SpaceKind of space.
+ * getDoorState - Return DoorState of space.
+ * setDoorState - Set DoorState of space. Takes DoorState as parameter.
+ * isOpenDoor - Return whether space is an open door or open space that can be passed through to another map.
  * getCurrent - Return current space pointer. NOT USED BUT LEFT IN CASE CHANGES ARE MADE OR THERE ARE ADDITIONS.
  * getVisual - Return character visual
  * setVisual - Set character visual - Such as if door is opened to change visualization. Takes char as parameter.
- * setUp - Set up space pointer. Takes Space pointer as parameter.
- * setDown - Set down space pointer. Takes Space pointer as parameter.
- * setLeft - Set left space pointer. Takes Space pointer as parameter.
- * setRight - Set right space pointer. Takes Space pointer as parameter.
  * getRows - Return int number of rows
  * getCols - Return int number of cols
  * setRows - Set number of rows. Takes int as parameter.
  * setCols - Set number of cols. Takes int as parameter.
  * setSolid - Set solid space boolean value (whether space object can be passed through or not). Takes bool as parameter.
- * setName - Set space objects string name representation. Takes string as parameter.
  * getSolid - Return boolean value for solid space (whether space object can be moved through or not)
  * getInteract - Return whether or not object is interactable by bool value
- * getMapName - Return string value for map that space is in.
+ * getMapId - Return MapId of map that door is in, MAP_NONE for spaces other than doors.
  * setInteract - Set whether or not object is interactable, takes boolean value for change
  * interactObject - Space object interaction - If interaction is available for object, perform interaction. This is
  * abstract virtual function for all Space type objects. Non-interactable objects describe what is seen while
@@ -53,12 +52,19 @@
 #include "Space.hpp"
 #include "Player.hpp"
 
-//Constructor for space to create player/zombie related space object. Takes string for name of Space,
+//Display name of each SpaceKind, indexed by SpaceKind. Doors are named from doorNames instead.
+static const std::string kindNames[KIND_COUNT] = {"floor", "wall", "shelf", "closed door", "exit point", "key", "knife",
+                                                  "medicine", "player", "zombie"};
+
+//Display name of each DoorState, indexed by DoorState
+static const std::string doorNames[DOOR_STATE_COUNT] = {"closed door", "locked door", "open door", "open space"};
+
+//Constructor for space to create player/zombie related space object. Takes SpaceKind of Space,
 //int values for location in row/col of map, and char visualization as parameters. Uses these values to set respective
-//attributes and sets all up/down/left/right pointers to null and the object to alive.
-Space::Space(std::string inputName, char inputVisual, int inputRow, int inputCol) {
-    //String value for space type
-    spaceName = inputName;
+//attributes and sets the object to alive.
+Space::Space(SpaceKind inputKind, char inputVisual, int inputRow, int inputCol) {
+    //Kind of space
+    spaceKind = inputKind;
 
     //Row/column of player or door
     row = inputRow;
@@ -69,20 +75,15 @@ Space::Space(std::string inputName, char inputVisual, int inputRow, int inputCol
 
     //Set to alive initially
     isAlive = true;
-
-    up = nullptr;
-    down = nullptr;
-    left = nullptr;
-    right = nullptr;
 }
 
 
-//Second Space constructor to create non-moveable space objects such as doors, floors, walls, and items. Takes string
-//for name of Space, char for visualization, and bool values for whether Space is solid and can be interacted
-//with/picked up. Constructor sets respective values received by parameter and sets all pointers to null.
-Space::Space(std::string inputName, char inputVisual, bool inputSolid, bool inputInteractable) {
-    //Declare space name and name of map it is located in (only for doors, "" for player)
-    spaceName = inputName;
+//Second Space constructor to create non-moveable space objects such as doors, floors, walls, and items. Takes
+//SpaceKind of Space, char for visualization, and bool values for whether Space is solid and can be interacted
+//with/picked up. Constructor sets respective values received by parameter.
+Space::Space(SpaceKind inputKind, char inputVisual, bool inputSolid, bool inputInteractable) {
+    //Declare space kind, map it is located in is only set for doors
+    spaceKind = inputKind;
 
     //Set visualization
     spaceVisual = inputVisual;
@@ -92,39 +93,24 @@ Space::Space(std::string inputName, char inputVisual, bool inputSolid, bool inpu
 
     //Set ability to interact with space to false (walls and blank space objects)
     spaceInteract = inputInteractable;
-
-    up = nullptr;
-    down = nullptr;
-    left = nullptr;
-    right = nullptr;
 }
 
 //Abstract Space class virtual default destructor
 Space::~Space() {}
 
-//Return string name of space
-std::string Space::getName() {
-    return spaceName;
+//Return display name of space looked up from its kind and door state. Only used for text shown to user.
+const std::string& Space::getName() {
+    return (spaceKind == KIND_DOOR) ? doorNames[doorState] : kindNames[spaceKind];
 }
 
-//Return up space pointer
-Space* Space::getUp() {
-    return up;
+//Return display name of SpaceKind passed, used for items in player inventory
+const std::string& Space::kindName(SpaceKind inputKind) {
+    return kindNames[inputKind];
 }
 
-//Return down space pointer
-Space* Space::getDown() {
-    return down;
-}
-
-//Return left space pointer
-Space* Space::getLeft() {
-    return left;
-}
-
-//Return right space pointer
-Space* Space::getRight() {
-    return right;
+//Set DoorState of space. Takes DoorState as parameter.
+void Space::setDoorState(DoorState inputState) {
+    doorState = inputState;
 }
 
 //Return int number of rows
@@ -147,26 +133,6 @@ void Space::setCols(int colInput) {
     col = colInput;
 }
 
-//Set up space pointer. Takes Space pointer as parameter.
-void Space::setUp(Space* inputSpace) {
-    up = inputSpace;
-}
-
-//Set down space pointer. Takes Space pointer as parameter.
-void Space::setDown(Space* inputSpace) {
-    down = inputSpace;
-}
-
-//Set left space pointer. Takes Space pointer as parameter.
-void Space::setLeft(Space* inputSpace) {
-    left = inputSpace;
-}
-
-//Set right space pointer. Takes Space pointer as parameter.
-void Space::setRight(Space* inputSpace) {
-    right = inputSpace;
-}
-
 //Return character visual
 char Space::getVisual() {
     return spaceVisual;
@@ -182,11 +148,6 @@ void Space::setSolid(bool inputSolid) {
     solidSpace = inputSolid;
 }
 
-//Set space objects string name representation. Takes string as parameter.
-void Space::setName(std::string inputName) {
-    spaceName = inputName;
-}
-
 //Return boolean value for solid space (whether space object can be moved through or not)
 bool Space::getSolid() {
     return solidSpace;
@@ -217,9 +178,9 @@ Space* Space::getCurrent() {
     return this;
 }
 
-//Return string value for map name that Space is in.
-std::string Space::getMapName() {
-    return mapName;
+//Return MapId of map that door is in, MAP_NONE for spaces other than doors.
+MapId Space::getMapId() {
+    return mapId;
 }
 
 //Return boolean value for whether Space object is an item or not
@@ -4,41 +4,41 @@
  * Description: Space class is the parent class to all aspects of the game that exist within the maps. Map class
  * objects are made up of Space objects to create the interactive and moving world we see. Space objects can be Floors,
  * Walls, Zombies, and more.
- * Variables: String values for name of Space and name of Map that space is located in.
+ * Behavior is decided through compact tags rather than names. Every Space carries a SpaceKind, doors also carry a
+ * DoorState, and doors carry the MapId of map they are in. The display name of a Space is only a lookup from these tags,
+ * used for text shown to the user. TerrainKind tags the cells of the Map terrain layer, it is declared here so that
+ * classes reading that layer directly (such as the zombie move kernel) do not need the Map class.
+ * Variables: spaceKind - SpaceKind of Space. doorState - DoorState of doors (DOOR_CLOSED for all other kinds). mapId -
+ * MapId of map that door is located in (MAP_NONE for all other kinds).
  * Boolean values for whether or not space is solid, can be interacted with (picked up), is an item, and whether or not
  * it is alive (zombies/players).
- * Each Space object has four pointers to up, down, left, and right which is used to point to other Space objects
- * surrounding it. Space objects such as outer walls point to nullptr if there is the edge of the map.
- * int values for row/col, used to indicate where some objects are on map.
+ * int values for row/col, used to indicate where some objects are on map. Spaces surrounding a Space are not stored
+ * in the Space, they are looked up through Map from row/col.
  * char spaceVisualization to indicate what the Space looks like when the map is drawn.
- * Functions: Constructor #1 for space to create player/zombie related space object. Takes string for name of Space, int
+ * Functions: Constructor #1 for space to create player/zombie related space object. Takes SpaceKind of Space, int
  * values for location in row/col of map, and char visualization as parameters. Uses these values to set respective
- * attributes and sets all up/down/left/right pointers to null and the object to alive.
- * Constructor #2 creates non-moveable space objects such as doors, floors, walls, and items. Takes string for name of
+ * attributes and sets the object to alive.
+ * Constructor #2 creates non-moveable space objects such as doors, floors, walls, and items. Takes SpaceKind of
  * Space, char for visualization, and bool values for whether Space is solid and can be interacted with/picked up.
- * Constructor sets respective values received by parameter and sets all pointers to null.
+ * Constructor sets respective values received by parameter.
  * Default Destructor - Abstract Space class virtual default destructor
- * getName - Return string name of space
- * getUp - Return up space pointer
- * getDown - Return down space pointer
- * getLeft - Return left space pointer
- * getRight - Return right space pointer
+ * getName - Return display name of space looked up from its kind and door state. Only used for text shown to user.
+ * kindName - Return display name of SpaceKind passed, used for items in player inventory.
+ * getKind - Return SpaceKind of space.
+ * getDoorState - Return DoorState of space.
+ * setDoorState - Set DoorState of space. Takes DoorState as parameter.
+ * isOpenDoor - Return whether space is an open door or open space that can be passed through to another map.
  * getCurrent - Return current space pointer. NOT USED BUT LEFT IN CASE CHANGES ARE MADE OR THERE ARE ADDITIONS.
  * getVisual - Return character visual
  * setVisual - Set character visual - Such as if door is opened to change visualization. Takes char as parameter.
- * setUp - Set up space pointer. Takes Space pointer as parameter.
- * setDown - Set down space pointer. Takes Space pointer as parameter.
- * setLeft - Set left space pointer. Takes Space pointer as parameter.
- * setRight - Set right space pointer. Takes Space pointer as parameter.
  * getRows - Return int number of rows
  * getCols - Return int number of cols
  * setRows - Set number of rows. Takes int as parameter.
  * setCols - Set number of cols. Takes int as parameter.
  * setSolid - Set solid space boolean value (whether space object can be passed through or not). Takes bool as parameter.
- * setName - Set space objects string name representation. Takes string as parameter.
  * getSolid - Return boolean value for solid space (whether space object can be moved through or not)
  * getInteract - Return whether or not object is interactable by bool value
- * getMapName - Return string value for map that space is in.
+ * getMapId - Return MapId of map that door is in, MAP_NONE for spaces other than doors.
  * setInteract - Set whether or not object is interactable, takes boolean value for change
  * interactObject - Space object interaction - If interaction is available for object, perform interaction. This is
  * abstract virtual function for all Space type objects. Non-interactable objects describe what is seen while
@@ -54,12 +54,55 @@
 #define SPACE_HPP
 
 #include <iostream>
+#include <string>
+
+//Kind of every Space in game. Decides behavior in place of the display name, which is looked up from it.
+enum SpaceKind : unsigned char {
+    KIND_FLOOR = 0,
+    KIND_WALL,
+    KIND_SHELF,
+    KIND_DOOR,
+    KIND_EXIT_POINT,
+    KIND_KEY,
+    KIND_KNIFE,
+    KIND_MEDICINE,
+    KIND_PLAYER,
+    KIND_ZOMBIE,
+    KIND_COUNT
+};
+
+//State of a door. DOOR_OPEN_SPACE is an open corridor between maps that can not be closed.
+enum DoorState : unsigned char {
+    DOOR_CLOSED = 0,
+    DOOR_LOCKED,
+    DOOR_OPEN,
+    DOOR_OPEN_SPACE,
+    DOOR_STATE_COUNT
+};
+
+//Map that a door is located in, used to find map to change to when moving through a door
+enum MapId : unsigned char {
+    MAP_NONE = 0,
+    MAP_OUTDOORS,
+    MAP_GROCERY_STORE,
+    MAP_REC_SUPPLIER,
+    MAP_FIELD
+};
+
+//Kinds of terrain stored per cell in terrain layer. TERRAIN_OBJECT marks a cell holding a stateful Space.
+enum TerrainKind {
+    TERRAIN_FLOOR = 0,
+    TERRAIN_WALL,
+    TERRAIN_SHELF,
+    TERRAIN_OBJECT
+};
 
 class Space {
 protected:
-    //Room information
-    std::string spaceName;
-    std::string mapName;
+    //Kind of Space, state of door and map door is in
+    SpaceKind spaceKind;
+    DoorState doorState = DOOR_CLOSED;
+    MapId mapId = MAP_NONE;
 
     //Boolean value for whether space object can be passed through or not
     bool solidSpace = true;
@@ -73,12 +116,6 @@ protected:
     //Zombie/Player alive
     bool isAlive;
 
-    //Space information/interactions
-    Space* up;
-    Space* down;
-    Space* left;
-    Space* right;
-
     //Position on board
     int row;
     int col;
@@ -87,33 +124,43 @@ protected:
     char spaceVisual = ' ';
 
 public:
-    //Constructor for space to create player/zombie related space object. Takes string for name of Space,
+    //Constructor for space to create player/zombie related space object. Takes SpaceKind of Space,
     //int values for location in row/col of map, and char visualization as parameters. Uses these values to set respective
-    //attributes and sets all up/down/left/right pointers to null and the object to alive.
-    Space(std::string, char, int, int);
+    //attributes and sets the object to alive.
+    Space(SpaceKind, char, int, int);
 
-    //Second Space constructor to create non-moveable space objects such as doors, floors, walls, and items. Takes string
-    //for name of Space, char for visualization, and bool values for whether Space is solid and can be interacted
-    //with/picked up. Constructor sets respective values received by parameter and sets all pointers to null.
-    Space(std::string, char, bool, bool);
+    //Second Space constructor to create non-moveable space objects such as doors, floors, walls, and items. Takes
+    //SpaceKind of Space, char for visualization, and bool values for whether Space is solid and can be interacted
+    //with/picked up. Constructor sets respective values received by parameter.
+    Space(SpaceKind, char, bool, bool);
 
     //Abstract Space class virtual default destructor
     virtual ~Space();
 
-    //Return string name of space
-    std::string getName();
+    //Return display name of space looked up from its kind and door state. Only used for text shown to user.
+    const std::string& getName();
+
+    //Return display name of SpaceKind passed, used for items in player inventory
+    static const std::string& kindName(SpaceKind);
 
-    //Return up space pointer
-    Space* getUp();
+    //Return SpaceKind of space. Defined in header as it is checked on every move.
+    SpaceKind getKind() {
+        return spaceKind;
+    }
 
-    //Return down space pointer
-    Space* getDown();
+    //Return DoorState of space. Defined in header as it is checked on every move.
+    DoorState getDoorState() {
+        return doorState;
+    }
 
-    //Return left space pointer
-    Space* getLeft();
+    //Set DoorState of space. Takes DoorState as parameter.
+    void setDoorState(DoorState);
 
-    //Return right space pointer
-    Space* getRight();
+    //Return whether space is an open door or open space that can be passed through to another map. Defined in header
+    //as it is checked on every move.
+    bool isOpenDoor() {
+        return spaceKind == KIND_DOOR && doorState >= DOOR_OPEN;
+    }
 
     //Return current space pointer. NOT USED BUT LEFT IN CASE CHANGES ARE MADE.
     Space* getCurrent();
@@ -124,18 +171,6 @@ public:
     //Set character visual - Such as if door is opened to change visualization. Takes char as parameter.
     void setVisual(char);
 
-    //Set up space pointer. Takes Space pointer as parameter.
-    void setUp(Space*);
-
-    //Set down space pointer. Takes Space pointer as parameter.
-    void setDown(Space*);
-
-    //Set left space pointer. Takes Space pointer as parameter.
-    void setLeft(Space*);
-
-    //Set right space pointer. Takes Space pointer as parameter.
-    void setRight(Space*);
-
     //Return int number of rows
     int getRows();
 
@@ -151,17 +186,14 @@ public:
     //Set solid space boolean value (whether space object can be passed through or not). Takes bool as parameter.
     void setSolid(bool);
 
-    //Set space objects string name representation. Takes string as parameter
-    void setName(std::string);
-
     //Return boolean value for solid space (whether space object can be moved through or not)
     bool getSolid();
 
     //Return whether or not object is interactable by bool value
     bool getInteract();
 
-    //Return string value for map name that Space is in.
-    std::string getMapName();
+    //Return MapId of map that door is in, MAP_NONE for spaces other than doors.
+    MapId getMapId();
 
     //Set whether or not object is interactable, takes boolean value for change
     void setInteract(bool);
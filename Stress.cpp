@@ -0,0 +1,102 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: Stress program for measuring how far Map and its zombies scale. Builds a scenario outdoors map of any
+ * size with any number of zombies, places the player at its start, then moves zombies for a number of ticks outside
+ * of the interactive game. Outputs time to set map up, ticks per second, zombie steps per second, slowest tick and
+ * peak resident memory of the process after setup and after all ticks. Run through "make stress" or directly as
+ * Stress.bin with optional arguments.
+ * Arguments: Stress.bin [size] [zombies] [ticks] [mode] [chase] [threads] - Outdoors map of size by size cells (default
+ * 4096, at most Outdoors::maxSize) with zombies scattered over it (default 250000), moved for ticks turns (default
+ * 100). Mode is "order" (default) to move zombies in order or "twophase" to move them in two phases on a ThreadPool of
+ * threads threads (default one per core). Chase is chase radius of zombies around player (default 0, zombies wander).
+ * Functions: elapsedSeconds - Return seconds passed since starting time point passed as parameter.
+ * peakMegabytes - Return peak resident memory of process so far in megabytes.
+ * main - Read arguments, build scenario map and run ticks.
+*/
+
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include "Outdoors.hpp"
+#include "Player.hpp"
+#include "ThreadPool.hpp"
+
+//Return seconds passed since starting time point passed as parameter
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//Return peak resident memory of process so far in megabytes. Linux reports it in kilobytes.
+static double peakMegabytes() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss / 1024.0;
+}
+
+//Read arguments, build scenario map and run ticks
+int main(int argc, char* argv[]) {
+    const int size = (argc > 1) ? std::atoi(argv[1]) : 4096;
+    const int zombies = (argc > 2) ? std::atoi(argv[2]) : 250000;
+    const int ticks = (argc > 3) ? std::atoi(argv[3]) : 100;
+    const bool twoPhase = (argc > 4) && std::strcmp(argv[4], "twophase") == 0;
+    const int chaseRadius = (argc > 5) ? std::atoi(argv[5]) : 0;
+    const int threadCount = (argc > 6) ? std::atoi(argv[6]) : static_cast<int>(ThreadPool::defaultWorkers()) + 1;
+
+    if (size <= 0 || size > Outdoors::maxSize || zombies < 0 || ticks <= 0 || threadCount < 1 ||
+        (argc > 4 && !twoPhase && std::strcmp(argv[4], "order") != 0)) {
+        std::cout << "Usage: Stress.bin [size] [zombies] [ticks] [order|twophase] [chase] [threads]" << std::endl;
+        return 1;
+    }
+
+    const unsigned threads = static_cast<unsigned>(threadCount);
+
+    std::cout << std::fixed << std::setprecision(3);
+    const double startMegabytes = peakMegabytes();
+
+    //Scenario map with player at its start, as a game would begin
+    Random random(1);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Outdoors map("Outside", &random, size, size, zombies);
+    const double setupSeconds = elapsedSeconds(start);
+
+    Player* player = new Player(map.getStartRow(), map.getStartCol());
+    map.setPlayerLocation(player, player->getRows(), player->getCols());
+    map.setChaseRadius(chaseRadius);
+    map.setMoveMode(twoPhase ? MOVE_TWO_PHASE : MOVE_IN_ORDER);
+
+    ThreadPool pool(threads - 1);
+    const double setupMegabytes = peakMegabytes();
+
+    std::cout << map.getRows() << "x" << map.getCols() << ", " << zombies << " scenario zombies, " << ticks
+              << " ticks, " << (twoPhase ? "two phase on " : "in order on ")
+              << (twoPhase ? pool.getThreadCount() : 1) << " threads, chase radius " << chaseRadius << std::endl;
+    std::cout << "  setup          " << setupSeconds * 1e3 << " ms" << std::endl;
+    std::cout << "  peak memory    " << setupMegabytes << " MB after setup (" << startMegabytes << " MB at start)"
+              << std::endl;
+
+    //Player never moves and has no knife, so once attacked it stays dead and zombies next to it keep attacking
+    double slowestSeconds = 0;
+    start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; tick++) {
+        std::chrono::steady_clock::time_point tickStart = std::chrono::steady_clock::now();
+
+        map.moveZombies(twoPhase ? &pool : nullptr);
+        map.checkZombies(player);
+
+        slowestSeconds = std::max(slowestSeconds, elapsedSeconds(tickStart));
+    }
+    const double tickSeconds = elapsedSeconds(start);
+
+    std::cout << "  ticks          " << ticks / tickSeconds << " ticks/s, " << ticks * (zombies / tickSeconds) / 1e6
+              << " million zombie steps/s, slowest tick " << slowestSeconds * 1e3 << " ms" << std::endl;
+    std::cout << "  peak memory    " << peakMegabytes() << " MB after ticks" << std::endl;
+
+    delete player;
+    return 0;
+}
@@ -0,0 +1,127 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: ThreadPool class keeps a fixed set of worker threads alive for the whole game so that work split into
+ * independent tasks, such as moving the zombies of each map, can be run on all cores every turn without starting
+ * threads each turn. run hands out tasks numbered 0 through count-1 to the workers and the calling thread, and only
+ * returns once every task has finished, so it acts as a barrier: nothing after run sees a half updated world. Tasks
+ * are claimed in any order by any thread, so they must not depend on each other. When tasks only touch their own data
+ * (and draw random numbers from the counter-based Random service), results are the same for any number of threads.
+ * Variables: workers - Worker threads. mutex - Guards batch state below. workReady - Signalled when a new batch of
+ * tasks is started or pool is stopping. workDone - Signalled when last worker leaves a batch. task - Function run for
+ * each task number of current batch. taskCount - Number of tasks in current batch. nextTask - Next task number to be
+ * claimed. busyWorkers - Workers that have not yet left current batch. batch - Number of batches started, used by
+ * workers to tell a new batch from the one they already ran. stopping - Set when pool is destroyed.
+ * Functions: Constructor takes number of worker threads to start, 0 runs all tasks on calling thread.
+ * Destructor stops and joins all worker threads.
+ * run - Run function passed for each task number from 0 through count-1 and return when all have finished.
+ * getThreadCount - Return number of threads tasks are run on, workers and calling thread.
+ * defaultWorkers - Return number of worker threads to start so that together with calling thread every core is used.
+*/
+
+#include "ThreadPool.hpp"
+
+//Constructor takes number of worker threads to start, 0 runs all tasks on calling thread
+ThreadPool::ThreadPool(unsigned inputWorkers) : nextTask(0) {
+    task = nullptr;
+    taskCount = 0;
+    busyWorkers = 0;
+    batch = 0;
+    stopping = false;
+
+    for (unsigned count = 0; count < inputWorkers; count++) {
+        workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+    }
+}
+
+//Destructor stops and joins all worker threads
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workReady.notify_all();
+
+    for (unsigned count = 0; count < workers.size(); count++) {
+        workers[count].join();
+    }
+}
+
+//Wait for batches of tasks and run them until pool is stopped
+void ThreadPool::workerLoop() {
+    uint64_t lastBatch = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!stopping && batch == lastBatch) {
+                workReady.wait(lock);
+            }
+
+            if (stopping) {
+                return;
+            }
+
+            lastBatch = batch;
+        }
+
+        runTasks();
+
+        //Last worker to leave batch wakes calling thread
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--busyWorkers == 0) {
+            workDone.notify_one();
+        }
+    }
+}
+
+//Claim and run tasks of current batch until none are left
+void ThreadPool::runTasks() {
+    for (unsigned taskNumber = nextTask++; taskNumber < taskCount; taskNumber = nextTask++) {
+        (*task)(taskNumber);
+    }
+}
+
+//Run function passed for each task number from 0 through count-1 on workers and calling thread, and return when all
+//have finished. Takes number of tasks and function taking task number.
+void ThreadPool::run(unsigned inputCount, const std::function<void(unsigned)>& inputTask) {
+    //Nothing to share out, run on calling thread without waking workers
+    if (workers.empty() || inputCount <= 1) {
+        for (unsigned taskNumber = 0; taskNumber < inputCount; taskNumber++) {
+            inputTask(taskNumber);
+        }
+        return;
+    }
+
+    //Start batch. Writes made here and by earlier batches are seen by workers once they take the lock.
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &inputTask;
+        taskCount = inputCount;
+        nextTask = 0;
+        busyWorkers = static_cast<unsigned>(workers.size());
+        batch++;
+    }
+    workReady.notify_all();
+
+    //Calling thread takes tasks too
+    runTasks();
+
+    //Barrier: wait for every worker to leave batch, so all tasks have finished and their writes are seen here
+    std::unique_lock<std::mutex> lock(mutex);
+    while (busyWorkers > 0) {
+        workDone.wait(lock);
+    }
+}
+
+//Return number of threads tasks are run on, workers and calling thread
+unsigned ThreadPool::getThreadCount() {
+    return static_cast<unsigned>(workers.size()) + 1;
+}
+
+//Return number of worker threads to start so that together with calling thread every core is used
+unsigned ThreadPool::defaultWorkers() {
+    const unsigned cores = std::thread::hardware_concurrency();
+
+    return (cores > 1) ? cores - 1 : 0;
+}
@@ -0,0 +1,76 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: ThreadPool class keeps a fixed set of worker threads alive for the whole game so that work split into
+ * independent tasks, such as moving the zombies of each map, can be run on all cores every turn without starting
+ * threads each turn. run hands out tasks numbered 0 through count-1 to the workers and the calling thread, and only
+ * returns once every task has finished, so it acts as a barrier: nothing after run sees a half updated world. Tasks
+ * are claimed in any order by any thread, so they must not depend on each other. When tasks only touch their own data
+ * (and draw random numbers from the counter-based Random service), results are the same for any number of threads.
+ * Variables: workers - Worker threads. mutex - Guards batch state below. workReady - Signalled when a new batch of
+ * tasks is started or pool is stopping. workDone - Signalled when last worker leaves a batch. task - Function run for
+ * each task number of current batch. taskCount - Number of tasks in current batch. nextTask - Next task number to be
+ * claimed. busyWorkers - Workers that have not yet left current batch. batch - Number of batches started, used by
+ * workers to tell a new batch from the one they already ran. stopping - Set when pool is destroyed.
+ * Functions: Constructor takes number of worker threads to start, 0 runs all tasks on calling thread.
+ * Destructor stops and joins all worker threads.
+ * run - Run function passed for each task number from 0 through count-1 and return when all have finished.
+ * getThreadCount - Return number of threads tasks are run on, workers and calling thread.
+ * defaultWorkers - Return number of worker threads to start so that together with calling thread every core is used.
+*/
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+private:
+    std::vector <std::thread> workers;
+
+    //Batch state, guarded by mutex
+    std::mutex mutex;
+    std::condition_variable workReady;
+    std::condition_variable workDone;
+    const std::function<void(unsigned)>* task;
+    unsigned taskCount;
+    std::atomic<unsigned> nextTask;
+    unsigned busyWorkers;
+    uint64_t batch;
+    bool stopping;
+
+    //Wait for batches of tasks and run them until pool is stopped
+    void workerLoop();
+
+    //Claim and run tasks of current batch until none are left
+    void runTasks();
+
+    //Pool owns its threads and cannot be copied
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+
+public:
+    //Constructor takes number of worker threads to start, 0 runs all tasks on calling thread
+    explicit ThreadPool(unsigned inputWorkers);
+
+    //Destructor stops and joins all worker threads
+    ~ThreadPool();
+
+    //Run function passed for each task number from 0 through count-1 on workers and calling thread, and return when
+    //all have finished. Takes number of tasks and function taking task number.
+    void run(unsigned inputCount, const std::function<void(unsigned)>& inputTask);
+
+    //Return number of threads tasks are run on, workers and calling thread
+    unsigned getThreadCount();
+
+    //Return number of worker threads to start so that together with calling thread every core is used
+    static unsigned defaultWorkers();
+};
+
+#endif //THREADPOOL_HPP
@@ -6,8 +6,10 @@
  * Variables: static const variables such as char for wallVisual to output to map when drawn and boolean values to set
  * the wall to solid (impassable) and interactable to false as it cannot be interacted with in the sense that it is
  * not an item.
- * Functions: Default constructor for wall object passes string value for "wall" and all static const values for
+ * Functions: Default constructor for wall object passes KIND_WALL and all static const values for
  * visualization, wallSolid, and interactable to Space constructor.
+ * Second constructor takes SpaceKind for wall-like objects such as shelves and passes it to Space constructor with
+ * the same static const values.
  * Default destructor for Wall object
  * interactObject - Overridden from abstract function in Space class - For Wall, a simple screen output describing
  * what is seen is displayed to user when user attempts to interact with the wall. Takes Space pointer, although Wall
@@ -16,9 +18,13 @@
 
 #include "Wall.hpp"
 
-//Default constructor for wall object passes string value for "wall" and all static const values for visualization,
+//Default constructor for wall object passes KIND_WALL and all static const values for visualization,
 //wallSolid, and interactable to Space constructor.
-Wall::Wall() : Space ("wall", wallVisual, wallSolid, interactable) {}
+Wall::Wall() : Space (KIND_WALL, wallVisual, wallSolid, interactable) {}
+
+//Constructor for wall-like objects such as shelves. Takes SpaceKind of object and passes it to Space
+//constructor along with static const values for visualization, wallSolid, and interactable.
+Wall::Wall(SpaceKind inputKind) : Space (inputKind, wallVisual, wallSolid, interactable) {}
 
 //Default destructor for Wall object
 Wall::~Wall() {}
@@ -0,0 +1,256 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: ZombieSwarm class holds the state of every zombie of a map as parallel arrays rather than one object per
+ * zombie, entry n of each array belonging to zombie n. Movement of all zombies is found by a batched kernel, propose,
+ * that runs the zombie move rule over whole arrays at once: loops over plain int arrays with no calls or branches on
+ * Space objects, which the compiler can vectorize with SSE/AVX2 where it supports them. The map then commits proposed
+ * moves, either in zombie order (whether a cell is still free depends on zombies moved before it) or in two phases
+ * where conflicts between proposals are resolved by a fixed rule (see Map).
+ * Zombie move rule: a zombie next to the player (up, down, left, right) attacks instead of moving. Otherwise, when
+ * movesLeft has run out it draws a new direction from its own random stream and movesLeft is reset to 2. It then
+ * steps one cell in its direction if that cell is floor and no zombie is on it, using up one of movesLeft, or sets
+ * movesLeft to 0 so that a new direction is drawn next turn. When the map gives a FlowField (zombies chase), a zombie
+ * inside the field instead turns toward the neighbor cell closest to the player without drawing, and only falls back to
+ * drawing when it is outside the field or no neighbor is closer. A zombie that is not chasing but has a goal cell
+ * (such as a noise) takes the step toward it the map worked out along a shortest path, also without drawing.
+ * Variables: rows/cols - Location of each zombie. directions - Direction each zombie is facing, 1 for up, 2 for right,
+ * 3 for down, 4 for left and 0 before first direction is drawn. movesLeft - Moves left before each zombie draws a new
+ * direction. alive - 1 while zombie is active, 0 once it is killed. streams - Random stream id of each zombie.
+ * counters - Number of random values each zombie has drawn from its stream. goals - tileIndex of cell each zombie heads
+ * for, -1 when it has none. sighted - 1 when goal of each zombie is a cell it saw the player in. slots - Handle slot
+ * of each zombie.
+ * Zombies are referred to from outside the swarm by ZombieHandle rather than by index, as a zombie killed is removed by
+ * moving the last zombie into its index. A handle names a slot and the generation of that slot when handle was taken.
+ * A slot keeps the index of the zombie holding it, and its generation is raised when that zombie is killed or removed,
+ * so a handle to a zombie that is gone no longer matches and is found stale rather than naming whichever zombie took
+ * its index or slot since.
+ * Handle variables: slotIndices - Index of zombie holding each slot. generations - Generation of each slot.
+ * freeSlots - Slots no zombie holds, given to zombies added next.
+ * Proposal arrays, filled by propose for each zombie: attacks - 1 if zombie attacks player. nextDirections - Direction
+ * after any new direction is drawn or chosen by chase. redraws - 1 if a new direction was drawn. targets - tileIndex
+ * of cell zombie would step into. opens - 1 if that cell is floor. steers - Direction of next step toward goal of each
+ * zombie, 0 when it has none, filled by map before propose.
+ * Functions: add - Add zombie at row/col drawing from random stream passed.
+ * kill - Mark zombie at index passed dead, making handles to it stale. Zombie keeps its index until it is removed.
+ * remove - Remove zombie at index passed by moving last zombie into its index.
+ * handleOf - Return handle of zombie at index passed.
+ * indexOf - Return index of zombie handle passed refers to, or -1 if it is stale.
+ * clear - Remove all zombies, keeping memory of arrays for next setup.
+ * copyFrom - Replace all zombies with copies of zombies of another swarm, arrays copied whole.
+ * takeSlot - Give zombie at index passed a free handle slot.
+ * size - Return number of zombies.
+ * resizeProposals - Size proposal arrays for current number of zombies.
+ * propose - Batched move kernel, fill proposal arrays for a range of zombies from terrain layer, player location,
+ * Random service and FlowField passed. Separate ranges may be proposed on separate threads.
+ * commit - Apply proposal of zombie at index passed, taking whether it is allowed to step into its target cell.
+*/
+
+#include <cstdlib>
+#include "ZombieSwarm.hpp"
+#include "Space.hpp"
+
+//Add zombie at row/col drawing from random stream passed. Zombie has 2 moves left, no direction and no goal yet,
+//and takes a free handle slot.
+void ZombieSwarm::add(int inputRow, int inputCol, uint64_t inputStream) {
+    rows.push_back(inputRow);
+    cols.push_back(inputCol);
+    directions.push_back(0);
+    movesLeft.push_back(2);
+    alive.push_back(1);
+    streams.push_back(inputStream);
+    counters.push_back(0);
+    goals.push_back(-1);
+    sighted.push_back(0);
+
+    slots.push_back(0);
+    takeSlot(size() - 1);
+}
+
+//Give zombie at index passed a free handle slot, reusing a slot freed by a zombie removed or opening a new one
+void ZombieSwarm::takeSlot(unsigned zombieIndex) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else {
+        slot = static_cast<uint32_t>(generations.size());
+        slotIndices.push_back(0);
+        generations.push_back(0);
+    }
+
+    slotIndices[slot] = zombieIndex;
+    slots[zombieIndex] = slot;
+}
+
+//Mark zombie at index passed dead, making handles to it stale. Zombie keeps its index until it is removed, so
+//zombies may be killed while arrays are walked and removed together afterwards.
+void ZombieSwarm::kill(unsigned zombieIndex) {
+    if (alive[zombieIndex]) {
+        alive[zombieIndex] = 0;
+        generations[slots[zombieIndex]]++;
+    }
+}
+
+//Remove zombie at index passed by moving last zombie into its index, freeing its handle slot. Only the zombie moved
+//changes index, so removing zombies costs the same however many zombies there are.
+void ZombieSwarm::remove(unsigned zombieIndex) {
+    kill(zombieIndex);
+    freeSlots.push_back(slots[zombieIndex]);
+
+    //Move last zombie into index of zombie removed and point its slot at its new index
+    const unsigned last = size() - 1;
+    if (zombieIndex != last) {
+        rows[zombieIndex] = rows[last];
+        cols[zombieIndex] = cols[last];
+        directions[zombieIndex] = directions[last];
+        movesLeft[zombieIndex] = movesLeft[last];
+        alive[zombieIndex] = alive[last];
+        streams[zombieIndex] = streams[last];
+        counters[zombieIndex] = counters[last];
+        goals[zombieIndex] = goals[last];
+        sighted[zombieIndex] = sighted[last];
+        slots[zombieIndex] = slots[last];
+        slotIndices[slots[zombieIndex]] = zombieIndex;
+    }
+
+    rows.pop_back();
+    cols.pop_back();
+    directions.pop_back();
+    movesLeft.pop_back();
+    alive.pop_back();
+    streams.pop_back();
+    counters.pop_back();
+    goals.pop_back();
+    sighted.pop_back();
+    slots.pop_back();
+}
+
+//Remove all zombies, keeping memory of arrays for next setup. Handles to them all become stale.
+void ZombieSwarm::clear() {
+    for (unsigned count = 0; count < size(); count++) {
+        kill(count);
+        freeSlots.push_back(slots[count]);
+    }
+
+    rows.clear();
+    cols.clear();
+    directions.clear();
+    movesLeft.clear();
+    alive.clear();
+    streams.clear();
+    counters.clear();
+    goals.clear();
+    sighted.clear();
+    slots.clear();
+}
+
+//Replace all zombies with copies of zombies of swarm passed, such as an image of zombies as a map was set up. Each
+//array is copied whole, keeping memory of arrays when they are large enough. Handles to zombies replaced become stale
+//and zombies copied take free handle slots of this swarm.
+void ZombieSwarm::copyFrom(const ZombieSwarm& inputSwarm) {
+    clear();
+
+    rows = inputSwarm.rows;
+    cols = inputSwarm.cols;
+    directions = inputSwarm.directions;
+    movesLeft = inputSwarm.movesLeft;
+    alive = inputSwarm.alive;
+    streams = inputSwarm.streams;
+    counters = inputSwarm.counters;
+    goals = inputSwarm.goals;
+    sighted = inputSwarm.sighted;
+
+    slots.resize(size());
+    for (unsigned count = 0; count < size(); count++) {
+        takeSlot(count);
+    }
+}
+
+//Kernel pass 1: zombies next to player attack, all others that have no moves left draw a new direction. Arrays are
+//passed as restrict pointers so that the compiler knows they do not overlap and can vectorize the loop.
+static void findAttacks(int count, const int* __restrict__ zombieRows, const int* __restrict__ zombieCols,
+                        const int* __restrict__ zombieMoves, int playerRow, int playerCol,
+                        unsigned char* __restrict__ zombieAttacks, unsigned char* __restrict__ zombieRedraws) {
+    for (int index = 0; index < count; index++) {
+        const int distance = std::abs(zombieRows[index] - playerRow) + std::abs(zombieCols[index] - playerCol);
+        const unsigned char attack = (distance == 1);
+
+        zombieAttacks[index] = attack;
+        zombieRedraws[index] = !attack & (zombieMoves[index] <= 0);
+    }
+}
+
+//Kernel pass 3: tileIndex of cell each zombie would step into. Direction is turned into a row/col step without
+//branching so that the loop vectorizes. Zombies with no direction yet target their own cell.
+static void findTargets(int count, const int* __restrict__ zombieRows, const int* __restrict__ zombieCols,
+                        const int* __restrict__ zombieDirections, int inputCols, int* __restrict__ zombieTargets) {
+    for (int index = 0; index < count; index++) {
+        const int direction = zombieDirections[index];
+        const int rowStep = (direction == 3) - (direction == 1);
+        const int colStep = (direction == 2) - (direction == 4);
+
+        zombieTargets[index] = (zombieRows[index] + rowStep) * inputCols + zombieCols[index] + colStep;
+    }
+}
+
+//Kernel pass 4: whether cell each zombie would step into is floor. Zombies with no direction yet are never open.
+static void findOpens(int count, const int* __restrict__ zombieTargets, const int* __restrict__ zombieDirections,
+                      const unsigned char* __restrict__ inputTerrain, unsigned char* __restrict__ zombieOpens) {
+    for (int index = 0; index < count; index++) {
+        zombieOpens[index] = (zombieDirections[index] != 0) & (inputTerrain[zombieTargets[index]] == TERRAIN_FLOOR);
+    }
+}
+
+//Size proposal arrays for current number of zombies. Done before propose so that ranges of zombies can be proposed
+//on several threads at once.
+void ZombieSwarm::resizeProposals() {
+    const unsigned count = size();
+
+    attacks.resize(count);
+    nextDirections.resize(count);
+    redraws.resize(count);
+    targets.resize(count);
+    opens.resize(count);
+    steers.resize(count);
+}
+
+//Batched move kernel. Fill proposal arrays for zombies from begin up to end index from terrain layer (TerrainKind byte
+//per cell in row-major order), number of columns of map, player row/col (far outside map when player is not in it)
+//Random service of game and FlowField zombies chase along (nullptr when they do not chase). Only reads zombie state
+//and writes proposals of its own range, so separate ranges may be proposed on separate threads. Zombies must not be on
+//the outer row/column of map, which are always walls.
+void ZombieSwarm::propose(unsigned inputBegin, unsigned inputEnd, const unsigned char* inputTerrain, int inputCols,
+                          int playerRow, int playerCol, Random* inputRandom, const FlowField* inputField) {
+    const int count = static_cast<int>(inputEnd - inputBegin);
+
+    findAttacks(count, rows.data() + inputBegin, cols.data() + inputBegin, movesLeft.data() + inputBegin, playerRow,
+                playerCol, attacks.data() + inputBegin, redraws.data() + inputBegin);
+
+    //Kernel pass 2: zombies inside flow field turn toward player without drawing, each reading only the distances of
+    //its four neighbors, so chasing costs the same per zombie however many zombies chase. Zombies not chasing that
+    //have a goal take the step toward it given by map. All other zombies draw new directions from their own stream,
+    //only the zombies redrawing pay for a draw.
+    for (unsigned index = inputBegin; index < inputEnd; index++) {
+        int chase = (inputField == nullptr || attacks[index]) ? 0 :
+                inputField->chaseDirection(rows[index] * inputCols + cols[index]);
+        if (chase == 0 && !attacks[index]) {
+            chase = steers[index];
+        }
+
+        if (chase != 0) {
+            nextDirections[index] = chase;
+            redraws[index] = 0;
+        }
+        else {
+            nextDirections[index] = redraws[index] ?
+                    inputRandom->randomInt(streams[index], counters[index], 1, 4) : directions[index];
+        }
+    }
+
+    findTargets(count, rows.data() + inputBegin, cols.data() + inputBegin, nextDirections.data() + inputBegin,
+                inputCols, targets.data() + inputBegin);
+    findOpens(count, targets.data() + inputBegin, nextDirections.data() + inputBegin, inputTerrain,
+              opens.data() + inputBegin);
+}
@@ -0,0 +1,187 @@
+/* Author: Justin Tromp
+ * Email: trompj@oregonstate.edu
+ * Date Created: 03/12/2019
+ * Description: ZombieSwarm class holds the state of every zombie of a map as parallel arrays rather than one object per
+ * zombie, entry n of each array belonging to zombie n. Movement of all zombies is found by a batched kernel, propose,
+ * that runs the zombie move rule over whole arrays at once: loops over plain int arrays with no calls or branches on
+ * Space objects, which the compiler can vectorize with SSE/AVX2 where it supports them. The map then commits proposed
+ * moves, either in zombie order (whether a cell is still free depends on zombies moved before it) or in two phases
+ * where conflicts between proposals are resolved by a fixed rule (see Map).
+ * Zombie move rule: a zombie next to the player (up, down, left, right) attacks instead of moving. Otherwise, when
+ * movesLeft has run out it draws a new direction from its own random stream and movesLeft is reset to 2. It then
+ * steps one cell in its direction if that cell is floor and no zombie is on it, using up one of movesLeft, or sets
+ * movesLeft to 0 so that a new direction is drawn next turn. When the map gives a FlowField (zombies chase), a zombie
+ * inside the field instead turns toward the neighbor cell closest to the player without drawing, and only falls back to
+ * drawing when it is outside the field or no neighbor is closer. A zombie that is not chasing but has a goal cell
+ * (such as a noise) takes the step toward it the map worked out along a shortest path, also without drawing.
+ * Variables: rows/cols - Location of each zombie. directions - Direction each zombie is facing, 1 for up, 2 for right,
+ * 3 for down, 4 for left and 0 before first direction is drawn. movesLeft - Moves left before each zombie draws a new
+ * direction. alive - 1 while zombie is active, 0 once it is killed. streams - Random stream id of each zombie.
+ * counters - Number of random values each zombie has drawn from its stream. goals - tileIndex of cell each zombie heads
+ * for, -1 when it has none. sighted - 1 when goal of each zombie is a cell it saw the player in. slots - Handle slot
+ * of each zombie.
+ * Zombies are referred to from outside the swarm by ZombieHandle rather than by index, as a zombie killed is removed by
+ * moving the last zombie into its index. A handle names a slot and the generation of that slot when handle was taken.
+ * A slot keeps the index of the zombie holding it, and its generation is raised when that zombie is killed or removed,
+ * so a handle to a zombie that is gone no longer matches and is found stale rather than naming whichever zombie took
+ * its index or slot since.
+ * Handle variables: slotIndices - Index of zombie holding each slot. generations - Generation of each slot.
+ * freeSlots - Slots no zombie holds, given to zombies added next.
+ * Proposal arrays, filled by propose for each zombie: attacks - 1 if zombie attacks player. nextDirections - Direction
+ * after any new direction is drawn or chosen by chase. redraws - 1 if a new direction was drawn. targets - tileIndex
+ * of cell zombie would step into. opens - 1 if that cell is floor. steers - Direction of next step toward goal of each
+ * zombie, 0 when it has none, filled by map before propose.
+ * Functions: add - Add zombie at row/col drawing from random stream passed.
+ * kill - Mark zombie at index passed dead, making handles to it stale. Zombie keeps its index until it is removed.
+ * remove - Remove zombie at index passed by moving last zombie into its index.
+ * handleOf - Return handle of zombie at index passed.
+ * indexOf - Return index of zombie handle passed refers to, or -1 if it is stale.
+ * clear - Remove all zombies, keeping memory of arrays for next setup.
+ * copyFrom - Replace all zombies with copies of zombies of another swarm, arrays copied whole.
+ * takeSlot - Give zombie at index passed a free handle slot.
+ * size - Return number of zombies.
+ * resizeProposals - Size proposal arrays for current number of zombies.
+ * propose - Batched move kernel, fill proposal arrays for a range of zombies from terrain layer, player location,
+ * Random service and FlowField passed. Separate ranges may be proposed on separate threads.
+ * commit - Apply proposal of zombie at index passed, taking whether it is allowed to step into its target cell.
+*/
+
+#ifndef ZOMBIESWARM_HPP
+#define ZOMBIESWARM_HPP
+
+#include <cstdint>
+#include <vector>
+#include "Random.hpp"
+#include "FlowField.hpp"
+
+//Reference to a zombie of a ZombieSwarm that stays valid while the zombie changes index, and is found stale once the
+//zombie is killed. Slot held by zombie and generation of slot when handle was taken.
+struct ZombieHandle {
+    uint32_t slot;
+    uint32_t generation;
+};
+
+class ZombieSwarm {
+public:
+    //Location, facing direction and moves left of each zombie
+    std::vector <int> rows;
+    std::vector <int> cols;
+    std::vector <int> directions;
+    std::vector <int> movesLeft;
+
+    //1 while zombie is active, 0 once it is killed
+    std::vector <unsigned char> alive;
+
+    //Random stream id of each zombie and number of random values it has drawn from it
+    std::vector <uint64_t> streams;
+    std::vector <uint64_t> counters;
+
+    //tileIndex of cell each zombie heads for, -1 when it has none
+    std::vector <int> goals;
+
+    //1 when goal of each zombie is a cell it saw the player in, 0 for a goal of any other kind or none
+    std::vector <unsigned char> sighted;
+
+    //Handle slot held by each zombie
+    std::vector <uint32_t> slots;
+
+    //Index of zombie holding each slot, generation of each slot and slots no zombie holds
+    std::vector <uint32_t> slotIndices;
+    std::vector <uint32_t> generations;
+    std::vector <uint32_t> freeSlots;
+
+    //Proposal of each zombie filled by propose: attack flag, direction after any new direction is drawn, whether a
+    //new direction was drawn, tileIndex of cell zombie would step into and whether that cell is floor
+    std::vector <unsigned char> attacks;
+    std::vector <int> nextDirections;
+    std::vector <unsigned char> redraws;
+    std::vector <int> targets;
+    std::vector <unsigned char> opens;
+
+    //Direction of next step toward goal of each zombie, 0 when it has none. Filled by map before propose, as the
+    //path to a goal is found through the map's Pathfinder.
+    std::vector <int> steers;
+
+    //Add zombie at row/col drawing from random stream passed. Zombie has 2 moves left, no direction and no goal yet,
+    //and takes a free handle slot.
+    void add(int inputRow, int inputCol, uint64_t inputStream);
+
+    //Mark zombie at index passed dead, making handles to it stale. Zombie keeps its index until it is removed, so
+    //zombies may be killed while arrays are walked and removed together afterwards.
+    void kill(unsigned zombieIndex);
+
+    //Remove zombie at index passed by moving last zombie into its index, freeing its handle slot. Only the zombie
+    //moved changes index, so removing zombies costs the same however many zombies there are.
+    void remove(unsigned zombieIndex);
+
+    //Remove all zombies, keeping memory of arrays for next setup. Handles to them all become stale.
+    void clear();
+
+    //Replace all zombies with copies of zombies of swarm passed, such as an image of zombies as a map was set up. Each
+    //array is copied whole, keeping memory of arrays when they are large enough. Handles to zombies replaced become
+    //stale and zombies copied take free handle slots of this swarm.
+    void copyFrom(const ZombieSwarm& inputSwarm);
+
+    //Return handle of zombie at index passed
+    ZombieHandle handleOf(unsigned zombieIndex) const {
+        const uint32_t slot = slots[zombieIndex];
+        ZombieHandle handle = {slot, generations[slot]};
+
+        return handle;
+    }
+
+    //Return index of zombie handle passed refers to, or -1 if zombie has been killed or removed since handle was
+    //taken
+    int indexOf(ZombieHandle inputHandle) const {
+        if (inputHandle.slot >= generations.size() || generations[inputHandle.slot] != inputHandle.generation) {
+            return -1;
+        }
+
+        return static_cast<int>(slotIndices[inputHandle.slot]);
+    }
+
+    //Return number of zombies
+    unsigned size() const {
+        return static_cast<unsigned>(rows.size());
+    }
+
+    //Size proposal arrays for current number of zombies. Done before propose so that ranges of zombies can be proposed
+    //on several threads at once.
+    void resizeProposals();
+
+    //Batched move kernel. Fill proposal arrays for zombies from begin up to end index from terrain layer (TerrainKind
+    //byte per cell in row-major order), number of columns of map, player row/col (far outside map when player is not
+    //in it), Random service of game and FlowField zombies chase along (nullptr when they do not chase). Only reads
+    //zombie state and writes proposals of its own range, so separate ranges may be proposed on separate threads.
+    //Zombies must not be on the outer row/column of map, which are always walls.
+    void propose(unsigned inputBegin, unsigned inputEnd, const unsigned char* inputTerrain, int inputCols,
+                 int playerRow, int playerCol, Random* inputRandom, const FlowField* inputField = nullptr);
+
+    //Apply proposal of zombie at index passed that did not attack: take any new direction drawn or chosen by chase,
+    //then step into target cell and use up a move if step is allowed, or set movesLeft to 0 so that a new direction is
+    //drawn next turn. Map decides whether the step is allowed, as it depends on zombies committed before this one.
+    //Defined in header as it is called for every zombie every turn.
+    void commit(unsigned zombieIndex, bool inputStepped) {
+        directions[zombieIndex] = nextDirections[zombieIndex];
+        if (redraws[zombieIndex]) {
+            counters[zombieIndex]++;
+            movesLeft[zombieIndex] = 2;
+        }
+
+        if (inputStepped) {
+            const int direction = directions[zombieIndex];
+            rows[zombieIndex] += (direction == 3) - (direction == 1);
+            cols[zombieIndex] += (direction == 2) - (direction == 4);
+            movesLeft[zombieIndex]--;
+        }
+        else {
+            movesLeft[zombieIndex] = 0;
+        }
+    }
+
+private:
+    //Give zombie at index passed a free handle slot, reusing a slot freed by a zombie removed or opening a new one
+    void takeSlot(unsigned zombieIndex);
+};
+
+#endif //ZOMBIESWARM_HPP
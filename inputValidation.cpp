@@ -5,12 +5,32 @@
  * validateInputRangeInt - Validate integer input from min through max parameters passed to function.
  * stringUpperCase - Takes string as parameter and returns string in all upper case.
  * validateMove - Accept/validate user input for control selection. Returns string of validated selection.
+ * setInputReplay/getInputReplay - Set/return Replay that validated inputs are recorded into or played back from.
+ * While a replay is played back, validateInputRangeInt and validateMove take their input from it without prompting.
 */
 
 #include "inputValidation.hpp"
 
+//Replay that validated inputs are recorded into or played back from, nullptr for neither
+static Replay* activeReplay = nullptr;
+
+//Set Replay that validated inputs are recorded into or played back from, nullptr (default) for neither
+void setInputReplay(Replay* inputReplay) {
+    activeReplay = inputReplay;
+}
+
+//Return Replay that validated inputs are recorded into or played back from, or nullptr
+Replay* getInputReplay() {
+    return activeReplay;
+}
+
 //Validate integer input from min through max parameters passed to function
 int validateInputRangeInt (int min, int max) {
+    //Replay played back gives input without asking
+    if (activeReplay != nullptr && activeReplay->isPlaying()) {
+        return activeReplay->nextChoice(min, max);
+    }
+
     int userInput = 0;
     std::string userStringInput = " ";
 
@@ -45,6 +65,10 @@ int validateInputRangeInt (int min, int max) {
         }
     }
 
+    if (activeReplay != nullptr) {
+        activeReplay->recordChoice(userInput);
+    }
+
     return userInput;
 }
 
@@ -61,6 +85,11 @@ std::string stringUpperCase(std::string inputString) {
 
 //Accept/validate user input for control selection. Returns string of validated selection.
 std::string validateMove() {
+    //Replay played back gives input without asking
+    if (activeReplay != nullptr && activeReplay->isPlaying()) {
+        return activeReplay->nextMove();
+    }
+
     std::string userInput = "";
 
     std::cout << "Please enter a movement selection above, capitalization does not matter: ";
@@ -88,5 +117,9 @@ std::string validateMove() {
 
     } while (!inputValid);
 
+    if (activeReplay != nullptr) {
+        activeReplay->recordMove(userInput);
+    }
+
     return userInput;
 }
\ No newline at end of file
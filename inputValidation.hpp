@@ -5,6 +5,8 @@
  * validateInputRangeInt - Validate integer input from min through max parameters passed to function.
  * stringUpperCase - Takes string as parameter and returns string in all upper case.
  * validateMove - Accept/validate user input for control selection. Returns string of validated selection.
+ * setInputReplay/getInputReplay - Set/return Replay that validated inputs are recorded into or played back from.
+ * While a replay is played back, validateInputRangeInt and validateMove take their input from it without prompting.
 */
 
 #ifndef INPUTVALIDATION_HPP
@@ -13,6 +15,7 @@
 #include <iostream>
 #include <string>
 #include <algorithm>
+#include "Replay.hpp"
 
 //Validate integer input from min through max parameters passed to function
 int validateInputRangeInt (int min, int max);
@@ -24,4 +27,10 @@ std::string stringUpperCase(std::string inputString);
 //Accept/validate user input for control selection. Returns string of validated selection.
 std::string validateMove();
 
+//Set Replay that validated inputs are recorded into or played back from, nullptr (default) for neither
+void setInputReplay(Replay* inputReplay);
+
+//Return Replay that validated inputs are recorded into or played back from, or nullptr
+Replay* getInputReplay();
+
 #endif //INPUTVALIDATION_HPP
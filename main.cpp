@@ -3,16 +3,260 @@
  * Date Created: 03/12/2019
  * Description: Main function for Zombie game creates Game object and runs game by using Game class object to activate
  * runGame function to operate game until loss or user quits.
+ * Options: --seed N (or --seed=N) - Seed for random zombie movement. The same seed plays out the same game for the same
+ * input. Without it a seed is taken from the system random device.
+ * --chase R (or --chase=R) - Zombies within R steps of the player chase the player instead of wandering at random.
+ * --sight R (or --sight=R) - Zombies within R cells that can see the player (walls, shelves and closed doors block
+ * sight) head for where they saw the player.
+ * --noise - Zombies hear doors opening, items being picked up and knife kills, and head for the noise.
+ * --realtime HZ (or --realtime=HZ) - Real-time mode: the world moves HZ times a second whether the player acts or not,
+ * and keys are read as they are pressed without Enter. Timing jitter of ticks is reported when each game ends.
+ * --lod N (or --lod=N) - Maps the player is not in are moved N turns at a time (default 8). 1 moves every map every
+ * turn, 0 only moves a map when the player enters it. The game plays out the same for any N.
+ * --size R[xC] (or --size=R[xC]) and --zombies N (or --zombies=N) - Scenario world: outdoors map of R rows and C
+ * columns (R by R if C is not given, each at most 16384) with N zombies scattered over it on top of the standard ones.
+ * --save FILE (or --save=FILE) - Save game to a compact binary save file when the player exits a game (Q).
+ * --load FILE (or --load=FILE) - Carry on game saved in save file. The world must be set up as it was saved (same
+ * --size). Options are not saved and are taken from the command line.
+ * --record FILE (or --record=FILE) - Record seed, options and every input of session to a binary replay file.
+ * --replay FILE (or --replay=FILE) - Play session recorded in replay file again, with seed and options it was recorded
+ * with (other options are ignored). Nothing is drawn or prompted for and turns run as fast as they can, then number of
+ * turns played, time taken and a hash of the final state of world are output.
 */
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <random>
+#include <string>
 #include "Game.hpp"
+#include "Outdoors.hpp"
+#include "Replay.hpp"
 
-int main() {
+int main(int argc, char* argv[]) {
+    //Seed from system random device unless one is given on the command line
+    std::random_device randomNumDevice;
+    uint64_t seed = (static_cast<uint64_t>(randomNumDevice()) << 32) | randomNumDevice();
 
-    Game gameBegin;
+    //Zombies wander unless a chase radius is given
+    int chaseRadius = 0;
+
+    //Zombies only find player next to them unless a sight radius is given
+    int sightRadius = 0;
+
+    //Zombies are deaf unless told to hear noise
+    bool hearing = false;
+
+    //Turn-based unless a tick rate is given
+    unsigned tickRate = 0;
+
+    //Maps player is not in are caught up every few turns unless told otherwise
+    unsigned lodInterval = Game::defaultLodInterval;
+
+    //Standard world unless a scenario size or zombie count is given
+    int outdoorRows = 0;
+    int outdoorCols = 0;
+    int outdoorZombies = 0;
+
+    //Game is only saved on exit or loaded from a save file when one is given
+    std::string savePath;
+    std::string loadPath;
+
+    //Inputs are only recorded or played back from a replay file when one is given
+    std::string recordPath;
+    std::string replayPath;
+
+    for (int count = 1; count < argc; count++) {
+        if (std::strcmp(argv[count], "--seed") == 0 && count + 1 < argc) {
+            seed = std::strtoull(argv[++count], nullptr, 10);
+        }
+        else if (std::strncmp(argv[count], "--seed=", 7) == 0) {
+            seed = std::strtoull(argv[count] + 7, nullptr, 10);
+        }
+        else if (std::strcmp(argv[count], "--chase") == 0 && count + 1 < argc) {
+            chaseRadius = std::atoi(argv[++count]);
+        }
+        else if (std::strncmp(argv[count], "--chase=", 8) == 0) {
+            chaseRadius = std::atoi(argv[count] + 8);
+        }
+        else if (std::strcmp(argv[count], "--sight") == 0 && count + 1 < argc) {
+            sightRadius = std::atoi(argv[++count]);
+        }
+        else if (std::strncmp(argv[count], "--sight=", 8) == 0) {
+            sightRadius = std::atoi(argv[count] + 8);
+        }
+        else if (std::strcmp(argv[count], "--noise") == 0) {
+            hearing = true;
+        }
+        else if (std::strcmp(argv[count], "--realtime") == 0 && count + 1 < argc) {
+            tickRate = static_cast<unsigned>(std::strtoul(argv[++count], nullptr, 10));
+        }
+        else if (std::strncmp(argv[count], "--realtime=", 11) == 0) {
+            tickRate = static_cast<unsigned>(std::strtoul(argv[count] + 11, nullptr, 10));
+        }
+        else if (std::strcmp(argv[count], "--lod") == 0 && count + 1 < argc) {
+            lodInterval = static_cast<unsigned>(std::strtoul(argv[++count], nullptr, 10));
+        }
+        else if (std::strncmp(argv[count], "--lod=", 6) == 0) {
+            lodInterval = static_cast<unsigned>(std::strtoul(argv[count] + 6, nullptr, 10));
+        }
+        else if ((std::strcmp(argv[count], "--size") == 0 && count + 1 < argc) ||
+                 std::strncmp(argv[count], "--size=", 7) == 0) {
+            const char* size = (argv[count][6] == '=') ? argv[count] + 7 : argv[++count];
+            char* sizeEnd = nullptr;
+
+            //Sizes are read in full before they are narrowed, so that one too large is not read as a smaller one
+            const long sizeRows = std::strtol(size, &sizeEnd, 10);
+            const long sizeCols = (*sizeEnd == 'x') ? std::strtol(sizeEnd + 1, nullptr, 10) : sizeRows;
+            if (sizeRows > Outdoors::maxSize || sizeCols > Outdoors::maxSize) {
+                std::cout << "Scenario size may be at most " << Outdoors::maxSize << " rows and columns" << std::endl;
+                return 1;
+            }
+
+            outdoorRows = static_cast<int>(std::max(sizeRows, 0L));
+            outdoorCols = static_cast<int>(std::max(sizeCols, 0L));
+        }
+        else if (std::strcmp(argv[count], "--zombies") == 0 && count + 1 < argc) {
+            outdoorZombies = std::atoi(argv[++count]);
+        }
+        else if (std::strncmp(argv[count], "--zombies=", 10) == 0) {
+            outdoorZombies = std::atoi(argv[count] + 10);
+        }
+        else if (std::strcmp(argv[count], "--save") == 0 && count + 1 < argc) {
+            savePath = argv[++count];
+        }
+        else if (std::strncmp(argv[count], "--save=", 7) == 0) {
+            savePath = argv[count] + 7;
+        }
+        else if (std::strcmp(argv[count], "--load") == 0 && count + 1 < argc) {
+            loadPath = argv[++count];
+        }
+        else if (std::strncmp(argv[count], "--load=", 7) == 0) {
+            loadPath = argv[count] + 7;
+        }
+        else if (std::strcmp(argv[count], "--record") == 0 && count + 1 < argc) {
+            recordPath = argv[++count];
+        }
+        else if (std::strncmp(argv[count], "--record=", 9) == 0) {
+            recordPath = argv[count] + 9;
+        }
+        else if (std::strcmp(argv[count], "--replay") == 0 && count + 1 < argc) {
+            replayPath = argv[++count];
+        }
+        else if (std::strncmp(argv[count], "--replay=", 9) == 0) {
+            replayPath = argv[count] + 9;
+        }
+        else {
+            std::cout << "Usage: " << argv[0] << " [--seed N] [--chase R] [--sight R] [--noise] [--realtime HZ]"
+                      << " [--lod N] [--size R[xC]] [--zombies N] [--save FILE] [--load FILE]"
+                      << " [--record FILE | --replay FILE]" << std::endl;
+            return 1;
+        }
+    }
+
+    //A replay plays from start of world it recorded, so a loaded game is not recorded or replayed. Checked before
+    //replay file is opened, so that a file named for recording is not truncated.
+    if (!loadPath.empty() && (!recordPath.empty() || !replayPath.empty())) {
+        std::cout << "A loaded game can not be recorded or replayed" << std::endl;
+        return 1;
+    }
+
+    //A replay is played with the seed and options it was recorded with
+    Replay replay;
+    if (!replayPath.empty()) {
+        if (!replay.load(replayPath)) {
+            std::cout << "Could not read replay file " << replayPath << std::endl;
+            return 1;
+        }
+
+        const ReplayHeader& header = replay.getHeader();
+        seed = header.seed;
+        chaseRadius = static_cast<int>(header.chaseRadius);
+        sightRadius = static_cast<int>(header.sightRadius);
+        hearing = header.hearing != 0;
+        lodInterval = static_cast<unsigned>(header.lodInterval);
+        tickRate = static_cast<unsigned>(header.tickRate);
+        outdoorRows = static_cast<int>(header.outdoorRows);
+        outdoorCols = static_cast<int>(header.outdoorCols);
+        outdoorZombies = static_cast<int>(header.outdoorZombies);
+    }
+    else if (!recordPath.empty()) {
+        ReplayHeader header;
+        header.seed = seed;
+        header.chaseRadius = static_cast<uint64_t>(chaseRadius);
+        header.sightRadius = static_cast<uint64_t>(sightRadius);
+        header.hearing = hearing;
+        header.lodInterval = lodInterval;
+        header.tickRate = tickRate;
+        header.outdoorRows = static_cast<uint64_t>(outdoorRows);
+        header.outdoorCols = static_cast<uint64_t>(outdoorCols);
+        header.outdoorZombies = static_cast<uint64_t>(outdoorZombies);
+
+        if (!replay.startRecording(recordPath, header)) {
+            std::cout << "Could not create replay file " << recordPath << std::endl;
+            return 1;
+        }
+    }
+
+    //Real-time mode reads keys straight from standard input, so stdio must not read ahead of it
+    if (tickRate > 0 && !replay.isPlaying()) {
+        std::setvbuf(stdin, nullptr, _IONBF, 0);
+    }
+
+    Game gameBegin(seed, outdoorRows, outdoorCols, outdoorZombies);
+    gameBegin.setChaseRadius(chaseRadius);
+    gameBegin.setSightRadius(sightRadius);
+    gameBegin.setHearing(hearing);
+    gameBegin.setLodInterval(lodInterval);
+    gameBegin.setTickRate(tickRate);
+
+    if (!loadPath.empty() && !gameBegin.loadGame(loadPath)) {
+        std::cout << "Could not load save file " << loadPath << " into this world" << std::endl;
+        return 1;
+    }
+    gameBegin.setSavePath(savePath);
+
+    if (replay.isRecording() || replay.isPlaying()) {
+        setInputReplay(&replay);
+    }
+
+    //A replay is played headless: output is dropped and map is not drawn, so turns run as fast as game moves
+    if (replay.isPlaying()) {
+        std::streambuf* screen = std::cout.rdbuf(nullptr);
+        gameBegin.setRender(false);
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        gameBegin.runGame();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout.rdbuf(screen);
+        std::cout.clear();
+
+        std::cout << "Replayed " << replay.getInputCount() << " inputs, " << gameBegin.getTurnsPlayed() << " turns in "
+                  << seconds * 1000.0 << " ms (" << gameBegin.getTurnsPlayed() / seconds << " turns/s)" << std::endl;
+        std::cout << "Final state hash: " << std::hex << gameBegin.stateHash() << std::dec << std::endl;
+
+        if (replay.hasDiverged()) {
+            std::cout << "Replay diverged: game asked for a different kind of input than was recorded" << std::endl;
+        }
+        else if (!replay.atEnd()) {
+            std::cout << "Replay ended before all recorded inputs were played" << std::endl;
+        }
+
+        setInputReplay(nullptr);
+        return replay.hasDiverged() ? 1 : 0;
+    }
 
     gameBegin.runGame();
 
+    if (replay.isRecording()) {
+        std::cout << "Recorded " << replay.getInputCount() << " inputs to " << recordPath << std::endl;
+        std::cout << "Final state hash: " << std::hex << gameBegin.stateHash() << std::dec << std::endl;
+        setInputReplay(nullptr);
+    }
+
     return 0;
-}
\ No newline at end of file
+}